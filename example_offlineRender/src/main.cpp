@@ -0,0 +1,73 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofMain.h"
+#include "ofApp.h"
+#include "ofAppGLFWWindow.h"
+
+//========================================================================
+// usage: example_offlineRender patch.xml frames fps objectID:outletID:path [objectID:outletID:path ...]
+//
+// the GL context lives in a hidden GLFW window, so an X server is still required;
+// on a machine without a display run it on Xvfb with a software GL driver:
+// LIBGL_ALWAYS_SOFTWARE=1 xvfb-run -s "-screen 0 1280x720x24" ./bin/example_offlineRender ...
+int main(int argc, char *argv[]){
+
+    if(argc < 5){
+        ofLog(OF_LOG_ERROR,"usage: %s patch.xml frames fps objectID:outletID:path [...]",argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    shared_ptr<ofApp> renderApp(new ofApp);
+    renderApp->patchFile    = argv[1];
+    renderApp->totalFrames  = ofToInt(argv[2]);
+    renderApp->fps          = ofToFloat(argv[3]);
+    for(int i=4;i<argc;i++){
+        renderApp->outputs.push_back(argv[i]);
+    }
+
+    ofGLFWWindowSettings settings;
+    settings.setGLVersion(2, 1);
+    settings.stencilBits = 0;
+    settings.setSize(1280,720);
+    // GL context only, nothing is shown
+    settings.visible = false;
+
+    shared_ptr<ofAppBaseWindow> renderWindow = ofCreateWindow(settings);
+
+    ofRunApp(renderWindow,renderApp);
+    ofRunMainLoop();
+
+    // done
+    return renderApp->exitCode;
+
+}
@@ -0,0 +1,91 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofApp.h"
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+    // no vsync, no frame rate cap: render as fast as possible
+    ofSetVerticalSync(false);
+    ofSetFrameRate(0);
+
+    exitCode = EXIT_SUCCESS;
+
+    visualProgramming = new ofxVisualProgramming();
+    visualProgramming->setHeadless(true);
+    visualProgramming->setup();
+
+    if(!renderer.setup(visualProgramming,ofToDataPath(patchFile,true),fps)){
+        exitCode = EXIT_FAILURE;
+        ofExit(exitCode);
+        return;
+    }
+
+    for(size_t i=0;i<outputs.size();i++){
+        vector<string> out = ofSplitString(outputs[i],":");
+        if(out.size() != 3 || !renderer.addOutput(ofToInt(out[0]),ofToInt(out[1]),out[2])){
+            ofLog(OF_LOG_ERROR,"invalid output %s",outputs[i].c_str());
+            exitCode = EXIT_FAILURE;
+            ofExit(exitCode);
+            return;
+        }
+    }
+
+    startTime = ofGetSystemTimeMillis();
+}
+
+//--------------------------------------------------------------
+void ofApp::update(){
+
+}
+
+//--------------------------------------------------------------
+void ofApp::draw(){
+    if(renderer.getFrame() >= totalFrames){
+        return;
+    }
+
+    renderer.step();
+
+    if(renderer.getFrame() == totalFrames){
+        double seconds = (ofGetSystemTimeMillis()-startTime)/1000.0;
+        ofLog(OF_LOG_NOTICE,"%i frames in %.2f s (%.1fx real time)",totalFrames,seconds,seconds > 0.0 ? renderer.getTime()/seconds : 0.0);
+        renderer.close();
+        ofExit(exitCode);
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::exit(){
+    renderer.close();
+    delete visualProgramming;
+}
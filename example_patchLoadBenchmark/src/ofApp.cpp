@@ -0,0 +1,226 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofApp.h"
+
+#include <numeric>
+
+// the old loader waited after every object and link, and after the audio setup
+#define OLD_LOADER_OBJECT_WAIT_MS   10
+#define OLD_LOADER_AUDIO_WAIT_MS    200
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+    ofSetWindowTitle("ofxVisualProgramming patch load benchmark");
+    ofSetFrameRate(60);
+
+    numObjects  = 400;
+    numLinks    = 900;
+    linksMade   = 0;
+    numRuns     = 5;
+
+    visualProgramming = new ofxVisualProgramming();
+    visualProgramming->setup();
+
+    state = BENCHMARK_WAIT_PATCH;
+}
+
+//--------------------------------------------------------------
+void ofApp::buildPatch(){
+    vector<int> ids;
+    for(int i=0;i<numObjects;i++){
+        visualProgramming->addObject("simple random",ofVec2f(100 + (i%20)*160, 100 + (i/20)*100));
+        ids.push_back(visualProgramming->lastAddedObjectID);
+    }
+
+    // numeric links from the previous objects into the 3 inlets (bang, min, max)
+    linksMade = 0;
+    for(int s=0;s<3 && linksMade<numLinks;s++){
+        for(int t=1;t<static_cast<int>(ids.size()) && linksMade<numLinks;t++){
+            int from = std::max(0,t-1-s);
+            if(visualProgramming->connect(ids[from],0,ids[t],s,VP_LINK_NUMERIC)){
+                visualProgramming->patchObjects[ids[from]]->saveConfig(true);
+                linksMade++;
+            }
+        }
+    }
+
+    ofLog(OF_LOG_NOTICE,"benchmark patch: %i objects, %i links",numObjects,linksMade);
+}
+
+//--------------------------------------------------------------
+void ofApp::loadPatchOldLoader(){
+    // the loader this addon had before the loading rework, same steps and waits: the flag is
+    // raised with no lock handshake with the audio callback, fixed sleeps instead of readiness
+    ofxVisualProgramming *vp = visualProgramming;
+
+    vp->bLoadingNewPatch = true;
+
+    for(map<int,shared_ptr<PatchObject>>::iterator it = vp->patchObjects.begin(); it != vp->patchObjects.end(); it++ ){
+        it->second->removeObjectContent();
+    }
+    vp->patchObjects.clear();
+
+    ofxXmlSettings XML;
+    if(XML.loadFile(vp->currentPatchFile)){
+        // audio engine setup (the engine itself is kept)
+        if(vp->dspON){
+            std::this_thread::sleep_for(std::chrono::milliseconds(OLD_LOADER_AUDIO_WAIT_MS));
+        }
+
+        int totalObjects = XML.getNumTags("object");
+
+        for(int i=0;i<totalObjects;i++){
+            if(XML.pushTag("object", i)){
+                shared_ptr<PatchObject> tempObj = vp->selectObject(XML.getValue("name",""));
+                if(tempObj != nullptr && tempObj->loadConfig(vp->mainWindow,*vp->engine,i,vp->currentPatchFile)){
+                    tempObj->setPatchfile(vp->currentPatchFile);
+                    tempObj->setIsRetina(vp->isRetina);
+                    ofAddListener(tempObj->removeEvent ,vp,&ofxVisualProgramming::removeObject);
+                    ofAddListener(tempObj->resetEvent ,vp,&ofxVisualProgramming::resetObject);
+                    ofAddListener(tempObj->reconnectOutletsEvent ,vp,&ofxVisualProgramming::reconnectObjectOutlets);
+                    ofAddListener(tempObj->duplicateEvent ,vp,&ofxVisualProgramming::duplicateObject);
+                    vp->patchObjects[tempObj->getId()] = tempObj;
+                    vp->actualObjectID = tempObj->getId();
+                    vp->lastAddedObjectID = tempObj->getId();
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(OLD_LOADER_OBJECT_WAIT_MS));
+                }
+                XML.popTag();
+            }
+        }
+
+        for(int i=0;i<totalObjects;i++){
+            if(XML.pushTag("object", i)){
+                int fromID = XML.getValue("id", -1);
+                if(XML.pushTag("outlets")){
+                    for(int j=0;j<XML.getNumTags("link");j++){
+                        if(XML.pushTag("link",j)){
+                            int linkType = XML.getValue("type", 0);
+                            for(int z=0;z<XML.getNumTags("to");z++){
+                                if(XML.pushTag("to",z)){
+                                    if(vp->connect(fromID,j,XML.getValue("id", 0),XML.getValue("inlet", 0),linkType)){
+                                        std::this_thread::sleep_for(std::chrono::milliseconds(OLD_LOADER_OBJECT_WAIT_MS));
+                                    }
+                                    XML.popTag();
+                                }
+                            }
+                            XML.popTag();
+                        }
+                    }
+                    XML.popTag();
+                }
+                XML.popTag();
+            }
+        }
+    }
+
+    vp->bLoadingNewPatch = false;
+}
+
+//--------------------------------------------------------------
+void ofApp::printResults(){
+    for(size_t i=0;i<loadTimes.size() && i<oldLoadTimes.size();i++){
+        ofLog(OF_LOG_NOTICE,"run %i: old loader %.1f ms (ready %.1f ms) | loadPatch %.1f ms (ready %.1f ms)",static_cast<int>(i+1),oldLoadTimes[i],oldReadyTimes[i],loadTimes[i],readyTimes[i]);
+    }
+    double meanOldLoad  = std::accumulate(oldLoadTimes.begin(),oldLoadTimes.end(),0.0)/oldLoadTimes.size();
+    double meanOldReady = std::accumulate(oldReadyTimes.begin(),oldReadyTimes.end(),0.0)/oldReadyTimes.size();
+    double meanLoad     = std::accumulate(loadTimes.begin(),loadTimes.end(),0.0)/loadTimes.size();
+    double meanReady    = std::accumulate(readyTimes.begin(),readyTimes.end(),0.0)/readyTimes.size();
+    ofLog(OF_LOG_NOTICE,"mean: old loader %.1f ms (ready %.1f ms) | loadPatch %.1f ms (ready %.1f ms) | %.1fx faster to ready",meanOldLoad,meanOldReady,meanLoad,meanReady,meanReady > 0.0 ? meanOldReady/meanReady : 0.0);
+}
+
+//--------------------------------------------------------------
+void ofApp::update(){
+    visualProgramming->update();
+
+    if(state == BENCHMARK_WAIT_PATCH && visualProgramming->isPatchReady()){
+        buildPatch();
+        oldLoadTimes.clear();
+        oldReadyTimes.clear();
+        loadTimes.clear();
+        readyTimes.clear();
+        state = BENCHMARK_LOAD_OLD;
+    }else if(state == BENCHMARK_LOAD_OLD){
+        loadStart = ofGetElapsedTimeMicros();
+        loadPatchOldLoader();
+        oldLoadTimes.push_back((ofGetElapsedTimeMicros()-loadStart)/1000.0);
+        state = BENCHMARK_WAIT_READY_OLD;
+    }else if(state == BENCHMARK_WAIT_READY_OLD && visualProgramming->isPatchReady()){
+        oldReadyTimes.push_back((ofGetElapsedTimeMicros()-loadStart)/1000.0);
+        ofLog(OF_LOG_NOTICE,"old loader run %i: load %.1f ms, patch ready %.1f ms",static_cast<int>(oldLoadTimes.size()),oldLoadTimes.back(),oldReadyTimes.back());
+        state = static_cast<int>(oldLoadTimes.size()) < numRuns ? BENCHMARK_LOAD_OLD : BENCHMARK_LOAD;
+    }else if(state == BENCHMARK_LOAD){
+        loadStart = ofGetElapsedTimeMicros();
+        visualProgramming->reloadPatch();
+        loadTimes.push_back((ofGetElapsedTimeMicros()-loadStart)/1000.0);
+        state = BENCHMARK_WAIT_READY;
+    }else if(state == BENCHMARK_WAIT_READY && visualProgramming->isPatchReady()){
+        readyTimes.push_back((ofGetElapsedTimeMicros()-loadStart)/1000.0);
+        ofLog(OF_LOG_NOTICE,"run %i: loadPatch %.1f ms, patch ready %.1f ms",static_cast<int>(loadTimes.size()),loadTimes.back(),readyTimes.back());
+        if(static_cast<int>(loadTimes.size()) < numRuns){
+            state = BENCHMARK_LOAD;
+        }else{
+            state = BENCHMARK_DONE;
+            printResults();
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::draw(){
+    ofBackground(20);
+    visualProgramming->draw();
+
+    ofSetColor(255);
+    ofDrawBitmapString("patch load benchmark: "+ofToString(numObjects)+" objects, "+ofToString(linksMade)+" links (press space to run again)",20,ofGetHeight()-40-16*static_cast<int>(oldLoadTimes.size()));
+    for(size_t i=0;i<oldLoadTimes.size();i++){
+        string oldReady = i < oldReadyTimes.size() ? ofToString(oldReadyTimes[i],1) : "...";
+        string run = "run "+ofToString(i+1)+": old loader "+ofToString(oldLoadTimes[i],1)+" ms, ready "+oldReady+" ms";
+        if(i < loadTimes.size()){
+            string ready = i < readyTimes.size() ? ofToString(readyTimes[i],1) : "...";
+            run += " | loadPatch "+ofToString(loadTimes[i],1)+" ms, ready "+ready+" ms";
+        }
+        ofDrawBitmapString(run,20,ofGetHeight()-24-16*static_cast<int>(oldLoadTimes.size()-1-i));
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::keyPressed(int key){
+    if(key == ' ' && state == BENCHMARK_DONE){
+        oldLoadTimes.clear();
+        oldReadyTimes.clear();
+        loadTimes.clear();
+        readyTimes.clear();
+        state = BENCHMARK_LOAD_OLD;
+    }
+}
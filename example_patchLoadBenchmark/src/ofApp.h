@@ -0,0 +1,79 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVisualProgramming.h"
+
+enum BenchmarkState {
+    BENCHMARK_WAIT_PATCH,
+    BENCHMARK_LOAD_OLD,
+    BENCHMARK_WAIT_READY_OLD,
+    BENCHMARK_LOAD,
+    BENCHMARK_WAIT_READY,
+    BENCHMARK_DONE
+};
+
+// patch load time benchmark: builds a big synthetic patch (objects + links),
+// then reloads it several times with a replica of the old loader (fixed waits after every object
+// and link, no audio callback handshake) and with loadPatch(), measuring the load call and the
+// time until every object is ready, printed side by side
+class ofApp : public ofBaseApp {
+
+public:
+
+    void setup();
+    void update();
+    void draw();
+    void keyPressed(int key);
+
+    void buildPatch();
+    void loadPatchOldLoader();
+    void printResults();
+
+    ofxVisualProgramming    *visualProgramming;
+
+    int                     state;
+    int                     numObjects;
+    int                     numLinks;
+    int                     linksMade;
+    int                     numRuns;
+
+    uint64_t                loadStart;
+    vector<double>          oldLoadTimes;   // ms inside loadPatchOldLoader()
+    vector<double>          oldReadyTimes;
+    vector<double>          loadTimes;      // ms inside loadPatch()
+    vector<double>          readyTimes;     // ms until isPatchReady()
+
+};
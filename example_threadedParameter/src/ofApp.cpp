@@ -0,0 +1,122 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofApp.h"
+
+#define BENCHMARK_SECONDS 1.0
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+    ofSetFrameRate(30);
+    ofBackground(20);
+
+    runAll();
+}
+
+//--------------------------------------------------------------
+template<typename T, typename F>
+BenchmarkResult ofApp::runBenchmark(const string& name, F toValue, double seconds){
+    ofxVPThreadedParameter<T> param(toValue(0.0f),name);
+
+    std::atomic<bool> running(true);
+    uint64_t threadOps      = 0;
+    uint64_t threadSyncs    = 0;
+
+    std::thread worker([&](){
+        float acc = 0.0f;
+        while(running.load(std::memory_order_relaxed)){
+            if(param.syncFromThread()){
+                threadSyncs++;
+            }
+            acc += 1.0f;
+            param.setFromThread(toValue(acc));
+            threadOps++;
+        }
+    });
+
+    uint64_t mainOps = 0;
+    float acc = 0.0f;
+    uint64_t start = ofGetElapsedTimeMicros();
+    uint64_t end = start + static_cast<uint64_t>(seconds*1000000.0);
+    while(ofGetElapsedTimeMicros() < end){
+        for(int i=0;i<1000;i++){
+            acc += 1.0f;
+            param.set(toValue(acc));
+            param.syncFromMainThread();
+        }
+        mainOps += 1000;
+    }
+    running = false;
+    worker.join();
+
+    // the channel implementation keeps every value not received yet, drain it before destruction
+    param.syncFromMainThread();
+
+    double elapsed = (ofGetElapsedTimeMicros() - start)/1000000.0;
+
+    BenchmarkResult res;
+    res.name        = name;
+    res.mainOps     = mainOps/elapsed;
+    res.threadOps   = threadOps/elapsed;
+    res.threadSyncs = threadSyncs/elapsed;
+    return res;
+}
+
+//--------------------------------------------------------------
+void ofApp::runAll(){
+    results.clear();
+    results.push_back(runBenchmark<ChannelFloat>("ofThreadChannel",[](float v){ return ChannelFloat(v); },BENCHMARK_SECONDS));
+    results.push_back(runBenchmark<float>("triple buffer",[](float v){ return v; },BENCHMARK_SECONDS));
+
+    for(size_t i=0;i<results.size();i++){
+        ofLog(OF_LOG_NOTICE,"%s: main %.2f Mops/s, thread %.2f Mops/s, worker updates %.2f M/s",results[i].name.c_str(),results[i].mainOps/1e6,results[i].threadOps/1e6,results[i].threadSyncs/1e6);
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::draw(){
+    ofSetColor(255);
+    ofDrawBitmapString("ofxVPThreadedParameter<T> contention benchmark (press space to run again)",20,30);
+
+    for(size_t i=0;i<results.size();i++){
+        ofDrawBitmapString(results[i].name,20,80+i*60);
+        ofDrawBitmapString("main thread:   "+ofToString(results[i].mainOps/1e6,2)+" Mops/s",40,100+i*60);
+        ofDrawBitmapString("worker thread: "+ofToString(results[i].threadOps/1e6,2)+" Mops/s ("+ofToString(results[i].threadSyncs/1e6,2)+" M updates/s)",40,115+i*60);
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::keyPressed(int key){
+    if(key == ' '){
+        runAll();
+    }
+}
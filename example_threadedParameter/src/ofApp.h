@@ -0,0 +1,70 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVPThreadedParameter.h"
+
+// not trivially copyable: goes through the ofThreadChannel based implementation
+struct ChannelFloat {
+    ChannelFloat(float _v=0.0f) : v(_v) {}
+    ChannelFloat(const ChannelFloat& other) : v(other.v) {}
+    ChannelFloat& operator=(const ChannelFloat& other){ v = other.v; return *this; }
+    float v;
+};
+
+struct BenchmarkResult {
+    string  name;
+    double  mainOps;        // set() + syncFromMainThread() per second, main thread
+    double  threadOps;      // syncFromThread() + setFromThread() per second, worker thread
+    double  threadSyncs;    // syncFromThread() calls that brought a new value, per second
+};
+
+// contention benchmark: the main thread and a worker hammer the same parameter in both directions
+class ofApp : public ofBaseApp {
+
+public:
+
+    void setup();
+    void draw();
+    void keyPressed(int key);
+
+    template<typename T, typename F>
+    BenchmarkResult runBenchmark(const string& name, F toValue, double seconds);
+
+    void runAll();
+
+    vector<BenchmarkResult> results;
+
+};
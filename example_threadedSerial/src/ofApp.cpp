@@ -0,0 +1,306 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "ofApp.h"
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#ifdef TARGET_OSX
+#include <util.h>
+#else
+#include <pty.h>
+#endif
+
+#define TEST_FRAMES         2000
+#define TEST_CHUNK_BYTES    7
+#define TEST_TIMEOUT_MS     3000
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+    ofSetFrameRate(30);
+    ofBackground(20);
+
+    masterFD = slaveFD = -1;
+
+    // raw line discipline on the slave, the bytes reach the worker untouched
+    struct termios tio;
+    memset(&tio,0,sizeof(tio));
+    cfmakeraw(&tio);
+    char name[256];
+    if(openpty(&masterFD,&slaveFD,name,&tio,nullptr) != 0){
+        ofLog(OF_LOG_ERROR,"openpty failed: %s",strerror(errno));
+        return;
+    }
+    slavePath = name;
+    fcntl(masterFD,F_SETFL,fcntl(masterFD,F_GETFL) | O_NONBLOCK);
+
+    runAll();
+}
+
+//--------------------------------------------------------------
+void ofApp::exit(){
+    if(masterFD >= 0) close(masterFD);
+    if(slaveFD >= 0) close(slaveFD);
+}
+
+//--------------------------------------------------------------
+vector<float> ofApp::frameValues(SERIAL_FRAMING framing, int i){
+    vector<float> values;
+    if(framing == SERIAL_FRAMING_RAW){
+        // a full raw frame, one byte per value
+        for(int b=0;b<SERIAL_RAW_FRAME_SIZE;b++){
+            values.push_back(static_cast<float>((i+b)%256));
+        }
+    }else{
+        // 0 and the framing delimiters show up in the binary payloads
+        values = { static_cast<float>(i), static_cast<float>(i)*0.5f, -static_cast<float>(i), 0.0f, 1.0f/3.0f, 192.0f, 219.0f };
+    }
+    return values;
+}
+
+//--------------------------------------------------------------
+// device side encoder, written from the framing specs and not shared with ThreadedSerial
+vector<unsigned char> ofApp::encodeFrame(SERIAL_FRAMING framing, SERIAL_PROTOCOL protocol, const vector<float> &values, bool withSize){
+    vector<unsigned char> payload;
+    if(framing == SERIAL_FRAMING_RAW && !withSize){
+        for(size_t i=0;i<values.size();i++){
+            payload.push_back(static_cast<unsigned char>(values[i]));
+        }
+        return payload;
+    }
+    if(protocol == SERIAL_PROTOCOL_BINARY){
+        payload.resize(values.size()*sizeof(float));
+        memcpy(payload.data(),values.data(),payload.size());
+    }else{
+        // the worker prefixes the values with their count when sending
+        string text = withSize ? ofToString(values.size()) : "";
+        for(size_t i=0;i<values.size();i++){
+            if(withSize || i > 0) text += ",";
+            text += ofToString(values[i]);
+        }
+        payload.assign(text.begin(),text.end());
+    }
+
+    vector<unsigned char> frame;
+    switch(framing){
+        case SERIAL_FRAMING_RAW:
+            frame = payload;
+            if(protocol == SERIAL_PROTOCOL_TEXT) frame.push_back('\n');
+            break;
+        case SERIAL_FRAMING_LINE:
+            frame = payload;
+            frame.push_back('\n');
+            break;
+        case SERIAL_FRAMING_COBS:{
+            // every zero byte becomes the distance to the next one, 0xFF marks a run of 254 non zero bytes
+            size_t codeIndex = frame.size();
+            unsigned char code = 1;
+            frame.push_back(0);
+            for(size_t i=0;i<payload.size();i++){
+                if(payload[i] != 0){
+                    frame.push_back(payload[i]);
+                    code++;
+                }
+                if(payload[i] == 0 || code == 0xFF){
+                    frame[codeIndex] = code;
+                    codeIndex = frame.size();
+                    frame.push_back(0);
+                    code = 1;
+                }
+            }
+            frame[codeIndex] = code;
+            frame.push_back(0x00);
+            break;
+        }
+        case SERIAL_FRAMING_SLIP:
+            frame.push_back(SLIP_END);
+            for(size_t i=0;i<payload.size();i++){
+                if(payload[i] == SLIP_END){
+                    frame.push_back(SLIP_ESC); frame.push_back(SLIP_ESC_END);
+                }else if(payload[i] == SLIP_ESC){
+                    frame.push_back(SLIP_ESC); frame.push_back(SLIP_ESC_ESC);
+                }else{
+                    frame.push_back(payload[i]);
+                }
+            }
+            frame.push_back(SLIP_END);
+            break;
+        default:
+            break;
+    }
+    return frame;
+}
+
+//--------------------------------------------------------------
+bool ofApp::writeAll(const vector<unsigned char> &bytes, size_t chunk){
+    size_t done = 0;
+    while(done < bytes.size()){
+        ssize_t n = write(masterFD,bytes.data()+done,std::min(chunk,bytes.size()-done));
+        if(n > 0){
+            done += static_cast<size_t>(n);
+        }else if(n < 0 && errno != EAGAIN){
+            return false;
+        }else{
+            // pty buffer full, the worker is behind
+            ofSleepMillis(1);
+        }
+    }
+    return true;
+}
+
+//--------------------------------------------------------------
+vector<unsigned char> ofApp::readFor(int ms){
+    vector<unsigned char> bytes;
+    unsigned char buf[256];
+    uint64_t end = ofGetElapsedTimeMillis() + ms;
+    while(ofGetElapsedTimeMillis() < end){
+        ssize_t n = read(masterFD,buf,sizeof(buf));
+        if(n > 0){
+            bytes.insert(bytes.end(),buf,buf+n);
+        }else{
+            ofSleepMillis(1);
+        }
+    }
+    return bytes;
+}
+
+//--------------------------------------------------------------
+SerialTestResult ofApp::runTest(SERIAL_FRAMING framing, SERIAL_PROTOCOL protocol, const string& name, int numFrames){
+    SerialTestResult res;
+    res.name            = name;
+    res.framesSent      = 0;
+    res.framesReceived  = 0;
+    res.framesDropped   = 0;
+    res.lastFrameOk     = false;
+    res.sendOk          = false;
+    res.framesPerSec    = 0.0;
+    res.latencyMs       = 0.0f;
+
+    ThreadedSerial serial;
+    serial.setFraming(framing);
+    serial.setProtocol(protocol);
+    if(!serial.setup(slavePath,115200)){
+        ofLog(OF_LOG_ERROR,"%s: can't open %s",name.c_str(),slavePath.c_str());
+        return res;
+    }
+    // nothing left from the previous test
+    tcflush(masterFD,TCIOFLUSH);
+
+    // DEVICE -> PATCH: frames split in chunks, the patch polls like an object update
+    vector<float> received;
+    uint64_t start = ofGetElapsedTimeMicros();
+    for(int i=0;i<numFrames;i++){
+        vector<unsigned char> frame = encodeFrame(framing,protocol,frameValues(framing,i),false);
+        // raw frames in one write, a read ends them
+        writeAll(frame,framing == SERIAL_FRAMING_RAW ? frame.size() : TEST_CHUNK_BYTES);
+        res.framesSent++;
+        serial.receive(received);
+        // raw frames have no delimiter: one frame in flight, or the worker reads them merged
+        if(framing == SERIAL_FRAMING_RAW){
+            uint64_t wait = ofGetElapsedTimeMillis() + TEST_TIMEOUT_MS;
+            while(serial.getStats().framesIn < static_cast<uint64_t>(i+1) && ofGetElapsedTimeMillis() < wait){
+                ofSleepMillis(0);
+            }
+        }
+    }
+    uint64_t wait = ofGetElapsedTimeMillis() + TEST_TIMEOUT_MS;
+    while(serial.getStats().framesIn + serial.getStats().framesDropped < static_cast<uint64_t>(numFrames) && ofGetElapsedTimeMillis() < wait){
+        ofSleepMillis(1);
+    }
+    double elapsed = (ofGetElapsedTimeMicros() - start)/1000000.0;
+    serial.receive(received);
+
+    vector<float> expected = frameValues(framing,numFrames-1);
+    res.lastFrameOk = received.size() == expected.size();
+    for(size_t i=0;res.lastFrameOk && i<expected.size();i++){
+        // text values go through ofToString()
+        res.lastFrameOk = fabs(received[i]-expected[i]) < 0.001f;
+    }
+
+    SerialStats stats   = serial.getStats();
+    res.framesReceived  = static_cast<int>(stats.framesIn);
+    res.framesDropped   = static_cast<int>(stats.framesDropped);
+    res.framesPerSec    = stats.framesIn/elapsed;
+    res.latencyMs       = stats.latencyMs;
+
+    // PATCH -> DEVICE
+    vector<float> out = { 1.0f, 2.0f, 127.0f, 0.0f };
+    serial.send(out);
+    vector<unsigned char> sent = readFor(200);
+    res.sendOk = sent == encodeFrame(framing,protocol,out,true);
+
+    serial.close();
+    return res;
+}
+
+//--------------------------------------------------------------
+void ofApp::runAll(){
+    results.clear();
+    if(masterFD < 0){
+        return;
+    }
+
+    results.push_back(runTest(SERIAL_FRAMING_RAW,SERIAL_PROTOCOL_TEXT,"raw (MosaicConnector)",TEST_FRAMES/10));
+    results.push_back(runTest(SERIAL_FRAMING_LINE,SERIAL_PROTOCOL_TEXT,"line / text",TEST_FRAMES));
+    results.push_back(runTest(SERIAL_FRAMING_COBS,SERIAL_PROTOCOL_TEXT,"COBS / text",TEST_FRAMES));
+    results.push_back(runTest(SERIAL_FRAMING_COBS,SERIAL_PROTOCOL_BINARY,"COBS / float32",TEST_FRAMES));
+    results.push_back(runTest(SERIAL_FRAMING_SLIP,SERIAL_PROTOCOL_TEXT,"SLIP / text",TEST_FRAMES));
+    results.push_back(runTest(SERIAL_FRAMING_SLIP,SERIAL_PROTOCOL_BINARY,"SLIP / float32",TEST_FRAMES));
+
+    for(size_t i=0;i<results.size();i++){
+        const SerialTestResult &r = results[i];
+        ofLog(OF_LOG_NOTICE,"%s: %i/%i frames, %i dropped, last frame %s, send %s, %.0f frames/s, latency %.2f ms",r.name.c_str(),r.framesReceived,r.framesSent,r.framesDropped,r.lastFrameOk ? "ok" : "WRONG",r.sendOk ? "ok" : "WRONG",r.framesPerSec,r.latencyMs);
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::draw(){
+    ofSetColor(255);
+    ofDrawBitmapString("ThreadedSerial over a pseudo terminal "+slavePath+" (press space to run again)",20,30);
+
+    for(size_t i=0;i<results.size();i++){
+        const SerialTestResult &r = results[i];
+        ofSetColor(r.lastFrameOk && r.sendOk && r.framesDropped == 0 && r.framesReceived == r.framesSent ? ofColor(120,255,120) : ofColor(255,120,120));
+        ofDrawBitmapString(r.name,20,80+i*50);
+        ofSetColor(255);
+        ofDrawBitmapString("received "+ofToString(r.framesReceived)+"/"+ofToString(r.framesSent)+" frames, "+ofToString(r.framesDropped)+" dropped, last frame "+(r.lastFrameOk ? "ok" : "WRONG")+", send "+(r.sendOk ? "ok" : "WRONG"),40,100+i*50);
+        ofDrawBitmapString(ofToString(r.framesPerSec,0)+" frames/s, latency "+ofToString(r.latencyMs,2)+" ms",40,115+i*50);
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::keyPressed(int key){
+    if(key == ' '){
+        runAll();
+    }
+}
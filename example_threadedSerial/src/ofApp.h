@@ -0,0 +1,76 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ThreadedSerial.h"
+
+struct SerialTestResult {
+    string  name;
+    int     framesSent;
+    int     framesReceived;     // ThreadedSerial frame counter, the patch only sees the latest one
+    int     framesDropped;
+    bool    lastFrameOk;        // last received frame equals the last one sent
+    bool    sendOk;             // a vector sent by the worker arrives encoded as expected
+    double  framesPerSec;
+    float   latencyMs;
+};
+
+// ThreadedSerial driven through a pseudo terminal: the master side plays the
+// device, writing frames in small chunks (partial frames across reads) for
+// every framing/protocol pair and checking what the worker sends back
+class ofApp : public ofBaseApp {
+
+public:
+
+    void setup();
+    void draw();
+    void keyPressed(int key);
+    void exit();
+
+    SerialTestResult runTest(SERIAL_FRAMING framing, SERIAL_PROTOCOL protocol, const string& name, int numFrames);
+
+    void runAll();
+
+    vector<unsigned char> encodeFrame(SERIAL_FRAMING framing, SERIAL_PROTOCOL protocol, const vector<float> &values, bool withSize);
+    vector<float> frameValues(SERIAL_FRAMING framing, int i);
+    bool writeAll(const vector<unsigned char> &bytes, size_t chunk);
+    vector<unsigned char> readFor(int ms);
+
+    int                         masterFD;
+    int                         slaveFD;
+    string                      slavePath;
+    vector<SerialTestResult>    results;
+
+};
@@ -0,0 +1,272 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#include "ofApp.h"
+
+#define BENCHMARK_SECONDS   0.2
+
+enum OLD_OPERATOR { OLD_OPERATOR_ADD, OLD_OPERATOR_SUBTRACT, OLD_OPERATOR_MULTIPLY, OLD_OPERATOR_DIVIDE };
+
+//--------------------------------------------------------------
+// the node loops before ofxVPMath: output cleared and refilled with push_back, through at()
+static void oldVectorOperator(const vector<float> *data, vector<float> *result, int _operator, float number){
+    result->clear();
+    for(size_t s=0;s<static_cast<size_t>(data->size());s++){
+        if(_operator == OLD_OPERATOR_ADD){
+            result->push_back(data->at(s)+number);
+        }else if(_operator == OLD_OPERATOR_SUBTRACT){
+            result->push_back(data->at(s)-number);
+        }else if(_operator == OLD_OPERATOR_MULTIPLY){
+            result->push_back(data->at(s)*number);
+        }else if(_operator == OLD_OPERATOR_DIVIDE){
+            result->push_back(data->at(s)/number);
+        }
+    }
+}
+
+static void oldVectorConcat(const vector<const vector<float> *> &inlets, vector<float> *result){
+    result->clear();
+    for(size_t i=0;i<inlets.size();i++){
+        for(size_t s=0;s<static_cast<size_t>(inlets[i]->size());s++){
+            result->push_back(inlets[i]->at(s));
+        }
+    }
+}
+
+static void oldVectorExtract(const vector<float> *data, vector<float> *result, size_t start, size_t end){
+    result->clear();
+    if(start < end){
+        for(size_t s=start;s<end;s++){
+            result->push_back(data->at(s));
+        }
+    }
+}
+
+static void oldFloatsToVector(const vector<float> &inlets, vector<float> *result){
+    for(size_t i=0;i<inlets.size();i++){
+        result->at(i) = inlets[i];
+    }
+}
+
+//--------------------------------------------------------------
+// the same nodes now (updateObjectContent() of each one)
+static void newVectorOperator(const vector<float> &data, vector<float> &result, int _operator, float number){
+    switch(_operator){
+        case OLD_OPERATOR_ADD:      ofxVPMath::add(data,number,result); break;
+        case OLD_OPERATOR_SUBTRACT: ofxVPMath::sub(data,number,result); break;
+        case OLD_OPERATOR_MULTIPLY: ofxVPMath::mul(data,number,result); break;
+        case OLD_OPERATOR_DIVIDE:   ofxVPMath::div(data,number,result); break;
+        default: result.clear(); break;
+    }
+}
+
+static void newVectorConcat(const vector<const vector<float> *> &inlets, vector<float> &result){
+    size_t totalSize = 0;
+    for(size_t i=0;i<inlets.size();i++){
+        totalSize += inlets[i]->size();
+    }
+    ofxVPMath::prepare(result,totalSize);
+    size_t offset = 0;
+    for(size_t i=0;i<inlets.size();i++){
+        ofxVPMath::copy(inlets[i]->data(),inlets[i]->size(),result,offset);
+        offset += inlets[i]->size();
+    }
+}
+
+static void newVectorExtract(const vector<float> &data, vector<float> &result, size_t start, size_t end){
+    ofxVPMath::prepare(result,end-start);
+    ofxVPMath::copy(data.data()+start,end-start,result);
+}
+
+static void newFloatsToVector(const vector<float> &inlets, vector<float> &result){
+    ofxVPMath::prepare(result,inlets.size());
+    float *dst = result.data();
+    for(size_t i=0;i<inlets.size();i++){
+        dst[i] = inlets[i];
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::setup(){
+    ofSetFrameRate(30);
+    ofBackground(20);
+
+    runAll();
+}
+
+//--------------------------------------------------------------
+// kernel calls per second over BENCHMARK_SECONDS, returned as elements per second
+template<typename F>
+double ofApp::timeKernel(F kernel, size_t n){
+    uint64_t calls = 0;
+    uint64_t start = ofGetElapsedTimeMicros();
+    uint64_t end = start + static_cast<uint64_t>(BENCHMARK_SECONDS*1000000.0);
+    uint64_t now = start;
+    while(now < end){
+        for(int i=0;i<16;i++){
+            kernel();
+        }
+        calls += 16;
+        now = ofGetElapsedTimeMicros();
+    }
+    return static_cast<double>(calls)*n/((now-start)/1000000.0);
+}
+
+//--------------------------------------------------------------
+static bool sameFloats(const vector<float> &x, const vector<float> &y){
+    // bitwise, NaN included (-0.0f and 0.0f too)
+    return x.size() == y.size() && memcmp(x.data(),y.data(),x.size()*sizeof(float)) == 0;
+}
+
+//--------------------------------------------------------------
+void ofApp::runAll(){
+    using namespace ofxVPMath;
+
+    results.clear();
+
+    const SIMD_LEVEL previous = getSIMDLevel();
+    const SIMD_LEVEL best = getSupportedSIMDLevel();
+
+    const vector<string> workloads = { "vector operator +", "vector operator *", "vector operator /", "vector concat", "vector extract", "floats to vector" };
+    const vector<size_t> sizes = { 64, 4096, 1<<20 };
+
+    for(size_t s=0;s<sizes.size();s++){
+        const size_t n = sizes[s];
+
+        // odd sizes exercise the scalar tails too
+        a.resize(n+3); b.resize(n+3);
+        for(size_t i=0;i<a.size();i++){
+            a[i] = ofRandom(-2.0f,2.0f);
+            b[i] = ofRandom(-2.0f,2.0f);
+        }
+        // values where the instruction sets used to disagree
+        a[0] = NAN;                 b[1] = NAN;
+        a[2] = INFINITY;            b[3] = -INFINITY;
+        a[4] = -0.0f;               b[4] = 0.0f;
+
+        const vector<const vector<float> *> concatInlets = { &a, &b };
+        // a node has at most MAX_INLETS floats, the same 32 at every size
+        floats.assign(a.begin(),a.begin()+std::min<size_t>(32,a.size()));
+
+        for(size_t w=0;w<workloads.size();w++){
+            const string &name = workloads[w];
+            if(name == "floats to vector" && s > 0){
+                continue;
+            }
+
+            std::function<void()> oldLoop, newLoop;
+            size_t elements = a.size();
+            if(name == "vector operator +"){
+                oldLoop = [&](){ oldVectorOperator(&a,&reference,OLD_OPERATOR_ADD,0.5f); };
+                newLoop = [&](){ newVectorOperator(a,out,OLD_OPERATOR_ADD,0.5f); };
+            }else if(name == "vector operator *"){
+                oldLoop = [&](){ oldVectorOperator(&a,&reference,OLD_OPERATOR_MULTIPLY,0.5f); };
+                newLoop = [&](){ newVectorOperator(a,out,OLD_OPERATOR_MULTIPLY,0.5f); };
+            }else if(name == "vector operator /"){
+                oldLoop = [&](){ oldVectorOperator(&a,&reference,OLD_OPERATOR_DIVIDE,3.0f); };
+                newLoop = [&](){ newVectorOperator(a,out,OLD_OPERATOR_DIVIDE,3.0f); };
+            }else if(name == "vector concat"){
+                elements = a.size()+b.size();
+                oldLoop = [&](){ oldVectorConcat(concatInlets,&reference); };
+                newLoop = [&](){ newVectorConcat(concatInlets,out); };
+            }else if(name == "vector extract"){
+                elements = a.size()/2;
+                oldLoop = [&](){ oldVectorExtract(&a,&reference,a.size()/4,a.size()/4+a.size()/2); };
+                newLoop = [&](){ newVectorExtract(a,out,a.size()/4,a.size()/4+a.size()/2); };
+            }else{
+                elements = floats.size();
+                reference.assign(floats.size(),0.0f);
+                oldLoop = [&](){ oldFloatsToVector(floats,&reference); };
+                newLoop = [&](){ newFloatsToVector(floats,out); };
+            }
+
+            WorkloadResult res;
+            res.workload    = name;
+            res.n           = elements;
+            res.matchesOld  = true;
+
+            // outlet buffers live across frames: timed warm, like in a running patch
+            oldLoop();
+            res.oldRate     = timeKernel(oldLoop,elements);
+
+            setSIMDLevel(SIMD_SCALAR);
+            out.clear();
+            newLoop();
+            res.matchesOld  = sameFloats(out,reference);
+            res.scalarRate  = timeKernel(newLoop,elements);
+
+            setSIMDLevel(best);
+            out.clear();
+            newLoop();
+            res.matchesOld  = res.matchesOld && sameFloats(out,reference);
+            res.simdRate    = timeKernel(newLoop,elements);
+
+            results.push_back(res);
+        }
+    }
+
+    setSIMDLevel(previous);
+
+    for(size_t i=0;i<results.size();i++){
+        const WorkloadResult &r = results[i];
+        ofLog(OF_LOG_NOTICE,"%-18s n=%-8zu old loop %9.1f | scalar %9.1f | %-6s %9.1f Melem/s  x%6.2f  %s",r.workload.c_str(),r.n,r.oldRate/1e6,r.scalarRate/1e6,getSIMDLevelName(best),r.simdRate/1e6,r.oldRate > 0.0 ? r.simdRate/r.oldRate : 1.0,r.matchesOld ? "ok" : "MISMATCH");
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::draw(){
+    ofSetColor(255);
+    ofDrawBitmapString("data nodes, old loops vs ofxVPMath scalar and "+string(ofxVPMath::getSIMDLevelName(ofxVPMath::getSupportedSIMDLevel()))+" in Melem/s (press space to run again)",20,30);
+
+    int y = 60;
+    for(size_t i=0;i<results.size();i++){
+        const WorkloadResult &r = results[i];
+        if(i > 0 && r.n != results[i-1].n && r.workload == results[0].workload){
+            y += 10;
+        }
+        ofSetColor(r.matchesOld ? ofColor(255) : ofColor(255,120,120));
+        ofDrawBitmapString(r.workload+" n="+ofToString(r.n),20,y);
+        ofDrawBitmapString(ofToString(r.oldRate/1e6,1)+" | "+ofToString(r.scalarRate/1e6,1)+" | "+ofToString(r.simdRate/1e6,1)+"  x"+ofToString(r.oldRate > 0.0 ? r.simdRate/r.oldRate : 1.0,2)+(r.matchesOld ? "" : "  MISMATCH"),320,y);
+        y += 15;
+        if(y > ofGetHeight()-20){
+            break;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::keyPressed(int key){
+    if(key == ' '){
+        runAll();
+    }
+}
@@ -0,0 +1,68 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    Mosaic is distributed under the MIT License. This gives everyone the
+    freedoms to use Mosaic in any context: commercial or non-commercial,
+    public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "vectorMath.h"
+
+struct WorkloadResult {
+    string                  workload;
+    size_t                  n;
+    double                  oldRate;        // elements per second, loop the node used before ofxVPMath
+    double                  scalarRate;     // ofxVPMath at SIMD_SCALAR
+    double                  simdRate;       // ofxVPMath at the best level the cpu supports
+    bool                    matchesOld;     // same output as the old loop, NaN/inf inputs included
+};
+
+// the data nodes moved onto ofxVPMath (vector operator, vector concat, vector extract,
+// floats to vector), timed against the per element loops they had before
+class ofApp : public ofBaseApp {
+
+public:
+
+    void setup();
+    void draw();
+    void keyPressed(int key);
+
+    template<typename F>
+    double timeKernel(F kernel, size_t n);
+
+    void runAll();
+
+    vector<float>           a, b, out, reference;
+    vector<float>           floats;         // floats to vector inlets
+    vector<WorkloadResult>  results;
+
+};
@@ -0,0 +1,293 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "OfflineRenderer.h"
+
+//--------------------------------------------------------------
+OfflineRenderer::OfflineRenderer(){
+    visualProgramming   = nullptr;
+    samplesDue          = 0.0;
+    audioBlocks         = 0;
+    fps                 = 30.0f;
+    frame               = 0;
+    isOpen              = false;
+}
+
+//--------------------------------------------------------------
+OfflineRenderer::~OfflineRenderer(){
+    close();
+}
+
+//--------------------------------------------------------------
+bool OfflineRenderer::setup(ofxVisualProgramming *vp, const string &patchFile, float _fps){
+    if(vp == nullptr || !vp->headless){
+        ofLog(OF_LOG_ERROR,"OfflineRenderer: call ofxVisualProgramming::setHeadless(true) before its setup()");
+        return false;
+    }
+
+    ofFile patch(patchFile);
+    if(!patch.exists()){
+        ofLog(OF_LOG_ERROR,"OfflineRenderer: patch %s not found",patchFile.c_str());
+        return false;
+    }
+
+    visualProgramming   = vp;
+    fps                 = _fps > 0.0f ? _fps : 30.0f;
+
+    // work on a temp copy, as when opening a patch in Mosaic, the original patch is never modified
+    visualProgramming->newTempPatchFromFile(patch.getAbsolutePath());
+
+    // let the patch clear/load cycle run, still on the system clock, until every object is ready
+    uint64_t start = ofGetElapsedTimeMillis();
+    while(!visualProgramming->isPatchReady()){
+        visualProgramming->update();
+        visualProgramming->draw();
+        ofSleepMillis(1);
+        if(ofGetElapsedTimeMillis()-start > 30000){
+            ofLog(OF_LOG_ERROR,"OfflineRenderer: timeout loading %s",patchFile.c_str());
+            return false;
+        }
+    }
+
+    // output channels of the null stream, as the patch audio settings
+    int outChannels = 2;
+    ofxXmlSettings XML;
+    if(XML.loadFile(visualProgramming->currentPatchFile) && XML.pushTag("settings")){
+        outChannels = std::max(1,XML.getValue("output_channels",2));
+        XML.popTag();
+    }
+    nullOutput.allocate(visualProgramming->audioBufferSize,outChannels);
+    nullOutput.setSampleRate(visualProgramming->audioSampleRate);
+
+    // from now on every clock of the patch follows the rendered frames
+    ofSetTimeModeFixedRate(ofGetFixedStepForFps(fps));
+    ofxVPAudioClock::get().setOffline(true);
+
+    samplesDue  = 0.0;
+    audioBlocks = 0;
+    frame       = 0;
+    isOpen      = true;
+
+    ofLog(OF_LOG_NOTICE,"OfflineRenderer: %s loaded, rendering at %.2f fps, audio %i Hz",patchFile.c_str(),fps,visualProgramming->audioSampleRate);
+
+    return true;
+}
+
+//--------------------------------------------------------------
+bool OfflineRenderer::addOutput(int objectID, int outletID, const string &path){
+    if(visualProgramming == nullptr || visualProgramming->patchObjects.find(objectID) == visualProgramming->patchObjects.end()){
+        ofLog(OF_LOG_ERROR,"OfflineRenderer: object %i not found",objectID);
+        return false;
+    }
+    shared_ptr<PatchObject> obj = visualProgramming->patchObjects[objectID];
+    if(outletID < 0 || outletID >= obj->getNumOutlets()){
+        ofLog(OF_LOG_ERROR,"OfflineRenderer: object %i has no outlet %i",objectID,outletID);
+        return false;
+    }
+
+    // shared_ptr: the open ofFile must never be copied
+    shared_ptr<OfflineRenderOutput> output = make_shared<OfflineRenderOutput>();
+    OfflineRenderOutput &out = *output;
+    out.objectID        = objectID;
+    out.outletID        = outletID;
+    out.type            = obj->getOutletType(outletID);
+    out.path            = ofToDataPath(path,true);
+    out.audioSamples    = 0;
+    out.audioChannels   = 0;
+    out.lastAudioBlock  = 0;
+
+    ofDirectory::createDirectory(ofFilePath::getEnclosingDirectory(out.path),false,true);
+
+    if(out.type == VP_LINK_AUDIO){
+        out.file.open(out.path+".wav",ofFile::WriteOnly,true);
+    }else if(out.type == VP_LINK_NUMERIC || out.type == VP_LINK_STRING || out.type == VP_LINK_ARRAY){
+        out.file.open(out.path+".csv",ofFile::WriteOnly,false);
+        out.file << "frame,time,value" << endl;
+    }else if(out.type != VP_LINK_TEXTURE && out.type != VP_LINK_PIXELS){
+        ofLog(OF_LOG_ERROR,"OfflineRenderer: outlet %s of object %i can't be dumped",obj->getOutletName(outletID).c_str(),objectID);
+        return false;
+    }
+
+    // the object keeps filling this outlet even if nothing is connected to it in the patch
+    obj->outletsExternalMask |= 1u << outletID;
+
+    outputs.push_back(output);
+
+    ofLog(OF_LOG_NOTICE,"OfflineRenderer: dumping %s outlet %s to %s",obj->getName().c_str(),obj->getOutletName(outletID).c_str(),path.c_str());
+
+    return true;
+}
+
+//--------------------------------------------------------------
+void OfflineRenderer::step(){
+    if(!isOpen){
+        return;
+    }
+
+    // audio covering this frame
+    samplesDue += visualProgramming->audioSampleRate/static_cast<double>(fps);
+    while(samplesDue >= visualProgramming->audioBufferSize){
+        processAudio();
+        samplesDue -= visualProgramming->audioBufferSize;
+    }
+
+    // texture objects render in their draw, step() must run inside the app draw()
+    visualProgramming->update();
+    visualProgramming->draw();
+
+    writeOutputs(false);
+
+    frame++;
+}
+
+//--------------------------------------------------------------
+void OfflineRenderer::processAudio(){
+    // null sound stream: the engine renders into a buffer nobody plays
+    nullOutput.set(0.0f);
+    visualProgramming->engine->audioOut(nullOutput);
+    audioBlocks++;
+
+    writeOutputs(true);
+}
+
+//--------------------------------------------------------------
+void OfflineRenderer::writeOutputs(bool audioOnly){
+    for(size_t i=0;i<outputs.size();i++){
+        OfflineRenderOutput &out = *outputs[i];
+
+        map<int,shared_ptr<PatchObject>>::iterator it = visualProgramming->patchObjects.find(out.objectID);
+        if(it == visualProgramming->patchObjects.end() || it->second->getWillErase()){
+            continue;
+        }
+        void *outlet = it->second->_outletParams[out.outletID];
+
+        if(audioOnly != (out.type == VP_LINK_AUDIO)){
+            continue;
+        }
+
+        if(out.type == VP_LINK_AUDIO){
+            ofSoundBuffer *buffer = static_cast<ofSoundBuffer *>(outlet);
+            if(buffer == nullptr || buffer->getNumFrames() == 0 || out.lastAudioBlock == audioBlocks){
+                continue;
+            }
+            out.lastAudioBlock = audioBlocks;
+            if(out.audioChannels == 0){
+                out.audioChannels = static_cast<int>(buffer->getNumChannels());
+                writeWavHeader(out);
+            }
+            size_t samples = buffer->getNumFrames()*std::min(static_cast<size_t>(out.audioChannels),buffer->getNumChannels());
+            out.file.write(reinterpret_cast<const char *>(buffer->getBuffer().data()),samples*sizeof(float));
+            out.audioSamples += samples;
+        }else if(out.type == VP_LINK_TEXTURE){
+            ofTexture *tex = static_cast<ofTexture *>(outlet);
+            if(tex != nullptr && tex->isAllocated()){
+                tex->readToPixels(out.pixels);
+                ofSaveImage(out.pixels,out.path+"_"+ofToString(frame,6,'0')+".png");
+            }
+        }else if(out.type == VP_LINK_PIXELS){
+            ofPixels *pix = static_cast<ofPixels *>(outlet);
+            if(pix != nullptr && pix->isAllocated()){
+                ofSaveImage(*pix,out.path+"_"+ofToString(frame,6,'0')+".png");
+            }
+        }else{
+            out.file << frame << "," << ofToString(getTime(),6);
+            if(out.type == VP_LINK_NUMERIC){
+                out.file << "," << *(float *)&it->second->_outletParams[out.outletID];
+            }else if(out.type == VP_LINK_STRING){
+                string value = *static_cast<string *>(outlet);
+                ofStringReplace(value,"\"","\"\"");
+                out.file << ",\"" << value << "\"";
+            }else if(out.type == VP_LINK_ARRAY){
+                const vector<float> &values = *static_cast<vector<float> *>(outlet);
+                for(size_t v=0;v<values.size();v++){
+                    out.file << "," << values[v];
+                }
+            }
+            out.file << endl;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void OfflineRenderer::writeWavHeader(OfflineRenderOutput &out){
+    // 32 bit float PCM, sizes are patched on close()
+    uint32_t sampleRate = static_cast<uint32_t>(visualProgramming->audioSampleRate);
+    uint16_t channels   = static_cast<uint16_t>(out.audioChannels);
+    uint16_t bits       = 32;
+    uint16_t format     = 3;
+    uint32_t byteRate   = sampleRate*channels*bits/8;
+    uint16_t blockAlign = channels*bits/8;
+    uint32_t fmtSize    = 16;
+    uint32_t dataSize   = out.audioSamples*sizeof(float);
+    uint32_t riffSize   = 36 + dataSize;
+
+    out.file.seekp(0);
+    out.file.write("RIFF",4);
+    out.file.write(reinterpret_cast<const char *>(&riffSize),4);
+    out.file.write("WAVEfmt ",8);
+    out.file.write(reinterpret_cast<const char *>(&fmtSize),4);
+    out.file.write(reinterpret_cast<const char *>(&format),2);
+    out.file.write(reinterpret_cast<const char *>(&channels),2);
+    out.file.write(reinterpret_cast<const char *>(&sampleRate),4);
+    out.file.write(reinterpret_cast<const char *>(&byteRate),4);
+    out.file.write(reinterpret_cast<const char *>(&blockAlign),2);
+    out.file.write(reinterpret_cast<const char *>(&bits),2);
+    out.file.write("data",4);
+    out.file.write(reinterpret_cast<const char *>(&dataSize),4);
+}
+
+//--------------------------------------------------------------
+void OfflineRenderer::close(){
+    if(!isOpen){
+        return;
+    }
+    isOpen = false;
+
+    for(size_t i=0;i<outputs.size();i++){
+        if(outputs[i]->type == VP_LINK_AUDIO && outputs[i]->audioChannels > 0){
+            writeWavHeader(*outputs[i]);
+        }
+        if(outputs[i]->file.is_open()){
+            outputs[i]->file.close();
+        }
+        map<int,shared_ptr<PatchObject>>::iterator it = visualProgramming->patchObjects.find(outputs[i]->objectID);
+        if(it != visualProgramming->patchObjects.end()){
+            it->second->outletsExternalMask &= ~(1u << outputs[i]->outletID);
+        }
+    }
+    outputs.clear();
+
+    ofxVPAudioClock::get().setOffline(false);
+    ofSetTimeModeSystem();
+
+    ofLog(OF_LOG_NOTICE,"OfflineRenderer: %i frames rendered (%.2f s)",frame,getTime());
+}
@@ -0,0 +1,96 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxVisualProgramming.h"
+
+// one dumped outlet
+struct OfflineRenderOutput {
+    int             objectID;
+    int             outletID;
+    int             type;           // LINK_TYPE of the outlet
+    string          path;           // base path, the extension is added by type
+    ofFile          file;           // csv data / wav audio
+    ofPixels        pixels;         // texture readback
+    uint32_t        audioSamples;   // samples written to the wav
+    int             audioChannels;
+    uint64_t        lastAudioBlock; // audio outlets are written once per processed block
+};
+
+// Runs a patch without a display loop: fixed timestep, faster than real time,
+// audio pulled from the pdsp engine through a null stream (no sound card),
+// chosen outlets dumped to disk every frame (png sequence, wav, csv).
+//
+// The host still needs a GL context for the texture objects: create the main
+// window hidden (ofGLFWWindowSettings::visible = false) on a software GL
+// driver (ex. Mesa llvmpipe with LIBGL_ALWAYS_SOFTWARE=1 on a virtual framebuffer),
+// see example_offlineRender.
+class OfflineRenderer {
+
+public:
+
+    OfflineRenderer();
+    ~OfflineRenderer();
+
+    // vp must have been set headless before its setup()
+    bool            setup(ofxVisualProgramming *vp, const string &patchFile, float fps);
+    // dump outlet 'outletID' of object 'objectID', path without extension
+    bool            addOutput(int objectID, int outletID, const string &path);
+
+    // one video frame: the audio blocks covering it, then a patch update and draw.
+    // Call it from the app draw(), with the GL context ready
+    void            step();
+    void            close();
+
+    int             getFrame() const { return frame; }
+    double          getTime() const { return frame/fps; }
+
+protected:
+
+    void            processAudio();
+    void            writeOutputs(bool audioOnly);
+    void            writeWavHeader(OfflineRenderOutput &out);
+
+    ofxVisualProgramming        *visualProgramming;
+    vector<shared_ptr<OfflineRenderOutput>> outputs;
+
+    ofSoundBuffer               nullOutput;
+    double                      samplesDue;
+    uint64_t                    audioBlocks;
+    float                       fps;
+    int                         frame;
+    bool                        isOpen;
+
+};
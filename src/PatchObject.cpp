@@ -32,6 +32,11 @@
 
 #include "PatchObject.h"
 
+#include "audioClock.h"
+
+bool PatchObject::headless = false;
+bool PatchObject::renderOnDemand = false;
+
 //--------------------------------------------------------------
 PatchObject::PatchObject(const std::string& _customUID ) : ofxVPHasUID(_customUID) {
     nId                 = -1;
@@ -57,6 +62,10 @@ PatchObject::PatchObject(const std::string& _customUID ) : ofxVPHasUID(_customUI
     isAudioOUTObject        = false;
     isPDSPPatchableObject   = false;
     isTextureObject         = false;
+    tracksOutletChanges     = false;
+    lastAudioSamples        = 0;
+    customVarsVersion       = 0;
+    lastInputsVersion       = 0;
     isResizable             = false;
     willErase               = false;
 
@@ -75,11 +84,120 @@ PatchObject::PatchObject(const std::string& _customUID ) : ofxVPHasUID(_customUI
     output_width        = 320;
     output_height       = 240;
 
+    for(int i=0;i<MAX_INLETS;i++){
+        _inletParams[i] = nullptr;
+        _inletTimes[i] = 0.0;
+        _inletVersions[i] = 0;
+        _ownedInlets[i] = nullptr;
+    }
+    for(int i=0;i<MAX_OUTLETS;i++){
+        _outletParams[i] = nullptr;
+        _outletTimes[i] = 0.0;
+        _outletVersions[i] = 0;
+        _lastOutletParams[i] = nullptr;
+        _ownedOutlets[i] = nullptr;
+    }
+    outletsConnectedMask = 0;
+    outletsExternalMask = 0;
+    objectReady = true;
+
 }
 
 //--------------------------------------------------------------
 PatchObject::~PatchObject(){
+    // links pointing to these buffers are gone with the object, the pool keeps them alive a few more frames anyway
+    for(int i=0;i<MAX_INLETS;i++){
+        ofxVPPortBufferPool::get().release(_ownedInlets[i]);
+    }
+    for(int i=0;i<MAX_OUTLETS;i++){
+        ofxVPPortBufferPool::get().release(_ownedOutlets[i]);
+    }
+}
+
+//--------------------------------------------------------------
+void PatchObject::resetInlet(int iid){
+    _inletVersions[iid] = 0;
+    // numeric inlets keep their last value
+    switch(getInletType(iid)){
+        case VP_LINK_STRING:
+            resetInletBuffer<string>(iid);
+            break;
+        case VP_LINK_ARRAY:
+            resetInletBuffer<vector<float>>(iid);
+            break;
+        case VP_LINK_PIXELS:
+            resetInletBuffer<ofPixels>(iid);
+            break;
+        case VP_LINK_TEXTURE:
+            resetInletBuffer<ofTexture>(iid);
+            break;
+        case VP_LINK_AUDIO:
+            resetInletBuffer<ofSoundBuffer>(iid);
+            break;
+        case VP_LINK_SPECIAL:
+            // never left pointing to the reference of another (maybe deleted) object
+            _inletParams[iid] = _ownedInlets[iid];
+            break;
+        default:
+            break;
+    }
+}
+
+//--------------------------------------------------------------
+size_t PatchObject::getPortBuffersMemory() const{
+    size_t bytes = 0;
+    for(int i=0;i<MAX_INLETS;i++){
+        bytes += ofxVPPortBufferPool::get().getBytes(_ownedInlets[i]);
+    }
+    for(int i=0;i<MAX_OUTLETS;i++){
+        bytes += ofxVPPortBufferPool::get().getBytes(_ownedOutlets[i]);
+    }
+    return bytes;
+}
+
+//--------------------------------------------------------------
+bool PatchObject::outletContentChanged(int oid, const void *data, size_t bytes){
+    // too big to compare every frame, always a change
+    if(bytes > MAX_OUTLET_SNAPSHOT_BYTES){
+        _outletSnapshots[oid].clear();
+        return true;
+    }
+    vector<char> &snapshot = _outletSnapshots[oid];
+    if(snapshot.size() == bytes && (bytes == 0 || memcmp(snapshot.data(),data,bytes) == 0)){
+        return false;
+    }
+    snapshot.assign(static_cast<const char *>(data),static_cast<const char *>(data)+bytes);
+    return true;
+}
+
+//--------------------------------------------------------------
+bool PatchObject::inputsChanged(){
+    // the inlet pointers too: numeric values, and a relink to another outlet with the same version
+    uint64_t version = customVarsVersion + 1;
+    for(int i=0;i<getNumInlets();i++){
+        bool connected = i < static_cast<int>(inletsConnected.size()) && inletsConnected[i];
+        version = version*31 + (connected ? _inletVersions[i]+1 : 0);
+        version = version*31 + static_cast<uint64_t>(reinterpret_cast<uintptr_t>(_inletParams[i]));
+    }
+    if(version == lastInputsVersion){
+        return false;
+    }
+    lastInputsVersion = version;
+    return true;
+}
 
+//--------------------------------------------------------------
+uint64_t PatchObject::getContentVersion(){
+    // combined, not summed: relinking an inlet to another outlet changes it too
+    uint64_t version = 0;
+    for(int i=0;i<getNumInlets();i++){
+        bool connected = i < static_cast<int>(inletsConnected.size()) && inletsConnected[i];
+        version = version*31 + (connected ? _inletVersions[i]+1 : 0);
+    }
+    for(int i=0;i<getNumOutlets();i++){
+        version = version*31 + _outletVersions[i];
+    }
+    return version;
 }
 
 //--------------------------------------------------------------
@@ -135,17 +253,69 @@ void PatchObject::update(map<int,shared_ptr<PatchObject>> &patchObjects, pdsp::E
 
     if(willErase) return;
 
+    // content versions of what the object sent last frame, string and array contents are
+    // compared only in render on demand mode, otherwise they are a change every frame
+    const bool compareContents = isRenderOnDemand();
+    uint64_t audioSamples = ofxVPAudioClock::get().getSampleCount();
+    for(int out=0;out<getNumOutlets();out++){
+        bool changed = _outletParams[out] != _lastOutletParams[out];
+        if(_outletParams[out] != nullptr){
+            switch(outletsType[out]){
+                case VP_LINK_NUMERIC:
+                    break;
+                case VP_LINK_STRING:{
+                    if(!compareContents){
+                        _outletSnapshots[out].clear();
+                        changed = true;
+                        break;
+                    }
+                    const string *str = static_cast<string *>(_outletParams[out]);
+                    changed |= outletContentChanged(out,str->data(),str->size());
+                    break;
+                }
+                case VP_LINK_ARRAY:{
+                    if(!compareContents){
+                        _outletSnapshots[out].clear();
+                        changed = true;
+                        break;
+                    }
+                    const vector<float> *data = static_cast<vector<float> *>(_outletParams[out]);
+                    changed |= outletContentChanged(out,data->data(),data->size()*sizeof(float));
+                    break;
+                }
+                case VP_LINK_AUDIO:
+                    // written by the audio thread, every processed block is new content
+                    changed |= audioSamples != lastAudioSamples;
+                    break;
+                default:
+                    changed |= !tracksOutletChanges;
+                    break;
+            }
+        }
+        if(changed){
+            _lastOutletParams[out] = _outletParams[out];
+            _outletVersions[out]++;
+        }
+    }
+    lastAudioSamples = audioSamples;
+
     // update links
+    uint32_t connectedMask = outletsExternalMask;
     for(int out=0;out<getNumOutlets();out++){
         for(int i=0;i<static_cast<int>(outPut.size());i++){
             if(!outPut[i]->isDisabled && outPut[i]->fromOutletID == out && patchObjects[outPut[i]->toObjectID]!=nullptr && !patchObjects[outPut[i]->toObjectID]->getWillErase()){
+                connectedMask |= 1u << out;
                 outPut[i]->posFrom = getOutletPosition(out);
                 outPut[i]->posTo = patchObjects[outPut[i]->toObjectID]->getInletPosition(outPut[i]->toInletID);
                 // send data through links
                 patchObjects[outPut[i]->toObjectID]->_inletParams[outPut[i]->toInletID] = _outletParams[out];
+                patchObjects[outPut[i]->toObjectID]->_inletTimes[outPut[i]->toInletID] = _outletTimes[out];
+                patchObjects[outPut[i]->toObjectID]->_inletVersions[outPut[i]->toInletID] = _outletVersions[out];
             }
         }
     }
+    outletsConnectedMask.store(connectedMask,std::memory_order_relaxed);
+
     updateObjectContent(patchObjects);
 
     if(this->isPDSPPatchableObject){
@@ -159,8 +329,22 @@ void PatchObject::draw(ofTrueTypeFont *font){
 
     if(willErase) return;
 
-    // Draw the specific object content ()
+    // Draw the specific object content (), previews thumbnails refreshed when their port changes
+    NodePreviewBatch &previews = getNodePreviewBatch();
+    previews.beginObject(nId,getContentVersion());
+    for(int i=0;i<getNumInlets();i++){
+        bool connected = i < static_cast<int>(inletsConnected.size()) && inletsConnected[i];
+        if(connected && getInletType(i) == VP_LINK_TEXTURE && _inletParams[i] != nullptr){
+            previews.setPortVersion(static_cast<ofTexture *>(_inletParams[i])->getTextureData().textureID,_inletVersions[i]);
+        }
+    }
+    for(int i=0;i<getNumOutlets();i++){
+        if(getOutletType(i) == VP_LINK_TEXTURE && _outletParams[i] != nullptr){
+            previews.setPortVersion(static_cast<ofTexture *>(_outletParams[i])->getTextureData().textureID,_outletVersions[i]);
+        }
+    }
     drawObjectContent(font,(shared_ptr<ofBaseGLRenderer>&)ofGetCurrentRenderer());
+    previews.endObject();
 
 }
 
@@ -193,13 +377,17 @@ void PatchObject::drawImGuiNode(ImGuiEx::NodeCanvas& _nodeCanvas, map<int,shared
             ofNotifyEvent(duplicateEvent, nId);
         }
 
+        // Inlets link data is only used to re-connect (drag from a connected inlet) or drop on an inlet,
+        // so skip the search over all the patch objects when the left mouse button is not in use
+        const bool needsInletsLinks = ImGui::GetIO().MouseDown[0] || ImGui::GetIO().MouseReleased[0];
+
         // Inlets
         for(int i=0;i<static_cast<int>(inletsType.size());i++){
             auto pinCol = getInletColor(i);
             vector<ImGuiEx::ofxVPLinkData> tempLinkData;
 
             // if connected, get link origin (outlet origin position and link id)
-            if(inletsConnected[i]){
+            if(inletsConnected[i] && needsInletsLinks){
                 for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
                     for(int j=0;j<static_cast<int>(it->second->outPut.size());j++){
                         if(it->second->outPut[j]->toObjectID == nId && it->second->outPut[j]->toInletID == i){
@@ -378,17 +566,17 @@ bool PatchObject::connectTo(map<int,shared_ptr<PatchObject>> &patchObjects, int
         inletsConnected[toInlet] = true;
 
         if(tempLink->type == VP_LINK_NUMERIC){
-            _inletParams[toInlet] = new float();
+            _inletParams[toInlet] = nullptr;
         }else if(tempLink->type == VP_LINK_STRING){
-            _inletParams[toInlet] = new string();
+            resetInletBuffer<string>(toInlet);
         }else if(tempLink->type == VP_LINK_ARRAY){
-            _inletParams[toInlet] = new vector<float>();
+            resetInletBuffer<vector<float>>(toInlet);
         }else if(tempLink->type == VP_LINK_PIXELS){
-            _inletParams[toInlet] = new ofPixels();
+            resetInletBuffer<ofPixels>(toInlet);
         }else if(tempLink->type == VP_LINK_TEXTURE){
-            _inletParams[toInlet] = new ofTexture();
+            resetInletBuffer<ofTexture>(toInlet);
         }else if(tempLink->type == VP_LINK_AUDIO){
-            _inletParams[toInlet] = new ofSoundBuffer();
+            resetInletBuffer<ofSoundBuffer>(toInlet);
             if(patchObjects[fromObjectID]->getIsPDSPPatchableObject() && getIsPDSPPatchableObject()){
                 patchObjects[fromObjectID]->pdspOut[fromOutlet] >> pdspIn[toInlet];
             }else if(patchObjects[fromObjectID]->getName() == "audio device" && getIsPDSPPatchableObject()){
@@ -439,6 +627,7 @@ void PatchObject::disconnectFrom(map<int,shared_ptr<PatchObject>> &patchObjects,
                     }else{
                         it->second->removeLinkFromConfig(it->second->outPut[s]->fromOutletID,it->second->outPut[s]->toObjectID,it->second->outPut[s]->toInletID);
                         this->inletsConnected[objectInlet] = false;
+                        this->resetInlet(objectInlet);
                         if(this->getIsPDSPPatchableObject()){
                             this->pdspIn[objectInlet].disconnectIn();
                         }
@@ -481,6 +670,7 @@ void PatchObject::disconnectLink(map<int,shared_ptr<PatchObject>> &patchObjects,
                         it->second->removeLinkFromConfig(it->second->outPut[s]->fromOutletID,it->second->outPut[s]->toObjectID,it->second->outPut[s]->toInletID);
                         if(patchObjects[it->second->outPut[j]->toObjectID] != nullptr){
                             patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                            patchObjects[it->second->outPut[j]->toObjectID]->resetInlet(it->second->outPut[j]->toInletID);
                             if(patchObjects[it->second->outPut[j]->toObjectID]->getIsPDSPPatchableObject()){
                                 patchObjects[it->second->outPut[j]->toObjectID]->pdspIn[it->second->outPut[j]->toInletID].disconnectIn();
                             }
@@ -42,6 +42,8 @@
 #include "objectFactory.h"
 #include "ofxVPHasUid.h"
 #include "ofxVPObjectParameter.h"
+#include "portBufferPool.h"
+#include "fboPool.h"
 
 #include "ofxImGui.h"
 #include "imgui_node_canvas.h"
@@ -49,16 +51,6 @@
 
 #include "Driver.h"
 
-enum LINK_TYPE {
-    VP_LINK_NUMERIC,
-    VP_LINK_STRING,
-    VP_LINK_ARRAY,
-    VP_LINK_TEXTURE,
-    VP_LINK_AUDIO,
-    VP_LINK_SPECIAL,
-    VP_LINK_PIXELS
-};
-
 struct PatchLink{
     ImVec2                  posFrom;
     ImVec2                  posTo;
@@ -129,8 +121,39 @@ public:
 
     void                    addInlet(int type,string name) { inletsType.push_back(type);inletsNames.push_back(name); inletsPositions.push_back( ImVec2(this->x, this->y + this->height*.5f) ); }
     void                    addOutlet(int type,string name = "") { outletsType.push_back(type);outletsNames.push_back(name); outletsPositions.push_back( ImVec2( this->x + this->width, this->y + this->height*.5f) ); }
+
+    // inlet/outlet buffers, owned by ofxVPPortBufferPool: a replaced buffer goes back to the pool,
+    // the object gives back its own ones when destroyed. Numeric ports store the value in the
+    // pointer itself (*(float *)&_outletParams[i]) and need no buffer
+    template<typename T, typename... Args>
+    T*                      newInletBuffer(int iid, Args&&... args);
+    template<typename T, typename... Args>
+    T*                      newOutletBuffer(int oid, Args&&... args);
+    // inlet back on its own buffer, reset as new (after a link pointed it to an outlet)
+    template<typename T>
+    T*                      resetInletBuffer(int iid);
+    // after a disconnection: the inlet stops aliasing the outlet it was linked to
+    void                    resetInlet(int iid);
+    // outlet sending a buffer owned elsewhere, with no copy (the owner keeps it untouched for one
+    // more frame, links refresh their pointers every frame); nullptr goes back to the outlet own buffer
+    void                    shareOutletBuffer(int oid, void *buffer) { _outletParams[oid] = buffer != nullptr ? buffer : _ownedOutlets[oid]; }
+    // content versions, for consumers redrawing only on change (render on demand). update() detects a
+    // changed outlet pointer or numeric value, a changed string/array content and a new audio block.
+    // Texture, pixels and special outlets can't be compared: they count as changed on every frame,
+    // unless the object tracks its writes itself with markOutletChanged()
+    void                    setTracksOutletChanges(bool t) { tracksOutletChanges = t; }
+    void                    markOutletChanged(int oid) { _outletVersions[oid]++; }
+    // true if a linked inlet, an inlet value or a custom var changed since the previous call (call it
+    // once per frame), for tracking objects whose outlets change only with their inputs
+    bool                    inputsChanged();
+    // changes when any outlet or linked inlet changed
+    uint64_t                getContentVersion();
+    // true if data differs from the last snapshot of the outlet, which is replaced
+    bool                    outletContentChanged(int oid, const void *data, size_t bytes);
+    // memory of the buffers owned by this object
+    size_t                  getPortBuffersMemory() const;
     void                    initInletsState() { for(int i=0;i<numInlets;i++){ inletsConnected.push_back(false); } }
-    void                    setCustomVar(float value, string name){ customVars[name] = value; saveConfig(false); }
+    void                    setCustomVar(float value, string name){ if(customVars.find(name) == customVars.end() || customVars[name] != value){ customVarsVersion++; } customVars[name] = value; saveConfig(false); }
     float                   getCustomVar(string name) { if ( customVars.find(name) != customVars.end() ) { return customVars[name]; }else{ return 0; } }
     float                   existsCustomVar(string name) { if ( customVars.find(name) != customVars.end() ) { return true; }else{ return false; } }
     void                    substituteCustomVar(string oldName, string newName) { if ( customVars.find(oldName) != customVars.end() ) { customVars[newName] = customVars[oldName]; customVars.erase(oldName); } }
@@ -161,7 +184,11 @@ public:
     int                     getNumInlets() { return inletsType.size(); }
     int                     getNumOutlets() { return outletsType.size(); }
     bool                    getIsOutletConnected(int oid);
+    // audio thread safe version, the mask is refreshed once per frame in update()
+    bool                    getIsOutletConnectedDSP(int oid) const { return (outletsConnectedMask.load(std::memory_order_relaxed) >> oid) & 1u; }
     bool                    getWillErase() { return willErase; }
+    // resources (files, windows, threads) usable, see setIsReady()
+    bool                    getIsReady() const { return objectReady.load(std::memory_order_acquire); }
 
     float                   getObjectWidth() { return width; }
     float                   getObjectHeight() { return height; }
@@ -169,7 +196,7 @@ public:
     int                     getOutputHeight() { return output_height; }
     float                   getConfigmenuWidth() { return configMenuWidth; }
 
-    string                  getFilepath() { return filepath; }
+    const string&           getFilepath() { return filepath; }
 
     // SETTERS
     void                    setName(string _name) { name = _name; }
@@ -182,10 +209,25 @@ public:
     void                    setIsRetina(bool ir) { isRetina = ir; if(isRetina) scaleFactor = 2.0f; }
     void                    setIsActive(bool ia) { bActive = ia; }
     void                    setWillErase(bool e) { willErase = e; }
+    // objects building resources asynchronously call setIsReady(false) when they start
+    // and setIsReady(true) once done: the patch loader and the links waiting on them
+    // proceed at that moment (ofxVisualProgramming::isPatchReady())
+    void                    setIsReady(bool r) { objectReady.store(r,std::memory_order_release); }
     void                    setIsObjectSelected(bool s) { isObjectSelected = s; }
     void                    setConfigmenuWidth(float cmw) { configMenuWidth = cmw; }
     void                    setSubpatch(string sp) { subpatchName = sp; }
 
+    // headless (offline render) mode, objects must not show windows nor open devices
+    static void             setHeadless(bool h) { headless = h; }
+    static bool             isHeadless() { return headless; }
+
+    // render on demand mode (ofxVisualProgramming::setRenderOnDemand()), windows redraw only on change
+    static void             setRenderOnDemand(bool r) { renderOnDemand = r; }
+    static bool             isRenderOnDemand() { return renderOnDemand; }
+
+    static bool             headless;
+    static bool             renderOnDemand;
+
     // PUGG Plugin System
     static const int version = 1;
     static const std::string server_name() {return "PatchObjectServer";}
@@ -202,6 +244,17 @@ public:
     // inlets/outlets
     void                                *_inletParams[MAX_INLETS];
     void                                *_outletParams[MAX_OUTLETS];
+    // one bit per connected outlet (MAX_OUTLETS <= 32), read by audioInObject()/audioOutObject() to skip unused outlets
+    std::atomic<uint32_t>               outletsConnectedMask;
+    std::atomic<bool>                   objectReady;
+    // outlets read from outside the patch (ex. OfflineRenderer), always considered connected
+    uint32_t                            outletsExternalMask;
+    // audio clock time (ofxVPAudioClock) of the last event sent/received through each outlet/inlet
+    double                              _outletTimes[MAX_OUTLETS];
+    double                              _inletTimes[MAX_INLETS];
+    // content version of each outlet, and of the outlet linked to each inlet (see markOutletChanged())
+    uint64_t                            _outletVersions[MAX_OUTLETS];
+    uint64_t                            _inletVersions[MAX_INLETS];
 
     // PDSP nodes
     map<int,pdsp::PatchNode>            pdspIn;
@@ -240,6 +293,9 @@ protected:
     vector<int>             inletsType;
     vector<int>             outletsType;
     map<string,float>       customVars;
+    // buffers from newInletBuffer()/newOutletBuffer(), _inletParams may point elsewhere while linked
+    void                    *_ownedInlets[MAX_INLETS];
+    void                    *_ownedOutlets[MAX_OUTLETS];
 
 
     int                     numInlets;
@@ -255,11 +311,50 @@ protected:
     bool                    isAudioOUTObject;
     bool                    isPDSPPatchableObject;
     bool                    isTextureObject;
+    bool                    tracksOutletChanges;
+    void                    *_lastOutletParams[MAX_OUTLETS];
+    // last sent content of the string/array outlets, and audio clock at the last update()
+    vector<char>            _outletSnapshots[MAX_OUTLETS];
+    uint64_t                lastAudioSamples;
+    uint64_t                customVarsVersion;
+    uint64_t                lastInputsVersion;
     bool                    isResizable;
     bool                    willErase;
 
 };
 
+//--------------------------------------------------------------
+template<typename T, typename... Args>
+T* PatchObject::newInletBuffer(int iid, Args&&... args){
+    T *buffer = ofxVPPortBufferPool::get().acquire<T>(std::forward<Args>(args)...);
+    ofxVPPortBufferPool::get().release(_ownedInlets[iid]);
+    _ownedInlets[iid] = buffer;
+    _inletParams[iid] = buffer;
+    return buffer;
+}
+
+//--------------------------------------------------------------
+template<typename T, typename... Args>
+T* PatchObject::newOutletBuffer(int oid, Args&&... args){
+    T *buffer = ofxVPPortBufferPool::get().acquire<T>(std::forward<Args>(args)...);
+    ofxVPPortBufferPool::get().release(_ownedOutlets[oid]);
+    _ownedOutlets[oid] = buffer;
+    _outletParams[oid] = buffer;
+    return buffer;
+}
+
+//--------------------------------------------------------------
+template<typename T>
+T* PatchObject::resetInletBuffer(int iid){
+    if(_ownedInlets[iid] != nullptr && ofxVPPortBufferPool::get().holds<T>(_ownedInlets[iid])){
+        T *buffer = static_cast<T *>(_ownedInlets[iid]);
+        ofxVPPortBufferTraits<T>::recycle(*buffer);
+        _inletParams[iid] = buffer;
+        return buffer;
+    }
+    return newInletBuffer<T>(iid);
+}
+
 // PUGG driver class
 class PatchObjectDriver : public pugg::Driver
 {
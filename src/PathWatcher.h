@@ -25,11 +25,113 @@
 #include <string>
 #include <vector>
 #include <queue>
+#include <set>
+#include <map>
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
 #include <sys/stat.h>
+#ifdef _WIN32
+	#include <io.h>
+#else
+	#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+	#include <poll.h>
+	#include <sys/inotify.h>
+	#define PATHWATCHER_USE_INOTIFY
+#endif
+
+class PathWatcher;
+
+/// \class PathWatchService
+/// \brief process wide backend shared by all PathWatcher instances
+///
+/// runs a single thread for every watcher in the process: on Linux the
+/// parent directories of the watched paths are registered with inotify and
+/// changes are dispatched as soon as the kernel reports them, everywhere
+/// else (or if inotify is not available) the thread stats the paths of each
+/// watcher at the interval requested in PathWatcher::start()
+///
+/// not meant to be used directly, see PathWatcher
+class PathWatchService {
+
+	public:
+
+		/// the shared instance, intentionally never destroyed so watchers
+		/// living in other static objects can still unsubscribe at exit
+		static PathWatchService& instance() {
+			static PathWatchService *service = new PathWatchService();
+			return *service;
+		}
+
+		/// add a watcher to the dispatch list, starts the thread if needed
+		inline void subscribe(PathWatcher *watcher, unsigned int sleep);
+
+		/// remove a watcher, no events are dispatched to it once this returns
+		inline void unsubscribe(PathWatcher *watcher);
+
+		/// ref counted directory registration
+		inline void watchDirectory(const std::string &dir);
+		inline void releaseDirectory(const std::string &dir);
+
+		/// true if changes are reported by the OS instead of polling
+		bool isNotifying() {return notifyFd >= 0;}
+
+	protected:
+
+		PathWatchService() {
+			running = false;
+		#ifdef PATHWATCHER_USE_INOTIFY
+			notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		#endif
+		}
+
+		/// per watcher polling schedule, only used by the fallback
+		struct Subscriber {
+			unsigned int sleep = 500;
+			std::chrono::steady_clock::time_point next;
+		};
+
+		/// a watched directory, wd is -1 while it can't be watched (yet)
+		struct Directory {
+			int refs = 0;
+			int wd = -1;
+		};
+
+		inline void threadedFunction();
+		inline void readNotifications();
+		inline bool retryDirectories();
+		inline void pollSubscribers(bool force);
+
+		std::map<PathWatcher*,Subscriber> subscribers; //< dispatch list
+		std::map<std::string,Directory> directories;   //< watched dirs by path
+		std::map<int,std::string> descriptors;         //< watched dirs by wd
+
+		int notifyFd = -1;             //< inotify instance or -1 when polling
+		std::atomic<bool> running;     //< is the thread running?
+		std::thread *thread = nullptr; //< thread
+		std::mutex mutex;              //< subscribers & directories mutex
+
+		/// inotify events we care about, modifications are only reported
+		/// once the writer closes the file
+		static const unsigned int NOTIFY_MASK =
+		#ifdef PATHWATCHER_USE_INOTIFY
+			IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_DELETE_SELF |
+			IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF;
+		#else
+			0;
+		#endif
+
+		static const unsigned int TICK = 50;   //< fallback thread tick in ms
+		static const unsigned int RETRY = 1000; //< retry failed watches every ms
+};
 
 /// \class PathWatcher
 /// \brief watch file and directory paths for modifications
@@ -38,6 +140,10 @@
 ///
 /// can be used with a callback or via an event queue
 ///
+/// all the started watchers share one background thread (see
+/// PathWatchService), on Linux changes are reported by inotify within a few
+/// ms, otherwise the paths are polled every start() sleep interval
+///
 /// Example queue/poll usage:
 ///
 ///     PathWatcher watcher;
@@ -73,7 +179,7 @@
 ///
 ///     PathWatcher watcher;
 ///
-///     // start the thread, otherwise call update() to check manually
+///     // subscribe to the shared watch thread, otherwise call update() to check manually
 ///    	watcher.start();
 ///
 ///     ...
@@ -107,13 +213,13 @@
 ///     // add a path to watch
 ///	    watcher.addPath("test.txt");
 ///
-///     // start the thread
+///     // subscribe to the shared watch thread
 ///    	watcher.start();
 ///
 ///     // set callback as a function pointer or lambda
 ///     watcher.setCallback([](const PathWatcher::Event &event) {
 ///
-///         // this is called within the watcher's thread, so you will need
+///         // this is called within the watch thread, so you will need
 ///         // to protect any shared resources with a mutex or atomics
 ///
 ///         switch(event.change) {
@@ -133,6 +239,8 @@
 ///
 class PathWatcher {
 
+	friend class PathWatchService;
+
 	public:
 
 		PathWatcher() {
@@ -146,6 +254,7 @@ class PathWatcher {
 		/// add a path to watch, full or relative to current directory
 		/// optionally set contextual name
 		void addPath(const std::string &path, const std::string &name="") {
+			std::vector<std::string> dirs;
 			mutex.lock();
 			std::vector<Path>::iterator iter = std::find_if(paths.begin(), paths.end(),
 				[&path](Path const &p) {
@@ -154,12 +263,15 @@ class PathWatcher {
 			);
 			if(iter == paths.end()) {
 				paths.push_back(Path(path, name));
+				dirs = paths.back().directories();
 			}
 			mutex.unlock();
+			watchDirectories(dirs);
 		}
 
 		/// remove a watched path
 		void removePath(const std::string &path) {
+			std::vector<std::string> dirs;
 			mutex.lock();
 			std::vector<Path>::iterator iter = std::find_if(paths.begin(), paths.end(),
 				[&path](Path const &p) {
@@ -167,13 +279,16 @@ class PathWatcher {
 				}
 			);
 			if(iter != paths.end()) {
+				dirs = iter->directories();
 				paths.erase(iter);
 			}
 			mutex.unlock();
+			releaseDirectories(dirs);
 		}
 	
 		/// remove a watched path by name
 		void removePathByName(const std::string &name) {
+			std::vector<std::string> dirs;
 			mutex.lock();
 			std::vector<Path>::iterator iter = std::find_if(paths.begin(), paths.end(),
 				[&name](Path const &p) {
@@ -181,16 +296,24 @@ class PathWatcher {
 				}
 			);
 			if(iter != paths.end()) {
+				dirs = iter->directories();
 				paths.erase(iter);
 			}
 			mutex.unlock();
+			releaseDirectories(dirs);
 		}
 
 		/// remove all watched paths
 		void removeAllPaths() {
+			std::vector<std::string> dirs;
 			mutex.lock();
+			for(const Path &path : paths) {
+				std::vector<std::string> d = path.directories();
+				dirs.insert(dirs.end(), d.begin(), d.end());
+			}
 			paths.clear();
 			mutex.unlock();
+			releaseDirectories(dirs);
 		}
 	
 		/// does a path exist?
@@ -218,32 +341,20 @@ class PathWatcher {
 		/// manually check for changes, returns true if a change was detected
 		/// pushes change onto the queue or calls callback function if set
 		bool update() {
+			std::lock_guard<std::mutex> lock(mutex);
 			bool changed = false;
-			mutex.lock();
 			auto iter = paths.begin();
 			while(iter != paths.end()) {
-				Path &path = (*iter);
-				ChangeType change = path.changed();
+				ChangeType change = iter->changed();
 				if(change != NONE) {
 					changed = true;
-					Event event;
-					event.change = change;
-					event.path = path.path;
-					event.name = path.name;
-					if(callback) {
-						callback(event);
-					}
-					else {
-						queue.push(event);
-					}
-					if(change == DELETED && removeDeleted) {
-						paths.erase(iter);
+					if(dispatch(*iter, change)) {
+						iter = paths.erase(iter);
 						continue;
 					}
 				}
 				iter++;
 			}
-			mutex.unlock();
 			return changed;
 		}
 	
@@ -254,20 +365,27 @@ class PathWatcher {
 	
 		/// manually remove any deleted or non-existing paths
 		void removeDeletedPaths() {
+			std::vector<std::string> dirs;
+			mutex.lock();
 			auto iter = paths.begin();
 			while(iter != paths.end()) {
-				Path &path = (*iter);
-				if(!path.exists) {
-					paths.erase(iter);
+				if(!iter->exists) {
+					std::vector<std::string> d = iter->directories();
+					dirs.insert(dirs.end(), d.begin(), d.end());
+					iter = paths.erase(iter);
+					continue;
 				}
 				iter++;
 			}
+			mutex.unlock();
+			releaseDirectories(dirs);
 		}
 	
 	/// \section Event Queue
 	
 		/// returns true if there are any waiting events
 		bool waitingEvents() {
+			std::lock_guard<std::mutex> lock(mutex);
 			return !queue.empty();
 		}
 	
@@ -289,7 +407,7 @@ class PathWatcher {
 	
 		/// set optional callback to receive change events
 		///
-		/// called within the watcher's thread, so you will need
+		/// called within the shared watch thread, so you will need
 		/// to protect any shared resources with a mutex or atomics
 		///
 		/// function:
@@ -336,31 +454,45 @@ class PathWatcher {
 			mutex.unlock();
 		}
 	
-		/// start a background thread to automatically check for changes,
-		/// sleep sets how often to check in ms
+		/// subscribe to the shared watch thread to automatically check for
+		/// changes, sleep sets how often to check in ms when the OS can't
+		/// notify changes (ignored with inotify)
 		void start(unsigned int sleep=500) {
 			if(!running) {
 				running = true;
-				thread = new std::thread([this,sleep]{
-					while(running) {
-						update();
-						std::this_thread::sleep_for(std::chrono::milliseconds(sleep));
-					}
-				});
+				std::vector<std::string> dirs;
+				mutex.lock();
+				for(const Path &path : paths) {
+					std::vector<std::string> d = path.directories();
+					dirs.insert(dirs.end(), d.begin(), d.end());
+				}
+				mutex.unlock();
+				for(const std::string &dir : dirs) {
+					PathWatchService::instance().watchDirectory(dir);
+				}
+				PathWatchService::instance().subscribe(this, sleep);
 			}
 		}
 
-		/// stop the background thread
+		/// unsubscribe from the shared watch thread
 		void stop() {
 			if(running) {
+				PathWatchService::instance().unsubscribe(this);
+				std::vector<std::string> dirs;
+				mutex.lock();
+				for(const Path &path : paths) {
+					std::vector<std::string> d = path.directories();
+					dirs.insert(dirs.end(), d.begin(), d.end());
+				}
+				mutex.unlock();
+				for(const std::string &dir : dirs) {
+					PathWatchService::instance().releaseDirectory(dir);
+				}
 				running = false;
-				thread->join();
-				delete thread;
-				thread = nullptr;
 			}
 		}
 	
-		/// is the thread currently running?
+		/// is the watcher subscribed to the shared watch thread?
 		bool isRunning() {return running;}
 
 	protected:
@@ -372,13 +504,17 @@ class PathWatcher {
 			
 				std::string path;    //< relative or absolute path
 				std::string name;	 //< optional contextual name
+				std::string parent;  //< resolved parent directory
+				std::string resolved; //< resolved path, as reported by inotify
 				long modified = 0;   //< last modification st_mtime
 				bool exists = true;  //< does the path exist?
+				bool directory = false; //< is the path a directory?
 			
 				/// create a new Path to watch with optional name
 				Path(const std::string &path, const std::string &name="") {
 					this->path = path;
 					this->name = name;
+					resolve();
 					if(pathExists(path)) {
 						update();
 					}
@@ -386,6 +522,27 @@ class PathWatcher {
 						exists = false;
 					}
 				}
+
+				/// directories to register with the watch service
+				std::vector<std::string> directories() const {
+					std::vector<std::string> dirs;
+					dirs.push_back(parent);
+					if(directory) {
+						dirs.push_back(resolved);
+					}
+					return dirs;
+				}
+
+				/// does a notified path concern this path?
+				bool matches(const std::string &notified) const {
+					if(notified == resolved) {
+						return true;
+					}
+					// entries added/removed inside a watched directory
+					return directory && notified.size() > resolved.size() &&
+					       notified.compare(0, resolved.size(), resolved) == 0 &&
+					       notified[resolved.size()] == '/';
+				}
 			
 				/// returns detected change type or NONE
 				ChangeType changed() {
@@ -411,15 +568,114 @@ class PathWatcher {
 					}
 					return NONE;
 				}
+
+				/// change type after the OS reported an event on this path,
+				/// unlike changed() this doesn't depend on the st_mtime
+				/// resolution, so quick successive saves are not missed
+				ChangeType notified() {
+					ChangeType change = changed();
+					if(change == NONE && exists) {
+						change = MODIFIED;
+					}
+					return change;
+				}
 			
 				/// update modification time
 				void update() {
 					struct stat attributes;
 					stat(path.c_str(), &attributes);
 					modified = attributes.st_mtime;
+					directory = S_ISDIR(attributes.st_mode);
+				}
+
+			protected:
+
+				/// absolute parent directory with symlinks resolved, so it
+				/// matches the paths built from the inotify events (inotify
+				/// only, the stat fallback works on the given path)
+				void resolve() {
+					struct stat attributes;
+					directory = stat(path.c_str(), &attributes) == 0 && S_ISDIR(attributes.st_mode);
+				#ifdef PATHWATCHER_USE_INOTIFY
+					std::string absolute = path;
+					if(absolute.empty() || absolute[0] != '/') {
+						char cwd[PATH_MAX];
+						if(getcwd(cwd, PATH_MAX) != nullptr) {
+							absolute = std::string(cwd) + "/" + absolute;
+						}
+					}
+					while(absolute.size() > 1 && absolute.back() == '/') {
+						absolute.pop_back();
+					}
+					size_t slash = absolute.find_last_of('/');
+					parent = slash == 0 ? "/" : absolute.substr(0, slash);
+					std::string base = absolute.substr(slash+1);
+					char real[PATH_MAX];
+					if(realpath(parent.c_str(), real) != nullptr) {
+						parent = real;
+					}
+					resolved = (parent == "/" ? "" : parent) + "/" + base;
+				#else
+					resolved = path;
+				#endif
 				}
 		};
 
+		/// queue the event or call the callback, mutex must be locked,
+		/// returns true if the path should be removed
+		bool dispatch(const Path &path, ChangeType change) {
+			Event event;
+			event.change = change;
+			event.path = path.path;
+			event.name = path.name;
+			if(callback) {
+				callback(event);
+			}
+			else {
+				queue.push(event);
+			}
+			return change == DELETED && removeDeleted;
+		}
+
+		/// called by the watch service with the paths the OS reported
+		void notified(const std::set<std::string> &changed) {
+			std::lock_guard<std::mutex> lock(mutex);
+			auto iter = paths.begin();
+			while(iter != paths.end()) {
+				bool concerned = false;
+				for(const std::string &c : changed) {
+					if(iter->matches(c)) {
+						concerned = true;
+						break;
+					}
+				}
+				if(concerned) {
+					ChangeType change = iter->notified();
+					if(change != NONE && dispatch(*iter, change)) {
+						iter = paths.erase(iter);
+						continue;
+					}
+				}
+				iter++;
+			}
+		}
+
+		void watchDirectories(const std::vector<std::string> &dirs) {
+			if(running) {
+				for(const std::string &dir : dirs) {
+					PathWatchService::instance().watchDirectory(dir);
+				}
+			}
+		}
+
+		void releaseDirectories(const std::vector<std::string> &dirs) {
+			if(running) {
+				for(const std::string &dir : dirs) {
+					PathWatchService::instance().releaseDirectory(dir);
+				}
+			}
+		}
+
 		std::vector<Path> paths;         //< paths to watch
 		std::atomic<bool> removeDeleted; //< remove path when deleted?
 	
@@ -428,7 +684,177 @@ class PathWatcher {
 		/// change event callback function pointer
 		std::function<void(const PathWatcher::Event &event)> callback = nullptr;
 	
-		std::atomic<bool> running;     //< is the thread running?
-		std::thread *thread = nullptr; //< thread
-		std::mutex mutex;              //< thread data mutex
+		std::atomic<bool> running; //< subscribed to the watch service?
+		std::mutex mutex;          //< data mutex
 };
+
+// PathWatchService
+//--------------------------------------------------------------
+void PathWatchService::subscribe(PathWatcher *watcher, unsigned int sleep) {
+	std::lock_guard<std::mutex> lock(mutex);
+	Subscriber &s = subscribers[watcher];
+	s.sleep = sleep;
+	s.next = std::chrono::steady_clock::now() + std::chrono::milliseconds(sleep);
+	if(!running) {
+		running = true;
+		thread = new std::thread([this]{threadedFunction();});
+	}
+}
+
+//--------------------------------------------------------------
+void PathWatchService::unsubscribe(PathWatcher *watcher) {
+	// the thread dispatches with the mutex locked, so once we get it
+	// the watcher is guaranteed to not be in use anymore
+	std::lock_guard<std::mutex> lock(mutex);
+	subscribers.erase(watcher);
+}
+
+//--------------------------------------------------------------
+void PathWatchService::watchDirectory(const std::string &dir) {
+	std::lock_guard<std::mutex> lock(mutex);
+	Directory &d = directories[dir];
+	if(d.refs++ == 0) {
+	#ifdef PATHWATCHER_USE_INOTIFY
+		if(notifyFd >= 0) {
+			d.wd = inotify_add_watch(notifyFd, dir.c_str(), NOTIFY_MASK);
+			if(d.wd >= 0) {
+				descriptors[d.wd] = dir;
+			}
+		}
+	#endif
+	}
+}
+
+//--------------------------------------------------------------
+void PathWatchService::releaseDirectory(const std::string &dir) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto iter = directories.find(dir);
+	if(iter == directories.end()) {
+		return;
+	}
+	if(--iter->second.refs <= 0) {
+	#ifdef PATHWATCHER_USE_INOTIFY
+		int wd = iter->second.wd;
+		bool shared = false;
+		for(auto &d : directories) {
+			if(d.second.wd == wd && d.first != dir) {
+				// several paths can resolve to the same inode and so the same wd
+				descriptors[wd] = d.first;
+				shared = true;
+				break;
+			}
+		}
+		if(wd >= 0 && !shared) {
+			descriptors.erase(wd);
+			inotify_rm_watch(notifyFd, wd);
+		}
+	#endif
+		directories.erase(iter);
+	}
+}
+
+//--------------------------------------------------------------
+void PathWatchService::threadedFunction() {
+	auto nextRetry = std::chrono::steady_clock::now();
+	while(running) {
+	#ifdef PATHWATCHER_USE_INOTIFY
+		if(notifyFd >= 0) {
+			// the timeout only bounds how long a newly created directory
+			// waits before being watched
+			struct pollfd pfd;
+			pfd.fd = notifyFd;
+			pfd.events = POLLIN;
+			pfd.revents = 0;
+			if(::poll(&pfd, 1, RETRY) > 0 && (pfd.revents & POLLIN)) {
+				readNotifications();
+			}
+			auto now = std::chrono::steady_clock::now();
+			if(now >= nextRetry) {
+				nextRetry = now + std::chrono::milliseconds(RETRY);
+				if(retryDirectories()) {
+					// the directory appeared, catch up on whatever it contains
+					pollSubscribers(true);
+				}
+			}
+			continue;
+		}
+	#endif
+		pollSubscribers(false);
+		std::this_thread::sleep_for(std::chrono::milliseconds(TICK));
+	}
+}
+
+//--------------------------------------------------------------
+void PathWatchService::readNotifications() {
+#ifdef PATHWATCHER_USE_INOTIFY
+	alignas(struct inotify_event) char buffer[4096];
+	std::set<std::string> changed;
+	std::lock_guard<std::mutex> lock(mutex);
+	// drain everything that is pending so a save emitting several events
+	// (rename over, create + close write, ...) is reported once
+	for(;;) {
+		ssize_t length = read(notifyFd, buffer, sizeof(buffer));
+		if(length <= 0) {
+			break;
+		}
+		for(char *ptr = buffer; ptr < buffer + length; ) {
+			const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(ptr);
+			ptr += sizeof(struct inotify_event) + event->len;
+			auto iter = descriptors.find(event->wd);
+			if(iter == descriptors.end()) {
+				continue;
+			}
+			const std::string &dir = iter->second;
+			if(event->len > 0) {
+				changed.insert((dir == "/" ? "" : dir) + "/" + event->name);
+			}
+			else {
+				changed.insert(dir);
+			}
+			if(event->mask & IN_IGNORED) {
+				// directory removed, watch it again if it comes back
+				auto d = directories.find(dir);
+				if(d != directories.end()) {
+					d->second.wd = -1;
+				}
+				descriptors.erase(iter);
+			}
+		}
+	}
+	if(!changed.empty()) {
+		for(auto &s : subscribers) {
+			s.first->notified(changed);
+		}
+	}
+#endif
+}
+
+//--------------------------------------------------------------
+bool PathWatchService::retryDirectories() {
+	bool added = false;
+#ifdef PATHWATCHER_USE_INOTIFY
+	std::lock_guard<std::mutex> lock(mutex);
+	for(auto &d : directories) {
+		if(d.second.wd < 0) {
+			d.second.wd = inotify_add_watch(notifyFd, d.first.c_str(), NOTIFY_MASK);
+			if(d.second.wd >= 0) {
+				descriptors[d.second.wd] = d.first;
+				added = true;
+			}
+		}
+	}
+#endif
+	return added;
+}
+
+//--------------------------------------------------------------
+void PathWatchService::pollSubscribers(bool force) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto now = std::chrono::steady_clock::now();
+	for(auto &s : subscribers) {
+		if(force || now >= s.second.next) {
+			s.second.next = now + std::chrono::milliseconds(s.second.sleep);
+			s.first->update();
+		}
+	}
+}
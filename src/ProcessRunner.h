@@ -0,0 +1,320 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+#if !defined(TARGET_WIN32)
+
+#include "ofMain.h"
+#include <atomic>
+#include <deque>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+
+#define PROCESS_RUNNER_MAX_WORKERS      4
+#define PROCESS_RUNNER_KILL_GRACE_MS    250
+
+enum PROCESS_JOB_STATE {
+    PROCESS_JOB_QUEUED,
+    PROCESS_JOB_RUNNING,
+    PROCESS_JOB_FINISHED,   // exited, see getExitStatus()
+    PROCESS_JOB_FAILED,     // could not be spawned
+    PROCESS_JOB_TIMEOUT,    // killed after its timeout
+    PROCESS_JOB_CANCELLED   // killed by cancel()
+};
+
+/// \class ProcessJob
+/// \brief a command queued on the ProcessRunner
+///
+/// stdout is streamed in while the process runs, the owner drains it with
+/// readOutput() from its own thread; cancel() can be called at any time
+class ProcessJob {
+
+public:
+
+    ProcessJob(const vector<string> &_args, unsigned int _timeoutMs) : args(_args), timeoutMs(_timeoutMs) {
+        state       = PROCESS_JOB_QUEUED;
+        cancelled   = false;
+        pid         = -1;
+        exitStatus  = -1;
+    }
+
+    // kill the process group (or drop the job if still queued)
+    void cancel(){
+        cancelled = true;
+        std::unique_lock<std::mutex> lck(mutex);
+        if(pid > 0){
+            kill(-pid,SIGTERM);
+        }
+    }
+
+    // stdout received since the last call
+    string readOutput(){
+        std::unique_lock<std::mutex> lck(mutex);
+        string out;
+        out.swap(output);
+        return out;
+    }
+
+    PROCESS_JOB_STATE getState() const { return state; }
+    bool isDone() const { return state != PROCESS_JOB_QUEUED && state != PROCESS_JOB_RUNNING; }
+    int getExitStatus() const { return exitStatus; }
+
+protected:
+
+    friend class ProcessRunner;
+
+    vector<string>                  args;
+    unsigned int                    timeoutMs;          // 0: no timeout
+    std::atomic<PROCESS_JOB_STATE>  state;
+    std::atomic<bool>               cancelled;
+    std::atomic<int>                exitStatus;
+    pid_t                           pid;                // guarded by mutex
+    string                          output;             // guarded by mutex
+    std::mutex                      mutex;
+};
+
+/// \class ProcessRunner
+/// \brief shared process execution service
+///
+/// commands are spawned with posix_spawn (their own process group, stdout
+/// on a pipe) by a small pool of worker threads, started on demand and
+/// parked on a condition variable when there is nothing to run, so an idle
+/// patch costs nothing; extra commands wait in the queue until a worker is
+/// free
+class ProcessRunner {
+
+public:
+
+    static ProcessRunner& instance(){
+        // never destroyed, jobs can still be cancelled from static objects at exit
+        static ProcessRunner *runner = new ProcessRunner();
+        return *runner;
+    }
+
+    // queue a command, args[0] is looked up in PATH
+    shared_ptr<ProcessJob> run(const vector<string> &args, unsigned int timeoutMs=0){
+        shared_ptr<ProcessJob> job = make_shared<ProcessJob>(args,timeoutMs);
+        std::unique_lock<std::mutex> lck(mutex);
+        queue.push_back(job);
+        if(idleWorkers == 0 && numWorkers < PROCESS_RUNNER_MAX_WORKERS){
+            numWorkers++;
+            std::thread(&ProcessRunner::workerFunction,this).detach();
+        }
+        condition.notify_one();
+        return job;
+    }
+
+protected:
+
+    ProcessRunner(){
+        numWorkers  = 0;
+        idleWorkers = 0;
+    }
+
+    void workerFunction(){
+        std::unique_lock<std::mutex> lck(mutex);
+        while(true){
+            idleWorkers++;
+            condition.wait(lck,[this]{ return !queue.empty(); });
+            idleWorkers--;
+
+            shared_ptr<ProcessJob> job = queue.front();
+            queue.pop_front();
+
+            lck.unlock();
+            if(job->cancelled){
+                job->state = PROCESS_JOB_CANCELLED;
+            }else{
+                execute(job);
+            }
+            lck.lock();
+        }
+    }
+
+    void execute(shared_ptr<ProcessJob> job){
+        if(job->args.empty()){
+            job->state = PROCESS_JOB_FAILED;
+            return;
+        }
+
+        // both ends close-on-exec: children spawned meanwhile by the other workers must not inherit the
+        // write end, or this job never reads EOF (dup2 clears the flag on the child stdout)
+        int fds[2];
+#ifdef TARGET_LINUX
+        if(pipe2(fds,O_CLOEXEC) != 0){
+            job->state = PROCESS_JOB_FAILED;
+            return;
+        }
+#else
+        if(pipe(fds) != 0){
+            job->state = PROCESS_JOB_FAILED;
+            return;
+        }
+        fcntl(fds[0],F_SETFD,FD_CLOEXEC);
+        fcntl(fds[1],F_SETFD,FD_CLOEXEC);
+#endif
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions,fds[1],STDOUT_FILENO);
+        posix_spawn_file_actions_addclose(&actions,fds[0]);
+        posix_spawn_file_actions_addclose(&actions,fds[1]);
+
+        // own process group, so the whole tree can be killed
+        posix_spawnattr_t attr;
+        posix_spawnattr_init(&attr);
+        posix_spawnattr_setflags(&attr,POSIX_SPAWN_SETPGROUP);
+        posix_spawnattr_setpgroup(&attr,0);
+
+        vector<char*> argv;
+        for(size_t i=0;i<job->args.size();i++){
+            argv.push_back(const_cast<char*>(job->args.at(i).c_str()));
+        }
+        argv.push_back(nullptr);
+
+        pid_t pid;
+        int res;
+        {
+            std::unique_lock<std::mutex> lck(job->mutex);
+            res = posix_spawnp(&pid,argv[0],&actions,&attr,argv.data(),environ);
+            if(res == 0){
+                job->pid = pid;
+                job->state = PROCESS_JOB_RUNNING;
+            }
+        }
+        posix_spawn_file_actions_destroy(&actions);
+        posix_spawnattr_destroy(&attr);
+        close(fds[1]);
+
+        if(res != 0){
+            close(fds[0]);
+            job->state = PROCESS_JOB_FAILED;
+            return;
+        }
+
+        uint64_t deadline = job->timeoutMs > 0 ? ofGetElapsedTimeMillis() + job->timeoutMs : 0;
+        bool timedOut = false;
+        char buffer[4096];
+
+        // stream stdout until EOF, checking the deadline and cancel() meanwhile
+        struct pollfd pfd;
+        pfd.fd = fds[0];
+        pfd.events = POLLIN;
+        while(!job->cancelled){
+            int wait = PROCESS_RUNNER_KILL_GRACE_MS;
+            if(deadline > 0){
+                uint64_t now = ofGetElapsedTimeMillis();
+                if(now >= deadline){
+                    timedOut = true;
+                    break;
+                }
+                wait = std::min(wait,static_cast<int>(deadline - now));
+            }
+            pfd.revents = 0;
+            int ready = poll(&pfd,1,wait);
+            if(ready <= 0){
+                continue;
+            }
+            ssize_t len = read(fds[0],buffer,sizeof(buffer));
+            if(len < 0 && errno == EINTR){
+                continue;
+            }
+            if(len <= 0){
+                break;
+            }
+            std::unique_lock<std::mutex> lck(job->mutex);
+            job->output.append(buffer,static_cast<size_t>(len));
+        }
+        close(fds[0]);
+
+        // reap it, stdout can be closed a bit before the exit
+        int status = 0;
+        while(!timedOut && !job->cancelled){
+            pid_t w = waitpid(pid,&status,WNOHANG);
+            if(w == pid || (w < 0 && errno != EINTR)){
+                break;
+            }
+            if(deadline > 0 && ofGetElapsedTimeMillis() >= deadline){
+                timedOut = true;
+                break;
+            }
+            ofSleepMillis(5);
+        }
+        if(timedOut || job->cancelled){
+            terminate(pid,status);
+        }
+
+        {
+            std::unique_lock<std::mutex> lck(job->mutex);
+            job->pid = -1;
+        }
+
+        if(timedOut){
+            job->state = PROCESS_JOB_TIMEOUT;
+        }else if(job->cancelled){
+            job->state = PROCESS_JOB_CANCELLED;
+        }else{
+            job->exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+            job->state = PROCESS_JOB_FINISHED;
+        }
+    }
+
+    // SIGTERM the group, SIGKILL it if still alive after the grace time, reap it
+    void terminate(pid_t pid, int &status){
+        kill(-pid,SIGTERM);
+        uint64_t limit = ofGetElapsedTimeMillis() + PROCESS_RUNNER_KILL_GRACE_MS;
+        while(ofGetElapsedTimeMillis() < limit){
+            if(waitpid(pid,&status,WNOHANG) == pid){
+                return;
+            }
+            ofSleepMillis(5);
+        }
+        kill(-pid,SIGKILL);
+        waitpid(pid,&status,0);
+    }
+
+    std::deque<shared_ptr<ProcessJob>>  queue;
+    int                                 numWorkers;
+    int                                 idleWorkers;
+    std::condition_variable             condition;
+    std::mutex                          mutex;
+};
+
+#endif
@@ -0,0 +1,203 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+
+#include "ofMain.h"
+#include "frameQueue.h"
+#include <atomic>
+
+// captured frames waiting for the main thread
+#define CAPTURE_QUEUE_SIZE          2
+// capture thread polling interval (ms)
+#define CAPTURE_POLL_SLEEP          2
+// video file standing in for a capture device (tests, CI, no camera)
+#define CAPTURE_FAKE_DEVICE_ENV     "OFXVP_FAKE_CAMERA"
+
+struct CaptureStats {
+    uint64_t    framesCaptured  = 0;
+    uint64_t    framesDropped   = 0; // captured but never received by the main thread
+    float       captureMs       = 0.0f; // smoothed grab + mirror/copy time of a new frame
+    float       fps             = 0.0f;
+};
+
+/// \class ThreadedCapture
+/// \brief owns an ofVideoGrabber (without texture) and grabs it on a dedicated thread
+///
+/// every new frame is mirrored (if needed) straight from the grabber pixels into
+/// the preallocated buffers of a frame queue, the main thread receives the CPU
+/// frame without any GPU round trip and can share it as is (see ofxVPFrameQueue);
+/// uploading it to a texture is left to the caller, only when needed.
+///
+/// a video file can stand in for the device (setupFile()), looping at its own
+/// frame rate: a fake camera to test capture patches without hardware. A V4L2
+/// loopback device is listed and opened like any other device.
+class ThreadedCapture: public ofThread{
+
+public:
+    ThreadedCapture() : frames(CAPTURE_QUEUE_SIZE){
+        hMirror     = false;
+        vMirror     = false;
+        useFile     = false;
+        opened      = false;
+        lastFrameTime = 0;
+    }
+
+    ~ThreadedCapture(){
+        close();
+    }
+
+    // the fake device path, empty if not set
+    static string getFakeDevice(){
+        const char *path = getenv(CAPTURE_FAKE_DEVICE_ENV);
+        return path != nullptr ? string(path) : "";
+    }
+
+    bool setup(int deviceID, int w, int h){
+        close();
+        grabber.setUseTexture(false);
+        grabber.setDeviceID(deviceID);
+        useFile = false;
+        opened = grabber.setup(w,h);
+        return start();
+    }
+
+    bool setupFile(string path){
+        close();
+        filePlayer.setUseTexture(false);
+        useFile = true;
+        opened = filePlayer.load(path);
+        if(opened){
+            filePlayer.setLoopState(OF_LOOP_NORMAL);
+            filePlayer.setVolume(0);
+            filePlayer.play();
+        }
+        return start();
+    }
+
+    void close(){
+        if(isThreadRunning()){
+            stopThread();
+            waitForThread(false);
+        }
+        if(opened){
+            if(useFile){
+                filePlayer.close();
+            }else{
+                grabber.close();
+            }
+            opened = false;
+        }
+        frames.reset();
+    }
+
+    bool isInitialized() { return opened; }
+
+    void setMirror(bool horizontal, bool vertical){
+        hMirror = horizontal;
+        vMirror = vertical;
+    }
+
+    // main thread: true if a new frame was captured since the last call, getFrame() is then valid
+    // (and untouched by the capture thread) until the second call after it
+    bool receiveFrame() { return frames.receive(); }
+    const ofPixels& getFrame() const { return frames.front(); }
+    ofPixels* getFrameBuffer() { return frames.frontBuffer(); }
+
+    CaptureStats getStats(){
+        std::unique_lock<std::mutex> lck(mutex);
+        stats.framesDropped = frames.getDropped();
+        return stats;
+    }
+
+    void threadedFunction(){
+        while(isThreadRunning()){
+            uint64_t start = ofGetElapsedTimeMicros();
+            bool isNew = false;
+            if(useFile){
+                filePlayer.update();
+                isNew = filePlayer.isFrameNew();
+            }else{
+                grabber.update();
+                isNew = grabber.isFrameNew();
+            }
+
+            if(isNew){
+                const ofPixels &src = useFile ? filePlayer.getPixels() : grabber.getPixels();
+                // mirror while copying, same size frames reuse the buffer allocation
+                src.mirrorTo(frames.beginWrite(),vMirror,hMirror);
+                frames.endWrite();
+
+                uint64_t now = ofGetElapsedTimeMicros();
+                float captureMs = static_cast<float>(now-start)/1000.0f;
+                std::unique_lock<std::mutex> lck(mutex);
+                stats.framesCaptured++;
+                stats.captureMs = stats.framesCaptured > 1 ? stats.captureMs*0.9f + captureMs*0.1f : captureMs;
+                if(lastFrameTime > 0 && now > lastFrameTime){
+                    float fps = 1000000.0f/static_cast<float>(now-lastFrameTime);
+                    stats.fps = stats.fps > 0.0f ? stats.fps*0.9f + fps*0.1f : fps;
+                }
+                lastFrameTime = now;
+            }
+
+            sleep(CAPTURE_POLL_SLEEP);
+        }
+    }
+
+protected:
+
+    bool start(){
+        if(opened){
+            std::unique_lock<std::mutex> lck(mutex);
+            stats = CaptureStats();
+            lastFrameTime = 0;
+            lck.unlock();
+            startThread();
+        }
+        return opened;
+    }
+
+    ofVideoGrabber      grabber;
+    ofVideoPlayer       filePlayer;
+    bool                useFile;
+    bool                opened;
+
+    ofxVPFrameQueue     frames;
+
+    std::atomic<bool>   hMirror;
+    std::atomic<bool>   vMirror;
+
+    // guarded by mutex
+    CaptureStats        stats;
+    uint64_t            lastFrameTime;
+};
@@ -0,0 +1,511 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+
+#include "ofMain.h"
+#include <atomic>
+
+#define SERIAL_READ_BUFFER_SIZE     4096
+#define SERIAL_MAX_FRAME_SIZE       1024
+// raw framing: bytes per frame, the fixed outlet size of the MosaicConnector.ino template
+#define SERIAL_RAW_FRAME_SIZE       64
+
+#define SLIP_END                    0xC0
+#define SLIP_ESC                    0xDB
+#define SLIP_ESC_END                0xDC
+#define SLIP_ESC_ESC                0xDD
+
+enum SERIAL_FRAMING {
+    SERIAL_FRAMING_LINE,    // '\n' terminated frames
+    SERIAL_FRAMING_COBS,    // COBS encoded, 0x00 terminated frames
+    SERIAL_FRAMING_SLIP,    // RFC 1055 SLIP frames
+    SERIAL_FRAMING_RAW      // unframed: received bytes as values, SERIAL_RAW_FRAME_SIZE per frame (zero padded)
+};
+
+enum SERIAL_PROTOCOL {
+    SERIAL_PROTOCOL_TEXT,   // comma separated ASCII values
+    SERIAL_PROTOCOL_BINARY  // packed little-endian float32 values
+};
+
+struct SerialStats {
+    uint64_t    bytesIn         = 0;
+    uint64_t    bytesOut        = 0;
+    uint64_t    framesIn        = 0;
+    uint64_t    framesOut       = 0;
+    uint64_t    framesOutFailed = 0; // lost on a write error
+    uint64_t    framesDropped   = 0; // malformed or oversized frames
+    float       bytesInPerSec   = 0.0f;
+    float       bytesOutPerSec  = 0.0f;
+    float       latencyMs       = 0.0f; // smoothed first byte of a frame -> frame consumed by the patch
+};
+
+/// \class ThreadedSerial
+/// \brief owns an ofSerial device and does all the I/O on a dedicated thread
+///
+/// incoming bytes are read into a scratch buffer and parsed into frames (line,
+/// COBS or SLIP framing) right after every read, partial frames are kept
+/// between reads and a slow device never blocks the main thread; the last
+/// complete frame is published to the main thread, decoded as ASCII values or
+/// packed floats.
+///
+/// outgoing frames are written to the end before the next one is taken, the
+/// port is non-blocking so a write can take several passes of the loop.
+///
+/// raw framing keeps the original MosaicConnector.ino protocol: every received
+/// byte is a value, in frames of SERIAL_RAW_FRAME_SIZE, and text data is sent
+/// as a "size,v1,v2,...\n" line.
+///
+/// the port is opened by path, so any tty (a pty slave included) can stand in
+/// for a real device
+class ThreadedSerial: public ofThread{
+
+public:
+    ThreadedSerial(){
+        framing         = SERIAL_FRAMING_RAW;
+        activeFraming   = SERIAL_FRAMING_RAW;
+        protocol        = SERIAL_PROTOCOL_TEXT;
+        incomingTime    = 0;
+        connected       = false;
+        hasOutgoing     = false;
+        hasIncoming     = false;
+        txSent          = 0;
+        frameStartTime  = 0;
+        frameOverflow   = false;
+        slipEscape      = false;
+        frameBuffer.reserve(SERIAL_MAX_FRAME_SIZE);
+        decodedBuffer.reserve(SERIAL_MAX_FRAME_SIZE);
+        txFrame.reserve(SERIAL_MAX_FRAME_SIZE*2);
+    }
+
+    ~ThreadedSerial(){
+        close();
+    }
+
+    bool setup(string portName, int baudrate){
+        close();
+
+        connected = serial.setup(portName,baudrate);
+        if(connected){
+            resetFrameState();
+            txFrame.clear();
+            txSent = 0;
+            statsWindowStart = ofGetElapsedTimeMillis();
+            statsWindowBytesIn = statsWindowBytesOut = 0;
+            startThread();
+        }
+        return connected;
+    }
+
+    void close(){
+        if(isThreadRunning()){
+            stopThread();
+            waitForThread(false);
+        }
+        if(connected){
+            serial.close();
+            connected = false;
+        }
+    }
+
+    // the worker drops any partially received frame when it picks up the new framing
+    void setFraming(SERIAL_FRAMING f){
+        std::unique_lock<std::mutex> lck(mutex);
+        framing = f;
+    }
+
+    void setProtocol(SERIAL_PROTOCOL p){
+        std::unique_lock<std::mutex> lck(mutex);
+        protocol = p;
+    }
+
+    // queue data for sending, only the latest vector is kept if the device is slower than the patch
+    void send(const vector<float> &data){
+        std::unique_lock<std::mutex> lck(mutex);
+        outgoing.assign(data.begin(),data.end());
+        hasOutgoing = true;
+    }
+
+    // get the last received frame, returns false if nothing new arrived since the last call
+    bool receive(vector<float> &data){
+        std::unique_lock<std::mutex> lck(mutex);
+        if(!hasIncoming){
+            return false;
+        }
+        data.swap(incoming);
+        hasIncoming = false;
+
+        float latency = static_cast<float>(ofGetElapsedTimeMicros()-incomingTime)/1000.0f;
+        stats.latencyMs = stats.framesIn > 1 ? stats.latencyMs*0.9f + latency*0.1f : latency;
+        return true;
+    }
+
+    SerialStats getStats(){
+        std::unique_lock<std::mutex> lck(mutex);
+        return stats;
+    }
+
+    bool isConnected() { return connected; }
+
+    void threadedFunction(){
+        while(isThreadRunning()){
+            bool idle = true;
+
+            // SENDING, the next frame only once the current one is fully written
+            if(txSent == txFrame.size()){
+                std::unique_lock<std::mutex> lck(mutex);
+                txFrame.clear();
+                txSent = 0;
+                if(hasOutgoing){
+                    pendingTx.swap(outgoing);
+                    hasOutgoing = false;
+                    encodeFrame(pendingTx);
+                }
+            }
+            if(txSent < txFrame.size()){
+                long written = serial.writeBytes(txFrame.data()+txSent,txFrame.size()-txSent);
+                if(written > 0){
+                    txSent += static_cast<size_t>(written);
+                    std::unique_lock<std::mutex> lck(mutex);
+                    stats.bytesOut += static_cast<uint64_t>(written);
+                    statsWindowBytesOut += static_cast<uint64_t>(written);
+                    if(txSent == txFrame.size()){
+                        stats.framesOut++;
+                    }
+                    idle = false;
+                }else if(written < 0){
+                    // write error, the rest of the frame is lost
+                    txSent = txFrame.size();
+                    std::unique_lock<std::mutex> lck(mutex);
+                    stats.framesOutFailed++;
+                }
+                // nothing written: the device is busy, the rest goes on the next pass
+            }
+
+            // RECEIVING, parsed right away so the read buffer is free again for the next read
+            int available = serial.available();
+            if(available > 0){
+                long n = serial.readBytes(readBuffer,std::min(static_cast<size_t>(available),static_cast<size_t>(SERIAL_READ_BUFFER_SIZE)));
+                if(n > 0){
+                    {
+                        std::unique_lock<std::mutex> lck(mutex);
+                        stats.bytesIn += static_cast<uint64_t>(n);
+                        statsWindowBytesIn += static_cast<uint64_t>(n);
+                    }
+                    parseBytes(static_cast<size_t>(n));
+                    idle = false;
+                }
+            }
+
+            updateThroughput();
+
+            if(idle){
+                sleep(1);
+            }
+        }
+    }
+
+protected:
+
+    void resetFrameState(){
+        frameBuffer.clear();
+        frameOverflow   = false;
+        slipEscape      = false;
+        frameStartTime  = 0;
+    }
+
+    void parseBytes(size_t n){
+        {
+            std::unique_lock<std::mutex> lck(mutex);
+            if(activeFraming != framing){
+                activeFraming = framing;
+                resetFrameState();
+            }
+        }
+
+        for(size_t i=0;i<n;i++){
+            unsigned char c = readBuffer[i];
+
+            if(frameBuffer.empty() && frameStartTime == 0){
+                frameStartTime = ofGetElapsedTimeMicros();
+            }
+
+            bool frameEnd = false;
+            switch(activeFraming){
+                case SERIAL_FRAMING_LINE:
+                    if(c == '\n'){
+                        frameEnd = true;
+                    }else if(c != '\r'){
+                        pushFrameByte(c);
+                    }
+                    break;
+                case SERIAL_FRAMING_COBS:
+                    if(c == 0x00){
+                        frameEnd = true;
+                    }else{
+                        pushFrameByte(c);
+                    }
+                    break;
+                case SERIAL_FRAMING_RAW:
+                    pushFrameByte(c);
+                    frameEnd = frameBuffer.size() == SERIAL_RAW_FRAME_SIZE;
+                    break;
+                case SERIAL_FRAMING_SLIP:
+                    if(slipEscape){
+                        slipEscape = false;
+                        if(c == SLIP_ESC_END){
+                            pushFrameByte(SLIP_END);
+                        }else if(c == SLIP_ESC_ESC){
+                            pushFrameByte(SLIP_ESC);
+                        }else{
+                            frameOverflow = true; // protocol violation, discard the whole frame
+                        }
+                    }else if(c == SLIP_ESC){
+                        slipEscape = true;
+                    }else if(c == SLIP_END){
+                        frameEnd = true;
+                    }else{
+                        pushFrameByte(c);
+                    }
+                    break;
+                default:
+                    break;
+            }
+
+            if(frameEnd){
+                if(frameOverflow){
+                    std::unique_lock<std::mutex> lck(mutex);
+                    stats.framesDropped++;
+                }else if(!frameBuffer.empty()){
+                    decodeFrame();
+                }
+                resetFrameState();
+            }
+        }
+
+        // raw framing: a read ends the frame, like the old direct readBytes() of the object
+        if(activeFraming == SERIAL_FRAMING_RAW && !frameBuffer.empty()){
+            decodeFrame();
+            resetFrameState();
+        }
+    }
+
+    void pushFrameByte(unsigned char c){
+        if(frameBuffer.size() < SERIAL_MAX_FRAME_SIZE){
+            frameBuffer.push_back(c);
+        }else{
+            frameOverflow = true;
+        }
+    }
+
+    void decodeFrame(){
+        const vector<unsigned char> *payload = &frameBuffer;
+
+        if(activeFraming == SERIAL_FRAMING_COBS){
+            if(!cobsDecode(frameBuffer,decodedBuffer)){
+                std::unique_lock<std::mutex> lck(mutex);
+                stats.framesDropped++;
+                return;
+            }
+            payload = &decodedBuffer;
+        }
+
+        std::unique_lock<std::mutex> lck(mutex);
+
+        if(activeFraming == SERIAL_FRAMING_RAW){
+            incoming.assign(SERIAL_RAW_FRAME_SIZE,0.0f);
+            for(size_t i=0;i<payload->size();i++){
+                incoming[i] = static_cast<float>(payload->at(i));
+            }
+        }else if(protocol == SERIAL_PROTOCOL_BINARY){
+            if(payload->size() % sizeof(float) != 0){
+                stats.framesDropped++;
+                return;
+            }
+            incoming.resize(payload->size()/sizeof(float));
+            memcpy(incoming.data(),payload->data(),payload->size());
+        }else{
+            incoming.clear();
+            const char *p = reinterpret_cast<const char*>(payload->data());
+            const char *end = p + payload->size();
+            while(p < end){
+                const char *sep = static_cast<const char*>(memchr(p,',',end-p));
+                if(sep == nullptr) sep = end;
+                if(sep > p){
+                    incoming.push_back(ofToFloat(string(p,sep)));
+                }
+                p = sep + 1;
+            }
+        }
+
+        hasIncoming     = true;
+        incomingTime    = frameStartTime;
+        stats.framesIn++;
+    }
+
+    // called with the mutex locked
+    void encodeFrame(const vector<float> &data){
+        txFrame.clear();
+        if(protocol == SERIAL_PROTOCOL_BINARY){
+            rawPayload.resize(data.size()*sizeof(float));
+            memcpy(rawPayload.data(),data.data(),rawPayload.size());
+        }else{
+            string temp = ofToString(data.size());
+            for(size_t s=0;s<data.size();s++){
+                temp += ",";
+                temp += ofToString(data.at(s));
+            }
+            rawPayload.assign(temp.begin(),temp.end());
+        }
+
+        switch(framing){
+            case SERIAL_FRAMING_RAW:
+                txFrame.insert(txFrame.end(),rawPayload.begin(),rawPayload.end());
+                if(protocol == SERIAL_PROTOCOL_TEXT){
+                    txFrame.push_back('\n');
+                }
+                break;
+            case SERIAL_FRAMING_LINE:
+                txFrame.insert(txFrame.end(),rawPayload.begin(),rawPayload.end());
+                txFrame.push_back('\n');
+                break;
+            case SERIAL_FRAMING_COBS:
+                cobsEncode(rawPayload,txFrame);
+                txFrame.push_back(0x00);
+                break;
+            case SERIAL_FRAMING_SLIP:
+                txFrame.push_back(SLIP_END);
+                for(size_t i=0;i<rawPayload.size();i++){
+                    if(rawPayload[i] == SLIP_END){
+                        txFrame.push_back(SLIP_ESC);
+                        txFrame.push_back(SLIP_ESC_END);
+                    }else if(rawPayload[i] == SLIP_ESC){
+                        txFrame.push_back(SLIP_ESC);
+                        txFrame.push_back(SLIP_ESC_ESC);
+                    }else{
+                        txFrame.push_back(rawPayload[i]);
+                    }
+                }
+                txFrame.push_back(SLIP_END);
+                break;
+            default:
+                break;
+        }
+    }
+
+    static void cobsEncode(const vector<unsigned char> &in, vector<unsigned char> &out){
+        size_t codeIndex = out.size();
+        unsigned char code = 1;
+        out.push_back(0); // placeholder for the first code byte
+        for(size_t i=0;i<in.size();i++){
+            if(in[i] == 0x00){
+                out[codeIndex] = code;
+                codeIndex = out.size();
+                out.push_back(0);
+                code = 1;
+            }else{
+                out.push_back(in[i]);
+                code++;
+                if(code == 0xFF){
+                    out[codeIndex] = code;
+                    codeIndex = out.size();
+                    out.push_back(0);
+                    code = 1;
+                }
+            }
+        }
+        out[codeIndex] = code;
+    }
+
+    static bool cobsDecode(const vector<unsigned char> &in, vector<unsigned char> &out){
+        out.clear();
+        size_t i = 0;
+        while(i < in.size()){
+            unsigned char code = in[i];
+            if(code == 0x00 || i + code > in.size()){
+                return false;
+            }
+            i++;
+            for(unsigned char c=1;c<code;c++){
+                out.push_back(in[i++]);
+            }
+            if(code != 0xFF && i < in.size()){
+                out.push_back(0x00);
+            }
+        }
+        return true;
+    }
+
+    void updateThroughput(){
+        uint64_t now = ofGetElapsedTimeMillis();
+        if(now - statsWindowStart >= 1000){
+            std::unique_lock<std::mutex> lck(mutex);
+            float secs = static_cast<float>(now - statsWindowStart)/1000.0f;
+            stats.bytesInPerSec     = static_cast<float>(statsWindowBytesIn)/secs;
+            stats.bytesOutPerSec    = static_cast<float>(statsWindowBytesOut)/secs;
+            statsWindowBytesIn      = 0;
+            statsWindowBytesOut     = 0;
+            statsWindowStart        = now;
+        }
+    }
+
+    ofSerial                serial;
+    std::atomic<bool>       connected;
+
+    // shared with the main thread, guarded by mutex
+    SERIAL_FRAMING          framing;
+    SERIAL_PROTOCOL         protocol;
+    vector<float>           outgoing;
+    vector<float>           incoming;
+    uint64_t                incomingTime;
+    bool                    hasOutgoing;
+    bool                    hasIncoming;
+    SerialStats             stats;
+
+    // worker thread only
+    unsigned char           readBuffer[SERIAL_READ_BUFFER_SIZE];
+    vector<unsigned char>   frameBuffer;
+    vector<unsigned char>   decodedBuffer;
+    vector<unsigned char>   rawPayload;
+    vector<unsigned char>   txFrame;
+    size_t                  txSent;         // bytes of txFrame already written
+    vector<float>           pendingTx;
+    SERIAL_FRAMING          activeFraming;
+    uint64_t                frameStartTime;
+    bool                    frameOverflow;
+    bool                    slipEscape;
+    uint64_t                statsWindowStart;
+    uint64_t                statsWindowBytesIn;
+    uint64_t                statsWindowBytesOut;
+
+};
@@ -0,0 +1,573 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2018 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#pragma once
+
+
+#include "ofMain.h"
+#include "videoSync.h"
+#include "frameQueue.h"
+#include <atomic>
+#include <condition_variable>
+
+// decoded frames waiting for the main thread, the oldest are dropped if it can't keep up
+#define VIDEO_DECODE_QUEUE_SIZE     3
+// decoder polling interval bounds (ms), between them a quarter of the clip frame interval
+#define VIDEO_DECODE_MIN_SLEEP      1
+#define VIDEO_DECODE_MAX_SLEEP      10
+// upper bound of the shared decode threads (half the cores otherwise)
+#define VIDEO_DECODE_MAX_THREADS    4
+
+struct VideoDecodeStats {
+    uint64_t    framesDecoded   = 0;
+    uint64_t    framesDropped   = 0; // decoded but never received by the main thread
+    float       decodeMs        = 0.0f; // smoothed player update + frame copy time of a new frame
+    float       decodeMaxMs     = 0.0f;
+    float       syncErrorMs     = 0.0f; // drift from the sync group clock
+    int         queued          = 0;
+};
+
+/// \class ThreadedVideoDecoder
+/// \brief owns an ofVideoPlayer (without texture) and decodes it ahead on the shared decode threads
+///
+/// every due decode step (VideoDecodePool) calls update() on the player and copies
+/// a new frame into the preallocated pixel buffers of a frame queue (ofxVPFrameQueue)
+/// for the main thread; receiveFrame() returns true only on a real new frame, so nothing is
+/// uploaded twice.
+///
+/// playback control is queued as commands applied before the next update, and the
+/// player state is read from a snapshot taken after it, so the main thread never
+/// waits for a decode. Only load() and close() block.
+///
+/// in a sync group (setSyncGroup()) the transport controls drive the group
+/// (ofxVPVideoSync) and the clip follows the group clock, frame accurate.
+class ThreadedVideoDecoder{
+
+public:
+    ThreadedVideoDecoder() : frames(VIDEO_DECODE_QUEUE_SIZE){
+        syncGroup       = 0;
+        activeGroup     = 0;
+        syncEpoch       = 0;
+        prerolledEpoch  = 0;
+        prerollPending  = false;
+        prerollFrame    = 0;
+        syncError       = 0.0;
+        syncSpeed       = 1.0f;
+        syncLoop        = OF_LOOP_NONE;
+        decoding        = false;
+    }
+
+    ~ThreadedVideoDecoder(){
+        stopDecoding();
+        setSyncGroup(0);
+        close();
+    }
+
+    void setup();
+    void stopDecoding();
+
+    bool load(string path){
+        std::unique_lock<std::mutex> plck(playerMutex);
+        player.setUseTexture(false);
+        bool loaded = player.load(path);
+        frames.reset();
+        std::unique_lock<std::mutex> lck(mutex);
+        commands.clear();
+        stats = VideoDecodeStats();
+        syncEpoch = 0;
+        takeSnapshot();
+        return loaded;
+    }
+
+    void close(){
+        std::unique_lock<std::mutex> plck(playerMutex);
+        if(player.isLoaded()){
+            player.stop();
+            player.setVolume(0);
+            player.close();
+        }
+        frames.reset();
+        std::unique_lock<std::mutex> lck(mutex);
+        commands.clear();
+        takeSnapshot();
+    }
+
+    // 0 to play alone, 1..VIDEO_SYNC_MAX_GROUPS to follow a group clock
+    void setSyncGroup(int group){
+        if(!ofxVPVideoSync::isGroup(group)){
+            group = 0;
+        }
+        if(group == syncGroup){
+            return;
+        }
+        ofxVPVideoSync::get().leave(syncGroup,this);
+        ofxVPVideoSync::get().join(group,this);
+        std::unique_lock<std::mutex> lck(mutex);
+        syncGroup = group;
+    }
+    int getSyncGroup() const { return syncGroup; }
+
+    // PLAYBACK CONTROL (main thread, applied on the next decode step, or by the sync group)
+    void play()                         { if(syncGroup > 0){ ofxVPVideoSync::get().play(syncGroup); }else{ pushCommand(VIDEO_CMD_PLAY); } }
+    void stop()                         { if(syncGroup > 0){ ofxVPVideoSync::get().stop(syncGroup); }else{ pushCommand(VIDEO_CMD_STOP); } }
+    void firstFrame()                   { if(syncGroup > 0){ ofxVPVideoSync::get().seek(syncGroup,0.0); }else{ pushCommand(VIDEO_CMD_FIRST_FRAME); } }
+    void setPaused(bool p)              { if(syncGroup > 0){ ofxVPVideoSync::get().setPaused(syncGroup,p); }else{ pushCommand(VIDEO_CMD_PAUSE,p ? 1.0f : 0.0f); } }
+    void setSpeed(float s)              { if(syncGroup > 0){ ofxVPVideoSync::get().setSpeed(syncGroup,s); }else{ pushCommand(VIDEO_CMD_SPEED,s); } }
+    void setPosition(float p)           { if(syncGroup > 0){ ofxVPVideoSync::get().seek(syncGroup,p*getDuration()); }else{ pushCommand(VIDEO_CMD_POSITION,p); } }
+    void setLoopState(ofLoopType l)     { if(syncGroup > 0){ ofxVPVideoSync::get().setLoop(syncGroup,l == OF_LOOP_NORMAL); }else{ pushCommand(VIDEO_CMD_LOOP,static_cast<float>(l)); } }
+    void setVolume(float v)             { pushCommand(VIDEO_CMD_VOLUME,v); }
+
+    // PLAYER STATE (snapshot of the last decode step)
+    bool    isLoaded()                  { std::unique_lock<std::mutex> lck(mutex); return state.loaded; }
+    bool    isPlaying()                 { std::unique_lock<std::mutex> lck(mutex); return state.playing; }
+    bool    isPaused()                  { std::unique_lock<std::mutex> lck(mutex); return state.paused; }
+    float   getPosition()               { std::unique_lock<std::mutex> lck(mutex); return state.position; }
+    float   getDuration()               { std::unique_lock<std::mutex> lck(mutex); return state.duration; }
+    float   getWidth()                  { std::unique_lock<std::mutex> lck(mutex); return state.width; }
+    float   getHeight()                 { std::unique_lock<std::mutex> lck(mutex); return state.height; }
+    int     getCurrentFrame()           { std::unique_lock<std::mutex> lck(mutex); return state.currentFrame; }
+    int     getTotalNumFrames()         { std::unique_lock<std::mutex> lck(mutex); return state.totalFrames; }
+
+    // main thread: true if a new frame was decoded since the last call, getFrame() is then valid
+    // (and untouched by the decode threads) until the second call after it
+    bool receiveFrame() { return frames.receive(); }
+    const ofPixels& getFrame() const { return frames.front(); }
+
+    VideoDecodeStats getStats(){
+        std::unique_lock<std::mutex> lck(mutex);
+        stats.framesDropped = frames.getDropped();
+        stats.queued = frames.getQueued();
+        return stats;
+    }
+
+    // one decode step, called by a pool thread: returns the ms to wait before the next one
+    int service(){
+        std::unique_lock<std::mutex> plck(playerMutex);
+
+        int group = 0;
+        {
+            std::unique_lock<std::mutex> lck(mutex);
+            pendingCommands.swap(commands);
+            group = syncGroup;
+        }
+        applyCommands();
+
+        if(!player.isLoaded()){
+            return VIDEO_DECODE_MAX_SLEEP;
+        }
+
+        if(group != activeGroup){
+            activeGroup     = group;
+            syncEpoch       = 0;
+            prerolledEpoch  = 0;
+            prerollPending  = false;
+            syncError       = 0.0;
+            syncSpeed       = player.getSpeed();
+            syncLoop        = player.getLoopState();
+        }
+        if(activeGroup > 0){
+            syncBeforeUpdate();
+        }
+
+        uint64_t start = ofGetElapsedTimeMicros();
+        player.update();
+        if(player.isFrameNew()){
+            queueFrame(start);
+        }
+
+        if(activeGroup > 0){
+            syncAfterUpdate();
+        }
+
+        std::unique_lock<std::mutex> lck(mutex);
+        takeSnapshot();
+        stats.syncErrorMs = static_cast<float>(syncError*1000.0);
+        if(state.totalFrames > 0 && state.duration > 0.0f){
+            float frameMs = state.duration*1000.0f/static_cast<float>(state.totalFrames);
+            return ofClamp(static_cast<int>(frameMs*0.25f),VIDEO_DECODE_MIN_SLEEP,VIDEO_DECODE_MAX_SLEEP);
+        }
+        return VIDEO_DECODE_MAX_SLEEP;
+    }
+
+protected:
+
+    enum VIDEO_CMD {
+        VIDEO_CMD_PLAY,
+        VIDEO_CMD_STOP,
+        VIDEO_CMD_FIRST_FRAME,
+        VIDEO_CMD_PAUSE,
+        VIDEO_CMD_SPEED,
+        VIDEO_CMD_VOLUME,
+        VIDEO_CMD_POSITION,
+        VIDEO_CMD_LOOP
+    };
+
+    struct Command {
+        VIDEO_CMD   type;
+        float       value;
+    };
+
+    struct PlayerState {
+        bool    loaded          = false;
+        bool    playing         = false;
+        bool    paused          = false;
+        float   position        = 0.0f;
+        float   duration        = 0.0f;
+        float   width           = 0.0f;
+        float   height          = 0.0f;
+        int     currentFrame    = 0;
+        int     totalFrames     = 0;
+    };
+
+    void pushCommand(VIDEO_CMD type, float value=0.0f){
+        std::unique_lock<std::mutex> lck(mutex);
+        // continuous values (speed, volume, playhead) only need the latest one
+        if(type == VIDEO_CMD_SPEED || type == VIDEO_CMD_VOLUME || type == VIDEO_CMD_POSITION){
+            for(size_t i=0;i<commands.size();i++){
+                if(commands[i].type == type){
+                    commands[i].value = value;
+                    return;
+                }
+            }
+        }
+        Command c = { type, value };
+        commands.push_back(c);
+    }
+
+    // holding playerMutex
+    void applyCommands(){
+        for(size_t i=0;i<pendingCommands.size();i++){
+            const Command &c = pendingCommands[i];
+            switch(c.type){
+            case VIDEO_CMD_PLAY:        player.play(); break;
+            case VIDEO_CMD_STOP:        player.stop(); break;
+            case VIDEO_CMD_FIRST_FRAME: player.firstFrame(); break;
+            case VIDEO_CMD_PAUSE:       player.setPaused(c.value == 1.0f); break;
+            case VIDEO_CMD_SPEED:       player.setSpeed(c.value); break;
+            case VIDEO_CMD_VOLUME:      player.setVolume(c.value); break;
+            case VIDEO_CMD_POSITION:    player.setPosition(c.value); break;
+            case VIDEO_CMD_LOOP:        player.setLoopState(static_cast<ofLoopType>(static_cast<int>(c.value))); break;
+            }
+        }
+        pendingCommands.clear();
+    }
+
+    // position of the clip at group time t (seconds)
+    static double clipTime(double t, double duration, bool loop){
+        if(loop){
+            return fmod(t,duration);
+        }
+        return t < duration ? t : duration;
+    }
+
+    // holding playerMutex: follow the group transport, seek on a new epoch or a large drift,
+    // nudge the speed on a small one (the drift measured on the previous step)
+    void syncBeforeUpdate(){
+        syncTarget = ofxVPVideoSync::get().getTarget(activeGroup);
+        double duration = player.getDuration();
+        int total = player.getTotalNumFrames();
+        if(duration <= 0.0 || total <= 0){
+            return;
+        }
+        double frameTime = duration/total;
+        int targetFrame = ofClamp(static_cast<int>(clipTime(syncTarget.position,duration,syncTarget.loop)/frameTime),0,total-1);
+
+        ofLoopType loopState = syncTarget.loop ? OF_LOOP_NORMAL : OF_LOOP_NONE;
+        if(loopState != syncLoop){
+            player.setLoopState(loopState);
+            syncLoop = loopState;
+        }
+
+        bool newEpoch = syncTarget.epoch != syncEpoch;
+        bool ended = !syncTarget.loop && syncTarget.position >= duration;
+
+        if(syncTarget.state == VIDEO_SYNC_PLAYING && !ended){
+            if(!player.isPlaying()){
+                player.play();
+            }
+            if(player.isPaused()){
+                player.setPaused(false);
+            }
+            if(newEpoch || fabs(syncError) > VIDEO_SYNC_RESYNC_FRAMES*frameTime){
+                if(!newEpoch){
+                    ofxVPVideoSync::get().countCorrection(activeGroup,true);
+                }
+                seekFrame(targetFrame);
+            }else{
+                float speed = syncTarget.speed;
+                double drift = fabs(syncError);
+                // keep nudging until back within a quarter of a frame
+                if(speed > 0.0f && (drift > VIDEO_SYNC_NUDGE_FRAMES*frameTime || (syncSpeed != speed && drift > 0.25*frameTime))){
+                    speed *= syncError > 0.0 ? 1.0f-VIDEO_SYNC_NUDGE : 1.0f+VIDEO_SYNC_NUDGE;
+                }
+                if(speed != syncSpeed){
+                    player.setSpeed(speed);
+                    if(speed != syncTarget.speed){
+                        ofxVPVideoSync::get().countCorrection(activeGroup,false);
+                    }
+                    syncSpeed = speed;
+                }
+            }
+        }else if(syncTarget.state != VIDEO_SYNC_PLAYING){
+            // stopped, paused or prerolling: hold the exact target frame
+            if(!player.isPaused()){
+                player.setPaused(true);
+            }
+            if(newEpoch){
+                seekFrame(targetFrame);
+            }
+        }
+    }
+
+    // holding playerMutex: preroll completion and drift measure, reported to the group
+    void syncAfterUpdate(){
+        double duration = player.getDuration();
+        int total = player.getTotalNumFrames();
+        if(duration <= 0.0 || total <= 0){
+            return;
+        }
+
+        if(prerollPending && (player.isFrameNew() || player.getCurrentFrame() == prerollFrame)){
+            prerollPending = false;
+            prerolledEpoch = syncEpoch;
+        }
+
+        // the position is stale until a seek lands
+        syncError = 0.0;
+        if(syncTarget.state == VIDEO_SYNC_PLAYING && !prerollPending){
+            ofxVPVideoSyncTarget now = ofxVPVideoSync::get().getTarget(activeGroup);
+            if(now.epoch == syncEpoch && (now.loop || now.position < duration)){
+                syncError = player.getPosition()*duration - clipTime(now.position,duration,now.loop);
+                if(now.loop){
+                    // around the loop point
+                    if(syncError > duration*0.5){
+                        syncError -= duration;
+                    }else if(syncError < -duration*0.5){
+                        syncError += duration;
+                    }
+                }
+            }
+        }
+        ofxVPVideoSync::get().report(activeGroup,this,prerolledEpoch,syncError);
+    }
+
+    // holding playerMutex
+    void seekFrame(int frame){
+        player.setFrame(frame);
+        syncEpoch       = syncTarget.epoch;
+        prerollFrame    = frame;
+        prerollPending  = true;
+        syncError       = 0.0;
+    }
+
+    // holding playerMutex: copy the new frame into a free buffer of the queue
+    void queueFrame(uint64_t start){
+        // same size frames reuse the buffer allocation
+        frames.beginWrite() = player.getPixels();
+        frames.endWrite();
+
+        float decodeMs = static_cast<float>(ofGetElapsedTimeMicros()-start)/1000.0f;
+        std::unique_lock<std::mutex> lck(mutex);
+        stats.framesDecoded++;
+        stats.decodeMs = stats.framesDecoded > 1 ? stats.decodeMs*0.9f + decodeMs*0.1f : decodeMs;
+        stats.decodeMaxMs = std::max(stats.decodeMaxMs,decodeMs);
+    }
+
+    // holding playerMutex and mutex
+    void takeSnapshot(){
+        state.loaded = player.isLoaded();
+        if(state.loaded){
+            state.playing       = player.isPlaying();
+            state.paused        = player.isPaused();
+            state.position      = player.getPosition();
+            state.duration      = player.getDuration();
+            state.width         = player.getWidth();
+            state.height        = player.getHeight();
+            state.currentFrame  = player.getCurrentFrame();
+            state.totalFrames   = player.getTotalNumFrames();
+        }else{
+            state = PlayerState();
+        }
+    }
+
+    ofVideoPlayer       player;
+    std::mutex          playerMutex;    // the player, always taken before mutex
+    std::mutex          mutex;
+
+    ofxVPFrameQueue     frames;
+
+    // guarded by mutex
+    vector<Command>     commands;
+    PlayerState         state;
+    VideoDecodeStats    stats;
+
+    int                 syncGroup;      // written by the main thread only
+
+    // decode step only (playerMutex)
+    vector<Command>     pendingCommands;
+    int                 activeGroup;
+    ofxVPVideoSyncTarget syncTarget;
+    uint32_t            syncEpoch;      // epoch of the last seek
+    uint32_t            prerolledEpoch; // epoch of the last landed seek
+    bool                prerollPending;
+    int                 prerollFrame;
+    double              syncError;
+    float               syncSpeed;
+    ofLoopType          syncLoop;
+
+    friend class VideoDecodePool;
+    bool                decoding;       // guarded by the pool mutex
+};
+
+/// \class VideoDecodePool
+/// \brief decode threads shared by every ThreadedVideoDecoder
+///
+/// a few threads (half the cores, at most VIDEO_DECODE_MAX_THREADS) run the
+/// due decode steps, earliest first; a decoder is stepped by one thread at a
+/// time, so many clips decode in parallel without a thread each.
+class VideoDecodePool{
+
+public:
+
+    static VideoDecodePool& get(){
+        static VideoDecodePool pool;
+        return pool;
+    }
+
+    void add(ThreadedVideoDecoder *decoder){
+        std::unique_lock<std::mutex> lck(mutex);
+        if(threads.empty()){
+            int numThreads = ofClamp(static_cast<int>(std::thread::hardware_concurrency()/2),1,VIDEO_DECODE_MAX_THREADS);
+            running = true;
+            for(int i=0;i<numThreads;i++){
+                threads.push_back(std::thread(&VideoDecodePool::run,this));
+            }
+        }
+        Job job = { decoder, 0 };
+        jobs.push_back(job);
+        condition.notify_all();
+    }
+
+    // returns once no thread is stepping the decoder
+    void remove(ThreadedVideoDecoder *decoder){
+        std::unique_lock<std::mutex> lck(mutex);
+        condition.wait(lck,[decoder]{ return !decoder->decoding; });
+        for(size_t i=0;i<jobs.size();i++){
+            if(jobs[i].decoder == decoder){
+                jobs.erase(jobs.begin()+i);
+                break;
+            }
+        }
+    }
+
+    int getNumThreads(){
+        std::unique_lock<std::mutex> lck(mutex);
+        return static_cast<int>(threads.size());
+    }
+
+protected:
+
+    VideoDecodePool(){
+        running = false;
+    }
+
+    ~VideoDecodePool(){
+        {
+            std::unique_lock<std::mutex> lck(mutex);
+            running = false;
+            condition.notify_all();
+        }
+        for(size_t i=0;i<threads.size();i++){
+            threads[i].join();
+        }
+    }
+
+    struct Job {
+        ThreadedVideoDecoder    *decoder;
+        uint64_t                due;        // micros
+    };
+
+    void run(){
+        std::unique_lock<std::mutex> lck(mutex);
+        while(running){
+            uint64_t now = ofGetElapsedTimeMicros();
+            uint64_t wake = now + VIDEO_DECODE_MAX_SLEEP*1000;
+            int next = -1;
+            for(size_t i=0;i<jobs.size();i++){
+                if(jobs[i].decoder->decoding){
+                    continue;
+                }
+                if(jobs[i].due <= now){
+                    if(next == -1 || jobs[i].due < jobs[next].due){
+                        next = static_cast<int>(i);
+                    }
+                }else if(jobs[i].due < wake){
+                    wake = jobs[i].due;
+                }
+            }
+            if(next == -1){
+                condition.wait_for(lck,std::chrono::microseconds(wake-now));
+                continue;
+            }
+
+            ThreadedVideoDecoder *decoder = jobs[next].decoder;
+            decoder->decoding = true;
+            lck.unlock();
+            int sleepMs = decoder->service();
+            lck.lock();
+            decoder->decoding = false;
+            for(size_t i=0;i<jobs.size();i++){
+                if(jobs[i].decoder == decoder){
+                    jobs[i].due = ofGetElapsedTimeMicros() + static_cast<uint64_t>(sleepMs)*1000;
+                    break;
+                }
+            }
+            condition.notify_all();
+        }
+    }
+
+    std::mutex                  mutex;
+    std::condition_variable     condition;
+    vector<Job>                 jobs;
+    vector<std::thread>         threads;
+    bool                        running;
+};
+
+//--------------------------------------------------------------
+inline void ThreadedVideoDecoder::setup(){
+    VideoDecodePool::get().add(this);
+}
+
+//--------------------------------------------------------------
+inline void ThreadedVideoDecoder::stopDecoding(){
+    VideoDecodePool::get().remove(this);
+}
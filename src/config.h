@@ -61,6 +61,18 @@
 #define HEADER_HEIGHT           16
 #define MAX_INLETS              32
 #define MAX_OUTLETS             32
+// string/array outlets up to this size are compared with their last content for change detection (render on demand only)
+#define MAX_OUTLET_SNAPSHOT_BYTES 65536
+
+enum LINK_TYPE {
+    VP_LINK_NUMERIC,
+    VP_LINK_STRING,
+    VP_LINK_ARRAY,
+    VP_LINK_TEXTURE,
+    VP_LINK_AUDIO,
+    VP_LINK_SPECIAL,
+    VP_LINK_PIXELS
+};
 
 #define COLOR_NUMERIC_LINK      ofColor(210,210,210,255)
 #define COLOR_STRING_LINK       ofColor(200,180,255,255)
@@ -0,0 +1,144 @@
+//
+//  audioClock.cpp
+//  ofxVisualProgramming
+//
+
+#include "audioClock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+// audio is considered stopped after this many seconds without a block
+#define AUDIO_CLOCK_TIMEOUT 0.25
+
+//--------------------------------------------------------------
+ofxVPAudioClock& ofxVPAudioClock::get(){
+    static ofxVPAudioClock clock;
+    return clock;
+}
+
+//--------------------------------------------------------------
+ofxVPAudioClock::ofxVPAudioClock(){
+    sequence        = 0;
+    blockSamples    = 0;
+    blockWall       = 0;
+    blockSize       = 0;
+    blockSampleRate = 0;
+    sampleCount     = 0;
+
+    lastNow         = 0.0;
+    audioOffset     = 0.0;
+    wallStart       = wallNow();
+    wallOffset      = -static_cast<double>(wallStart)*1e-9;
+    audioDriven     = false;
+    offlineMode     = false;
+}
+
+//--------------------------------------------------------------
+int64_t ofxVPAudioClock::wallNow(){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//--------------------------------------------------------------
+void ofxVPAudioClock::advance(int bufferSize, int sampleRate){
+    uint64_t start = sampleCount.fetch_add(static_cast<uint64_t>(bufferSize),std::memory_order_relaxed);
+
+    sequence.fetch_add(1,std::memory_order_acq_rel);
+    blockSamples.store(start,std::memory_order_relaxed);
+    blockWall.store(wallNow(),std::memory_order_relaxed);
+    blockSize.store(bufferSize,std::memory_order_relaxed);
+    blockSampleRate.store(sampleRate,std::memory_order_relaxed);
+    sequence.fetch_add(1,std::memory_order_release);
+}
+
+//--------------------------------------------------------------
+bool ofxVPAudioClock::readBlock(Block &b) const{
+    for(int tries=0;tries<16;tries++){
+        uint32_t s0 = sequence.load(std::memory_order_acquire);
+        if(s0 & 1){
+            continue;
+        }
+        b.samples       = blockSamples.load(std::memory_order_relaxed);
+        b.wallNanos     = blockWall.load(std::memory_order_relaxed);
+        b.size          = blockSize.load(std::memory_order_relaxed);
+        b.sampleRate    = blockSampleRate.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(sequence.load(std::memory_order_relaxed) == s0){
+            return b.sampleRate > 0;
+        }
+    }
+    return false;
+}
+
+//--------------------------------------------------------------
+double ofxVPAudioClock::now(){
+    std::lock_guard<std::mutex> lck(mutex);
+
+    int64_t wall = wallNow();
+    Block b;
+    bool audio = readBlock(b) && (offlineMode.load(std::memory_order_relaxed) || (wall - b.wallNanos)*1e-9 < AUDIO_CLOCK_TIMEOUT);
+
+    double t;
+    if(audio){
+        // samples played since the block start, at most one block ahead (the whole block when offline)
+        double ahead = offlineMode.load(std::memory_order_relaxed) ? static_cast<double>(b.size) : std::min(static_cast<double>(wall - b.wallNanos)*1e-9*b.sampleRate,static_cast<double>(b.size));
+        double samplesTime = (static_cast<double>(b.samples) + ahead)/b.sampleRate;
+        if(!audioDriven){
+            // keep going from where the system clock was
+            audioOffset = lastNow - samplesTime;
+            audioDriven = true;
+        }
+        t = samplesTime + audioOffset;
+    }else{
+        double wallTime = static_cast<double>(wall)*1e-9;
+        if(audioDriven){
+            wallOffset = lastNow - wallTime;
+            audioDriven = false;
+        }
+        t = wallTime + wallOffset;
+    }
+
+    lastNow = std::max(t,lastNow);
+    return lastNow;
+}
+
+//--------------------------------------------------------------
+void ofxVPAudioClock::setOffline(bool offline){
+    offlineMode.store(offline,std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------
+bool ofxVPAudioClock::waitForAudio(uint64_t afterSamples, double timeout){
+    // polled: the audio thread never notifies anyone, it only bumps the sample counter
+    int64_t deadline = wallNow() + static_cast<int64_t>(timeout*1e9);
+    while(sampleCount.load(std::memory_order_relaxed) <= afterSamples){
+        if(wallNow() > deadline){
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(250));
+    }
+    return true;
+}
+
+//--------------------------------------------------------------
+bool ofxVPAudioClock::isAudioDriven(){
+    std::lock_guard<std::mutex> lck(mutex);
+    return audioDriven;
+}
+
+//--------------------------------------------------------------
+double ofxVPAudioClock::samplePosition(double time) const{
+    return (time - audioOffset.load(std::memory_order_relaxed))*blockSampleRate.load(std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------
+int ofxVPAudioClock::sampleOffset(double time, uint64_t blockStart, int bufferSize) const{
+    int sr = blockSampleRate.load(std::memory_order_relaxed);
+    if(sr <= 0 || bufferSize <= 0){
+        return 0;
+    }
+    double offset = samplePosition(time) - static_cast<double>(blockStart);
+    return static_cast<int>(std::max(0.0,std::min(std::floor(offset),static_cast<double>(bufferSize-1))));
+}
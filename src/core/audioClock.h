@@ -0,0 +1,111 @@
+//
+//  audioClock.h
+//  ofxVisualProgramming
+//
+//  Patch wide time base driven by the sample counter of the audio callback.
+//  Timing objects schedule their events on it instead of comparing
+//  ofGetElapsedTimeMillis() once per frame, so events keep their exact
+//  intended time (sent along with the bang, see PatchObject::_outletTimes)
+//  and periodic events never drift when the frame rate drops.
+//
+//  Between two audio blocks the position is interpolated with the system
+//  clock; with no audio running (dsp off) the clock follows the system
+//  clock alone, without jumping back when switching from one to the other.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+class ofxVPAudioClock {
+
+public:
+
+    static ofxVPAudioClock& get();
+
+    // audio thread, once per processed block
+    void        advance(int bufferSize, int sampleRate);
+
+    // seconds since the clock started, monotonic
+    double      now();
+
+    uint64_t    getSampleCount() const { return sampleCount.load(std::memory_order_relaxed); }
+    int         getSampleRate() const { return blockSampleRate.load(std::memory_order_relaxed); }
+    // true while the audio callback is running
+    bool        isAudioDriven();
+    // stream start handshake: returns as soon as a block past sample 'afterSamples' was processed,
+    // false if none came within timeout seconds (no device, stream failed)
+    bool        waitForAudio(uint64_t afterSamples, double timeout);
+
+    // offline rendering: time is the processed sample count only, the system clock is ignored
+    void        setOffline(bool offline);
+    bool        isOffline() const { return offlineMode.load(std::memory_order_relaxed); }
+
+    // intended time of an incoming event: its timestamp when it carries a recent one
+    // (set by the sender through _outletTimes), the current time otherwise
+    static double eventTime(double stamp, double clockNow){
+        return (stamp > 0.0 && stamp <= clockNow && clockNow - stamp < 0.25) ? stamp : clockNow;
+    }
+
+    // sample count at the start of the last processed block
+    uint64_t    getBlockStart() const { return blockSamples.load(std::memory_order_relaxed); }
+    // position of a clock time in samples (same origin as getSampleCount())
+    double      samplePosition(double time) const;
+
+    // sample offset of a clock time in the block that starts at blockStart (sample count),
+    // clamped to [0,bufferSize-1], for sample accurate consumers on the audio thread
+    int         sampleOffset(double time, uint64_t blockStart, int bufferSize) const;
+
+protected:
+
+    ofxVPAudioClock();
+
+    struct Block {
+        uint64_t    samples;    // sample count at the start of the block
+        int64_t     wallNanos;  // system clock when the block was processed
+        int         size;
+        int         sampleRate;
+    };
+
+    bool        readBlock(Block &b) const;
+    static int64_t wallNow();
+
+    // last block, written by the audio thread (seqlock)
+    std::atomic<uint32_t>   sequence;
+    std::atomic<uint64_t>   blockSamples;
+    std::atomic<int64_t>    blockWall;
+    std::atomic<int>        blockSize;
+    std::atomic<int>        blockSampleRate;
+    std::atomic<uint64_t>   sampleCount;
+
+    // reader state
+    std::mutex              mutex;
+    double                  lastNow;
+    std::atomic<double>     audioOffset;    // clock time of sample 0
+    double                  wallOffset;     // clock time of wall clock 0
+    bool                    audioDriven;
+    int64_t                 wallStart;
+    std::atomic<bool>       offlineMode;
+};
+
+// one shot event on the audio clock
+struct ofxVPClockTimer {
+
+    double      next = -1.0;    // intended time of the pending event, < 0 when idle
+
+    void        schedule(double time) { next = time; }
+    void        cancel() { next = -1.0; }
+    bool        isPending() const { return next >= 0.0; }
+
+    // true once the clock reached the event, time receives its intended timestamp
+    bool        elapsed(double clockNow, double &time){
+        if(next >= 0.0 && clockNow >= next){
+            time = next;
+            next = -1.0;
+            return true;
+        }
+        return false;
+    }
+};
@@ -0,0 +1,171 @@
+//
+//  controlSignal.cpp
+//  ofxVisualProgramming
+//
+
+#include "controlSignal.h"
+
+#include <algorithm>
+#include <cmath>
+
+// events mapped further than this in the future come from a stale clock mapping and are applied at once
+#define CONTROL_SIGNAL_MAX_AHEAD 0.25
+
+//--------------------------------------------------------------
+ofxVPControlSignal::ofxVPControlSignal(){
+    head            = 0;
+    tail            = 0;
+    overflowValue   = 0.0f;
+    overflow        = false;
+    slewMs          = 0.0f;
+
+    lastSet         = 0.0f;
+    lastTime        = 0.0;
+
+    sampleRate      = 44100.0;
+    current         = 0.0f;
+    target          = 0.0f;
+    step            = 0.0f;
+    rampLeft        = 0;
+
+    addOutput("signal", output);
+    updateOutputNodes();
+
+    if(dynamicConstruction){
+        prepareToPlay(globalBufferSize, globalSampleRate);
+    }
+}
+
+//--------------------------------------------------------------
+pdsp::Patchable& ofxVPControlSignal::out_signal(){
+    return out("signal");
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::set(float value){
+    // objects push their controls every frame, only changes go to the audio thread
+    if(value == lastSet){
+        return;
+    }
+    set(value,ofxVPAudioClock::get().now());
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::set(float value, double time){
+    lastSet     = value;
+    // keep the queue ordered in time
+    lastTime    = std::max(time,lastTime);
+
+    // once a value overflowed, the next ones overwrite it until the audio thread applies it, so the
+    // overflow value always stays newer than everything in the queue
+    size_t h = head.load(std::memory_order_relaxed);
+    if(overflow.load(std::memory_order_acquire) || h - tail.load(std::memory_order_acquire) >= CONTROL_SIGNAL_QUEUE_SIZE){
+        overflowValue.store(value,std::memory_order_relaxed);
+        overflow.store(true,std::memory_order_release);
+        return;
+    }
+    queue[h & (CONTROL_SIGNAL_QUEUE_SIZE-1)] = {lastTime, value};
+    head.store(h+1,std::memory_order_release);
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::enableSmoothing(float timeMs){
+    slewMs.store(std::max(timeMs,0.0f),std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::disableSmoothing(){
+    slewMs.store(0.0f,std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::prepareUnit( int expectedBufferSize, double sampleRate ){
+    this->sampleRate = sampleRate;
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::releaseResources(){
+
+}
+
+//--------------------------------------------------------------
+int ofxVPControlSignal::eventOffset(const Event &e, int bufferSize) const{
+    const ofxVPAudioClock &clock = ofxVPAudioClock::get();
+    if(clock.getSampleRate() <= 0){
+        return 0;
+    }
+    // one block of latency, so events of the last frame keep their spacing inside this block
+    double pos = clock.samplePosition(e.time) + bufferSize - static_cast<double>(clock.getBlockStart());
+    if(pos < bufferSize){
+        return std::max(0,static_cast<int>(pos));
+    }
+    if(pos - bufferSize > CONTROL_SIGNAL_MAX_AHEAD*clock.getSampleRate()){
+        return 0;
+    }
+    return -1;
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::apply(float value){
+    target = value;
+    int slewSamples = static_cast<int>(slewMs.load(std::memory_order_relaxed)*0.001*sampleRate);
+    if(slewSamples > 0 && target != current){
+        step        = (target - current)/slewSamples;
+        rampLeft    = slewSamples;
+    }else{
+        current     = target;
+        rampLeft    = 0;
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::render(float *buffer, int from, int to){
+    for(int i=from;i<to;i++){
+        if(rampLeft > 0){
+            current += step;
+            if(--rampLeft == 0){
+                current = target;
+            }
+        }
+        buffer[i] = current;
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPControlSignal::process (int bufferSize) noexcept {
+    float *buffer = nullptr;
+    int pos = 0;
+
+    size_t t = tail.load(std::memory_order_relaxed);
+    while(t != head.load(std::memory_order_acquire)){
+        const Event &e = queue[t & (CONTROL_SIGNAL_QUEUE_SIZE-1)];
+        int at = eventOffset(e,bufferSize);
+        if(at < 0){
+            break;
+        }
+        if(buffer == nullptr){
+            buffer = getOutputBufferToFill(output);
+        }
+        at = std::max(at,pos);
+        render(buffer,pos,at);
+        pos = at;
+        apply(e.value);
+        t++;
+        tail.store(t,std::memory_order_release);
+    }
+
+    // the overflow value is newer than anything in the queue
+    if(t == head.load(std::memory_order_acquire) && overflow.exchange(false,std::memory_order_acquire)){
+        apply(overflowValue.load(std::memory_order_relaxed));
+    }
+
+    if(buffer == nullptr && rampLeft == 0){
+        // steady value, no need for a full buffer
+        setControlRateOutput(output, current);
+        return;
+    }
+    if(buffer == nullptr){
+        buffer = getOutputBufferToFill(output);
+    }
+    render(buffer,pos,bufferSize);
+}
@@ -0,0 +1,81 @@
+//
+//  controlSignal.h
+//  ofxVisualProgramming
+//
+//  Drop-in replacement of pdsp::ValueControl for the sound objects.
+//  Values set from the patch (main thread) are timestamped on the audio
+//  clock and travel to the audio thread through a lock-free queue; each
+//  one is applied at its own sample inside the block, one block later,
+//  then ramped with the parameter slew. Modulation coming from the patch
+//  is no longer quantized to the frame rate (no zipper noise).
+//
+
+#pragma once
+
+#include "ofxPDSP.h"
+
+#include "audioClock.h"
+
+#include <atomic>
+
+#define CONTROL_SIGNAL_QUEUE_SIZE   128 // power of two
+
+class ofxVPControlSignal : public pdsp::Unit {
+
+public:
+
+    ofxVPControlSignal();
+
+    pdsp::Patchable&    out_signal();
+
+    // main thread
+    void                set(float value);
+    // apply the value at a given audio clock time (ex. the timestamp of the bang that produced it)
+    void                set(float value, double time);
+    // last value set
+    float               get() const { return lastSet; }
+
+    // linear slew from the previous value, per parameter
+    void                enableSmoothing(float timeMs);
+    void                disableSmoothing();
+
+private:
+
+    struct Event {
+        double          time;
+        float           value;
+    };
+
+    void                prepareUnit( int expectedBufferSize, double sampleRate ) override;
+    void                releaseResources () override;
+    void                process (int bufferSize) noexcept override;
+
+    // sample of the current block where the event applies, -1 if it belongs to a later block
+    int                 eventOffset(const Event &e, int bufferSize) const;
+    void                apply(float value);
+    void                render(float *buffer, int from, int to);
+
+    pdsp::OutputNode    output;
+
+    // single producer (patch) / single consumer (audio) ring
+    Event               queue[CONTROL_SIGNAL_QUEUE_SIZE];
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+    // latest value that didn't fit in a full queue, set() queues nothing else until it is applied
+    std::atomic<float>  overflowValue;
+    std::atomic<bool>   overflow;
+
+    std::atomic<float>  slewMs;
+
+    // main thread
+    float               lastSet;
+    double              lastTime;
+
+    // audio thread
+    double              sampleRate;
+    float               current;
+    float               target;
+    float               step;
+    int                 rampLeft;
+
+};
@@ -0,0 +1,224 @@
+//
+//  fboPool.cpp
+//  ofxVisualProgramming
+//
+
+#include "fboPool.h"
+
+//--------------------------------------------------------------
+ofxVPFboPool& ofxVPFboPool::get(){
+    static ofxVPFboPool pool;
+    return pool;
+}
+
+//--------------------------------------------------------------
+ofxVPFboPool::ofxVPFboPool(){
+    frame       = 0;
+    allocations = 0;
+    reuses      = 0;
+}
+
+//--------------------------------------------------------------
+size_t ofxVPFboPool::getBytes(const ofxVPFboKey &key){
+    int glFormat = ofGetGLFormatFromInternal(key.internalFormat);
+    int glType = ofGetGLTypeFromInternal(key.internalFormat);
+    size_t bytes = static_cast<size_t>(key.width*key.height)*ofGetNumChannelsFromGLFormat(glFormat)*ofGetBytesPerChannelFromGLType(glType);
+    // multisampled: the samples renderbuffer plus the resolved texture
+    return key.numSamples > 0 ? bytes*(key.numSamples+1) : bytes;
+}
+
+//--------------------------------------------------------------
+ofFbo* ofxVPFboPool::take(const ofxVPFboKey &key, TargetState state, int ownerID){
+    Bucket &bucket = buckets[key];
+
+    for(size_t i=0;i<bucket.targets.size();i++){
+        if(bucket.targets[i].state == TARGET_FREE){
+            bucket.targets[i].state     = state;
+            bucket.targets[i].ownerID   = ownerID;
+            reuses++;
+            return bucket.targets[i].fbo;
+        }
+    }
+
+    ofFbo *fbo = new ofFbo();
+    fbo->allocate(key.width,key.height,key.internalFormat,key.numSamples);
+    Target t = { fbo, state, ownerID, frame };
+    bucket.targets.push_back(t);
+    index[fbo] = key;
+    allocations++;
+    return fbo;
+}
+
+//--------------------------------------------------------------
+ofxVPFboPool::Target* ofxVPFboPool::find(ofFbo *fbo, Bucket **bucket){
+    auto it = index.find(fbo);
+    if(it == index.end()){
+        return nullptr;
+    }
+    Bucket &b = buckets[it->second];
+    for(size_t i=0;i<b.targets.size();i++){
+        if(b.targets[i].fbo == fbo){
+            *bucket = &b;
+            return &b.targets[i];
+        }
+    }
+    return nullptr;
+}
+
+//--------------------------------------------------------------
+ofFbo* ofxVPFboPool::acquire(int width, int height, int internalFormat, int numSamples, int ownerID){
+    ofxVPFboKey key = { width, height, internalFormat, numSamples };
+    ofFbo *fbo = take(key,TARGET_HELD,ownerID);
+
+    // a reused target keeps the content of its previous owner
+    fbo->begin();
+    ofClear(0,0,0,0);
+    fbo->end();
+
+    return fbo;
+}
+
+//--------------------------------------------------------------
+void ofxVPFboPool::release(ofFbo *fbo){
+    if(fbo == nullptr){
+        return;
+    }
+    Bucket *bucket = nullptr;
+    Target *t = find(fbo,&bucket);
+    if(t == nullptr || t->state != TARGET_HELD){
+        return;
+    }
+    t->state    = TARGET_RELEASED;
+    t->ownerID  = -1;
+    t->frame    = frame;
+}
+
+//--------------------------------------------------------------
+ofFbo* ofxVPFboPool::acquireTransient(int width, int height, int internalFormat, int numSamples){
+    ofxVPFboKey key = { width, height, internalFormat, numSamples };
+    ofFbo *fbo = take(key,TARGET_TRANSIENT,-1);
+
+    Bucket &bucket = buckets[key];
+    bucket.transientOut++;
+    bucket.transientRequests++;
+    bucket.transientPeak = std::max(bucket.transientPeak,bucket.transientOut);
+
+    return fbo;
+}
+
+//--------------------------------------------------------------
+void ofxVPFboPool::releaseTransient(ofFbo *fbo){
+    if(fbo == nullptr){
+        return;
+    }
+    Bucket *bucket = nullptr;
+    Target *t = find(fbo,&bucket);
+    if(t == nullptr || t->state != TARGET_TRANSIENT){
+        return;
+    }
+    // the draw using it is done, the next one can take it right away
+    t->state    = TARGET_FREE;
+    t->frame    = frame;
+    bucket->transientOut--;
+}
+
+//--------------------------------------------------------------
+void ofxVPFboPool::update(){
+    frame++;
+
+    for(auto it = buckets.begin(); it != buckets.end();){
+        Bucket &bucket = it->second;
+
+        size_t kept = 0;
+        for(size_t i=0;i<bucket.targets.size();i++){
+            Target &t = bucket.targets[i];
+            if(t.state == TARGET_TRANSIENT){
+                t.state = TARGET_FREE;
+                t.frame = frame;
+            }else if(t.state == TARGET_RELEASED && frame - t.frame >= FBO_POOL_RELEASE_FRAMES){
+                t.state = TARGET_FREE;
+            }else if(t.state == TARGET_FREE && frame - t.frame >= FBO_POOL_TRIM_FRAMES){
+                index.erase(t.fbo);
+                delete t.fbo;
+                continue;
+            }
+            bucket.targets[kept++] = t;
+        }
+        bucket.targets.erase(bucket.targets.begin()+kept,bucket.targets.end());
+
+        bucket.lastTransientRequests    = bucket.transientRequests;
+        bucket.lastTransientPeak        = bucket.transientPeak;
+        bucket.transientOut             = 0;
+        bucket.transientRequests        = 0;
+        bucket.transientPeak            = 0;
+
+        if(bucket.targets.empty()){
+            it = buckets.erase(it);
+        }else{
+            it++;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+size_t ofxVPFboPool::getOwnerBytes(int ownerID) const{
+    size_t bytes = 0;
+    for(auto it = buckets.begin(); it != buckets.end(); it++){
+        for(size_t i=0;i<it->second.targets.size();i++){
+            if(it->second.targets[i].state == TARGET_HELD && it->second.targets[i].ownerID == ownerID){
+                bytes += getBytes(it->first);
+            }
+        }
+    }
+    return bytes;
+}
+
+//--------------------------------------------------------------
+ofxVPFboPoolStats ofxVPFboPool::getStats() const{
+    ofxVPFboPoolStats stats;
+    for(auto it = buckets.begin(); it != buckets.end(); it++){
+        size_t bytes = getBytes(it->first);
+        size_t held = 0;
+        for(size_t i=0;i<it->second.targets.size();i++){
+            switch(it->second.targets[i].state){
+                case TARGET_HELD:
+                    held++;
+                    stats.heldBytes += bytes;
+                    break;
+                case TARGET_TRANSIENT:
+                    stats.transientBytes += bytes;
+                    break;
+                default:
+                    stats.freeBytes += bytes;
+                    break;
+            }
+        }
+        stats.targets       += it->second.targets.size();
+        stats.bytes         += it->second.targets.size()*bytes;
+        stats.unpooledBytes += (held + it->second.lastTransientRequests)*bytes;
+    }
+    stats.allocations   = allocations;
+    stats.reuses        = reuses;
+    return stats;
+}
+
+//--------------------------------------------------------------
+vector<ofxVPFboKeyStats> ofxVPFboPool::getKeyStats() const{
+    vector<ofxVPFboKeyStats> keyStats;
+    for(auto it = buckets.begin(); it != buckets.end(); it++){
+        ofxVPFboKeyStats ks;
+        ks.key                  = it->first;
+        ks.bytes                = getBytes(it->first);
+        ks.transientRequests    = it->second.lastTransientRequests;
+        ks.transientPeak        = it->second.lastTransientPeak;
+        for(size_t i=0;i<it->second.targets.size();i++){
+            if(it->second.targets[i].state == TARGET_HELD){
+                ks.held++;
+            }else if(it->second.targets[i].state != TARGET_TRANSIENT){
+                ks.free++;
+            }
+        }
+        keyStats.push_back(ks);
+    }
+    return keyStats;
+}
@@ -0,0 +1,127 @@
+//
+//  fboPool.h
+//  ofxVisualProgramming
+//
+//  Shared render targets of the FBO based objects, keyed by size,
+//  internal format and samples. Two kinds of targets:
+//
+//  - held targets (acquire()/release()): owned by an object until it
+//    releases them (resize, removal). Their texture is usually sent
+//    through an outlet, so a released target becomes reusable only
+//    after FBO_POOL_RELEASE_FRAMES calls to update(), like the port
+//    buffers.
+//  - transient targets (acquireTransient()/releaseTransient()):
+//    scratch targets used inside a single object draw and given back
+//    as soon as the draw is done. They are reusable at once, so every
+//    object of the graph drawing an intermediate pass of the same size
+//    shares the same few FBOs. Never send them through an outlet.
+//
+//  Free targets unused for FBO_POOL_TRIM_FRAMES frames are destroyed.
+//  GL main thread only.
+//
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <map>
+
+// frames a released held target waits before being reused (outlet textures alias it)
+#define FBO_POOL_RELEASE_FRAMES     2
+// frames a free target is kept before being destroyed
+#define FBO_POOL_TRIM_FRAMES        300
+
+struct ofxVPFboKey {
+    int     width;
+    int     height;
+    int     internalFormat;
+    int     numSamples;
+
+    bool operator<(const ofxVPFboKey &o) const {
+        if(width != o.width) return width < o.width;
+        if(height != o.height) return height < o.height;
+        if(internalFormat != o.internalFormat) return internalFormat < o.internalFormat;
+        return numSamples < o.numSamples;
+    }
+};
+
+// usage of one key, for the reuse analysis of the graph
+struct ofxVPFboKeyStats {
+    ofxVPFboKey key;
+    size_t      bytes               = 0;    // VRAM of one target
+    size_t      held                = 0;
+    size_t      free                = 0;    // released or free for reuse
+    size_t      transientRequests   = 0;    // last frame, one target each without the pool
+    size_t      transientPeak       = 0;    // last frame, targets really used at the same time
+};
+
+struct ofxVPFboPoolStats {
+    size_t      targets             = 0;    // allocated FBOs
+    size_t      bytes               = 0;
+    size_t      heldBytes           = 0;
+    size_t      transientBytes      = 0;
+    size_t      freeBytes           = 0;
+    size_t      unpooledBytes       = 0;    // held + every transient request of the last frame
+    size_t      allocations         = 0;    // since start
+    size_t      reuses              = 0;    // since start, acquisitions served by a pooled target
+};
+
+class ofxVPFboPool {
+
+public:
+
+    static ofxVPFboPool& get();
+
+    // a target held by ownerID (object id, -1 for none) until release(), cleared to transparent black
+    ofFbo*      acquire(int width, int height, int internalFormat=GL_RGBA, int numSamples=0, int ownerID=-1);
+    // nullptr and unknown targets are ignored
+    void        release(ofFbo *fbo);
+
+    // a scratch target for the current draw, content undefined
+    ofFbo*      acquireTransient(int width, int height, int internalFormat=GL_RGBA, int numSamples=0);
+    // transient targets still out at update() are given back there
+    void        releaseTransient(ofFbo *fbo);
+
+    // main thread, once per frame: recycles released targets, trims the unused ones
+    void        update();
+
+    size_t      getOwnerBytes(int ownerID) const;
+    ofxVPFboPoolStats getStats() const;
+    vector<ofxVPFboKeyStats> getKeyStats() const;
+
+    static size_t getBytes(const ofxVPFboKey &key);
+
+protected:
+
+    ofxVPFboPool();
+    // targets are not destroyed at exit: the GL context may be gone already
+    ~ofxVPFboPool() {}
+
+    enum TargetState { TARGET_FREE, TARGET_HELD, TARGET_RELEASED, TARGET_TRANSIENT };
+
+    struct Target {
+        ofFbo       *fbo;
+        TargetState state;
+        int         ownerID;
+        uint64_t    frame;          // of the last release, for the release delay and the trim
+    };
+
+    struct Bucket {
+        vector<Target>  targets;
+        size_t          transientOut;
+        size_t          transientRequests;
+        size_t          transientPeak;
+        size_t          lastTransientRequests;
+        size_t          lastTransientPeak;
+    };
+
+    ofFbo*      take(const ofxVPFboKey &key, TargetState state, int ownerID);
+    Target*     find(ofFbo *fbo, Bucket **bucket);
+
+    std::map<ofxVPFboKey,Bucket>    buckets;
+    std::map<ofFbo*,ofxVPFboKey>    index;
+    uint64_t                        frame;
+    size_t                          allocations;
+    size_t                          reuses;
+
+};
@@ -0,0 +1,94 @@
+//
+//  frameQueue.cpp
+//  ofxVisualProgramming
+//
+
+#include "frameQueue.h"
+
+//--------------------------------------------------------------
+ofxVPFrameQueue::ofxVPFrameQueue(int depth){
+    // + the current and the retired frames of the main thread
+    slots.resize(depth+2);
+    reset();
+}
+
+//--------------------------------------------------------------
+ofPixels& ofxVPFrameQueue::beginWrite(){
+    std::lock_guard<std::mutex> lck(mutex);
+    if(freeSlots.empty()){
+        // main thread is late, recycle the oldest queued frame
+        writing = ready.front();
+        ready.pop_front();
+        dropped++;
+    }else{
+        writing = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    return slots[writing];
+}
+
+//--------------------------------------------------------------
+void ofxVPFrameQueue::endWrite(){
+    std::lock_guard<std::mutex> lck(mutex);
+    if(writing != -1){
+        ready.push_back(writing);
+        writing = -1;
+    }
+}
+
+//--------------------------------------------------------------
+bool ofxVPFrameQueue::receive(){
+    std::lock_guard<std::mutex> lck(mutex);
+    if(ready.empty()){
+        return false;
+    }
+    if(retired != -1){
+        freeSlots.push_back(retired);
+    }
+    retired = current;
+    current = ready.back();
+    ready.pop_back();
+    // only the newest frame is shown, the older ones are late
+    while(!ready.empty()){
+        freeSlots.push_back(ready.front());
+        ready.pop_front();
+        dropped++;
+    }
+    return true;
+}
+
+//--------------------------------------------------------------
+const ofPixels& ofxVPFrameQueue::front() const{
+    return slots[current != -1 ? current : 0];
+}
+
+//--------------------------------------------------------------
+ofPixels* ofxVPFrameQueue::frontBuffer(){
+    return current != -1 ? &slots[current] : nullptr;
+}
+
+//--------------------------------------------------------------
+void ofxVPFrameQueue::reset(){
+    std::lock_guard<std::mutex> lck(mutex);
+    ready.clear();
+    freeSlots.clear();
+    for(int i=0;i<static_cast<int>(slots.size());i++){
+        freeSlots.push_back(i);
+    }
+    writing = -1;
+    current = -1;
+    retired = -1;
+    dropped = 0;
+}
+
+//--------------------------------------------------------------
+uint64_t ofxVPFrameQueue::getDropped() const{
+    std::lock_guard<std::mutex> lck(mutex);
+    return dropped;
+}
+
+//--------------------------------------------------------------
+int ofxVPFrameQueue::getQueued() const{
+    std::lock_guard<std::mutex> lck(mutex);
+    return static_cast<int>(ready.size());
+}
@@ -0,0 +1,59 @@
+//
+//  frameQueue.h
+//  ofxVisualProgramming
+//
+//  Single producer (decode/capture thread) to main thread queue of video
+//  frames in a fixed set of preallocated ofPixels, so a stream of same size
+//  frames never allocates. The main thread always takes the newest frame,
+//  older ones are dropped; if it can't keep up the producer overwrites the
+//  oldest queued frame.
+//
+//  The received frame can be shared with other objects without copy (ex.
+//  PatchObject::shareOutletBuffer()): it stays untouched by the producer
+//  until the second receive() after it, links refresh their pointers on
+//  every frame.
+//
+
+#pragma once
+
+#include "ofMain.h"
+
+#include <deque>
+#include <mutex>
+
+class ofxVPFrameQueue {
+
+public:
+
+    // depth: frames waiting for the main thread
+    ofxVPFrameQueue(int depth=3);
+
+    // PRODUCER: a free buffer to write the next frame into, then queue it
+    ofPixels&       beginWrite();
+    void            endWrite();
+
+    // MAIN THREAD: true if a new frame was queued since the last call, front() is then the newest one
+    bool            receive();
+    const ofPixels& front() const;
+    // front() without const, to share it as a buffer, nullptr before the first frame
+    ofPixels*       frontBuffer();
+
+    // drop every queued frame, the producer must not be writing
+    void            reset();
+
+    uint64_t        getDropped() const;
+    int             getQueued() const;
+
+protected:
+
+    vector<ofPixels>    slots;
+    std::deque<int>     ready;
+    vector<int>         freeSlots;
+    int                 writing;    // producer only
+    int                 current;    // main thread, the last received frame
+    int                 retired;    // main thread, the previous one, still possibly linked
+    uint64_t            dropped;
+
+    mutable std::mutex  mutex;
+
+};
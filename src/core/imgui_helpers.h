@@ -126,7 +126,7 @@ inline void drawTimecode(ImDrawList* drawList, int seconds, std::string pre="",
 }
 
 //--------------------------------------------------------------
-inline void drawWaveform(ImDrawList* drawList, ImVec2 dim, float* data, int dataSize, float thickness, ImU32 color, float retinaScale=1.0f){
+inline void drawWaveform(ImDrawList* drawList, ImVec2 dim, float* data, int dataSize, float thickness, ImU32 color, float retinaScale=1.0f, uint64_t version=0){
     // draw signal background
     drawList->AddRectFilled(ImGui::GetWindowPos(),ImGui::GetWindowPos()+dim,IM_COL32_BLACK);
 
@@ -135,6 +135,7 @@ inline void drawWaveform(ImDrawList* drawList, ImVec2 dim, float* data, int data
     conf.values.ys = data;
     conf.values.count = dataSize;
     conf.values.color = color;
+    conf.values.version = version;
     conf.scale.min = -1;
     conf.scale.max = 1;
     conf.tooltip.show = false;
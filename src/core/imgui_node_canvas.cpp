@@ -233,6 +233,13 @@ void ImGuiEx::NodeCanvas::End(){
 
     isAnyCanvasNodeHovered = ImGui::IsAnyWindowHovered(); // not really needed anymore...
 
+    // forget geometry of removed links
+    const int curFrame = ImGui::GetFrameCount();
+    for(std::map<int,LinkGeometry>::iterator it = linksGeometry.begin(); it != linksGeometry.end(); ){
+        if(it->second.lastFrame < curFrame - 60) it = linksGeometry.erase(it);
+        else ++it;
+    }
+
     // reset cursor pos to canvas window
     ImGui::SetCursorPos(ImGui::GetWindowContentRegionMin());
 
@@ -888,12 +895,22 @@ ImGuiEx::NodeConnectData ImGuiEx::NodeCanvas::AddNodePin( const int nodeID, cons
         nodeDrawList->AddCircleFilled(outletPinsPositions[nodeID][pinID], pinSpace * .5f, _color, 6);
 
         // draw links (OUTLETS to INLETS ONLY)
+        const ImRect canvasClip(canvasDrawList->GetClipRectMin(), canvasDrawList->GetClipRectMax());
+        const ImVec2 fromCanvas = (outletPinsPositions[nodeID][pinID] - canvasView.translation) / canvasView.scale;
+        const bool checkLinkSelection = ImGui::IsMouseClicked(0) && !isAnyCanvasNodeHovered;
+
         for(int i=0;i<_linksData.size();i++){
-            const LinkBezierData link_data = get_link_renderable(outletPinsPositions[nodeID][pinID], canvasView.translation+(_linksData.at(i)._toPinPosition*canvasView.scale), IMGUI_EX_NODE_LINK_LINE_SEGMENTS_PER_LENGTH);
+            const LinkGeometry& geometry = getLinkGeometry(_linksData.at(i)._linkID, fromCanvas, _linksData.at(i)._toPinPosition);
 
-            const bool is_hovered = is_mouse_hovering_near_link(link_data.bezier);
+            // hover test only on click, it's the only moment we need it
+            if(checkLinkSelection){
+                BezierCurve bezier;
+                bezier.p0 = canvasView.translation + geometry.controlPoints[0]*canvasView.scale;
+                bezier.p1 = canvasView.translation + geometry.controlPoints[1]*canvasView.scale;
+                bezier.p2 = canvasView.translation + geometry.controlPoints[2]*canvasView.scale;
+                bezier.p3 = canvasView.translation + geometry.controlPoints[3]*canvasView.scale;
+                const bool is_hovered = is_mouse_hovering_near_link(bezier);
 
-            if(ImGui::IsMouseClicked(0) && !isAnyCanvasNodeHovered){
                 if (is_hovered){
                     if (std::find(selected_links.begin(), selected_links.end(),_linksData.at(i)._linkID)==selected_links.end()){
                         selected_links.push_back(_linksData.at(i)._linkID);
@@ -906,13 +923,22 @@ ImGuiEx::NodeConnectData ImGuiEx::NodeCanvas::AddNodePin( const int nodeID, cons
                 }
             }
 
+            // off-screen link
+            const ImRect screenBounds(canvasView.translation + geometry.bounds.Min*canvasView.scale - ImVec2(IMGUI_EX_NODE_LINK_THICKNESS,IMGUI_EX_NODE_LINK_THICKNESS), canvasView.translation + geometry.bounds.Max*canvasView.scale + ImVec2(IMGUI_EX_NODE_LINK_THICKNESS,IMGUI_EX_NODE_LINK_THICKNESS));
+            if(!canvasClip.Overlaps(screenBounds)){
+                continue;
+            }
 
             ImU32 _tempColor = _color;
             if (std::find(selected_links.begin(), selected_links.end(),_linksData.at(i)._linkID)!=selected_links.end()){ // selected
                 _tempColor = IM_COL32(255,0,0,255);
             }
 
-            canvasDrawList->AddBezierCurve(link_data.bezier.p0, link_data.bezier.p1, link_data.bezier.p2, link_data.bezier.p3, _tempColor, IMGUI_EX_NODE_LINK_THICKNESS, link_data.num_segments);
+            linkScreenPoints.resize(geometry.points.Size);
+            for(int p=0;p<geometry.points.Size;p++){
+                linkScreenPoints[p] = canvasView.translation + geometry.points[p]*canvasView.scale;
+            }
+            canvasDrawList->AddPolyline(linkScreenPoints.Data, linkScreenPoints.Size, _tempColor, false, IMGUI_EX_NODE_LINK_THICKNESS);
         }
 
         // draw labels
@@ -959,6 +985,36 @@ ImGuiEx::NodeConnectData ImGuiEx::NodeCanvas::AddNodePin( const int nodeID, cons
     return connectData;
 }
 
+const ImGuiEx::LinkGeometry& ImGuiEx::NodeCanvas::getLinkGeometry(const int linkID, const ImVec2& _from, const ImVec2& _to){
+    LinkGeometry& geometry = linksGeometry[linkID];
+    geometry.lastFrame = ImGui::GetFrameCount();
+
+    // endpoints are in canvas space, so panning never invalidates the cache
+    const float epsilon = 0.01f;
+    if(geometry.points.Size > 0 && geometry.scale == canvasView.scale && ImLengthSqr(geometry.from - _from) < epsilon && ImLengthSqr(geometry.to - _to) < epsilon){
+        return geometry;
+    }
+
+    geometry.from = _from;
+    geometry.to = _to;
+    geometry.scale = canvasView.scale;
+
+    // same curve as get_link_renderable(), in canvas units
+    const LinkBezierData link_data = get_link_renderable(_from, _to, IMGUI_EX_NODE_LINK_LINE_SEGMENTS_PER_LENGTH * canvasView.scale);
+    geometry.controlPoints[0] = link_data.bezier.p0;
+    geometry.controlPoints[1] = link_data.bezier.p1;
+    geometry.controlPoints[2] = link_data.bezier.p2;
+    geometry.controlPoints[3] = link_data.bezier.p3;
+    geometry.bounds = get_containing_rect_for_bezier_curve(link_data.bezier);
+
+    geometry.points.resize(link_data.num_segments + 1);
+    for(int i=0;i<=link_data.num_segments;i++){
+        geometry.points[i] = eval_bezier(static_cast<float>(i) / link_data.num_segments, link_data.bezier);
+    }
+
+    return geometry;
+}
+
 bool ImGuiEx::NodeCanvas::BeginNodeMenu(){
     // Check ImGui Callstack
     IM_ASSERT(isDrawingCanvas == true); // Please Call between Begin() and End()
@@ -197,6 +197,18 @@ struct ofxVPLinkData{
     ImVec2      _toPinPosition;
 };
 
+// Link geometry cache, in canvas space.
+// Survives canvas panning, rebuilt when an endpoint moves or the zoom changes.
+struct LinkGeometry{
+    ImVec2              from;
+    ImVec2              to;
+    float               scale = 0.0f;
+    ImVec2              controlPoints[4];
+    ImRect              bounds;
+    ImVector<ImVec2>    points;
+    int                 lastFrame = -1;
+};
+
 struct NodeConnectData{
     int connectType; // 1 connect, 2 disconnect, 3 re-connect
     int linkID;
@@ -318,6 +330,9 @@ struct NodeCanvas {
     ImGuiContext* getContext() { return context; }
 
 private:
+    // Returns the cached geometry of a link, rebuilding it if needed
+    const LinkGeometry& getLinkGeometry(const int linkID, const ImVec2& _from, const ImVec2& _to);
+
 //    void pushNodeWorkRect();
 //    void popNodeWorkRect();
 //    ImRect canvasWorkRectBackup;
@@ -344,6 +359,8 @@ private:
     std::map<int,std::map<int,ImVec2>>  outletPinsPositions;
     std::vector<int> selected_nodes; // for group actions (copy, duplicate, delete) -- TO IMPLEMENT
     std::vector<int> selected_links; // for delete links (one or multiple)          -- IMPLEMENTED
+    std::map<int,LinkGeometry>  linksGeometry; // cached links curves, by link id
+    ImVector<ImVec2>            linkScreenPoints;
     std::string activePin;
     std::string activePinType;
     int         activeNode = 0; // for node inspector
@@ -67,7 +67,12 @@ static int cursor_to_idx(const ImVec2& pos, const ImRect& bb, const PlotConfig&
 }
 
 void plotvar_flush_old_entries() {
+    static int last_flush_frame = -1;
     int current_frame = ImGui::GetFrameCount();
+    // every PlotVar calls this, scan the map only once per frame
+    if (last_flush_frame == current_frame)
+        return;
+    last_flush_frame = current_frame;
     for (std::map<ImGuiID, PlotVarData>::iterator it = g_PlotVarsMap.begin(); it != g_PlotVarsMap.end(); )
     {
         PlotVarData& pvd = it->second;
@@ -78,6 +83,87 @@ void plotvar_flush_old_entries() {
     }
 }
 
+static std::map<ImGuiID, PlotEnvelope>  g_PlotEnvelopesMap;
+
+static PlotEnvelope& plot_envelope(ImGuiID id) {
+    static int last_flush_frame = -1;
+    const int current_frame = ImGui::GetFrameCount();
+
+    // once per frame, drop envelopes of plots not drawn anymore
+    if (last_flush_frame != current_frame) {
+        last_flush_frame = current_frame;
+        for (std::map<ImGuiID, PlotEnvelope>::iterator it = g_PlotEnvelopesMap.begin(); it != g_PlotEnvelopesMap.end(); ) {
+            if (it->second.LastFrame < current_frame - 120)
+                it = g_PlotEnvelopesMap.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    PlotEnvelope& env = g_PlotEnvelopesMap[id];
+    env.LastFrame = current_frame;
+    return env;
+}
+
+static bool envelope_changed(const PlotEnvelope& env, const float* ys, int count, int offset, int columns, float min, float max, uint64_t version) {
+    return version == 0 || env.Version != version || env.Source != ys || env.Count != count || env.Offset != offset || env.Columns != columns || env.Min != min || env.Max != max;
+}
+
+// min/max decimation: every column keeps its lowest and highest sample, in sample order,
+// so peaks are never lost and the plot never has more than 2 points per column
+static void build_line_envelope(PlotEnvelope& env, const float* ys, int count, int offset, bool ring, int columns, float min, float max, uint64_t version) {
+    env.Source = ys;
+    env.Version = version;
+    env.Count = count;
+    env.Offset = offset;
+    env.Columns = columns;
+    env.Min = min;
+    env.Max = max;
+    env.Points.clear();
+
+    const float inv_scale = (min == max) ? 0.0f : (1.0f / (max - min));
+    const float t_scale = count > 1 ? 1.0f / (float)(count - 1) : 0.0f;
+
+#define PLOT_SAMPLE(i) (ring ? ys[(offset + (i)) % count] : ys[offset + (i)])
+
+    if (count <= columns * 2) {
+        env.Points.reserve(count);
+        for (int i = 0; i < count; i++)
+            env.Points.push_back(ImVec2(i * t_scale, 1.0f - ImSaturate((PLOT_SAMPLE(i) - min) * inv_scale)));
+    } else {
+        env.Points.reserve(columns * 2);
+        for (int c = 0; c < columns; c++) {
+            const int start = (int)(((int64_t)c * count) / columns);
+            const int end = (int)(((int64_t)(c + 1) * count) / columns);
+            int min_i = start, max_i = start;
+            float min_v = PLOT_SAMPLE(start), max_v = min_v;
+            for (int i = start + 1; i < end; i++) {
+                const float v = PLOT_SAMPLE(i);
+                if (v < min_v) { min_v = v; min_i = i; }
+                if (v > max_v) { max_v = v; max_i = i; }
+            }
+            const int first = ImMin(min_i, max_i);
+            const int last = ImMax(min_i, max_i);
+            env.Points.push_back(ImVec2(first * t_scale, 1.0f - ImSaturate((PLOT_SAMPLE(first) - min) * inv_scale)));
+            if (last != first)
+                env.Points.push_back(ImVec2(last * t_scale, 1.0f - ImSaturate((PLOT_SAMPLE(last) - min) * inv_scale)));
+        }
+    }
+
+#undef PLOT_SAMPLE
+}
+
+static void draw_line_envelope(ImDrawList* drawList, const PlotEnvelope& env, const ImRect& bb, float x_min, float x_max, PlotConfig::Scale::Type type, ImU32 color, float thickness) {
+    static ImVector<ImVec2> positions;
+    positions.resize((int)env.Points.size());
+    for (int i = 0; i < positions.Size; i++) {
+        const ImVec2& p = env.Points[i];
+        positions[i] = ImLerp(bb.Min, bb.Max, ImVec2(rescale(p.x, x_min, x_max, type), p.y));
+    }
+    if (positions.Size > 1)
+        drawList->AddPolyline(positions.Data, positions.Size, color, false, thickness);
+}
+
 PlotStatus Plot(const char* label, const PlotConfig& conf) {
     PlotStatus status = PlotStatus::nothing;
 
@@ -201,42 +287,31 @@ PlotStatus Plot(const char* label, const PlotConfig& conf) {
         const ImU32 col_hovered = ImGui::GetColorU32(ImGuiCol_PlotLinesHovered);
         ImU32 col_base = ImGui::GetColorU32(ImGuiCol_PlotLines);
 
+        const int columns = conf.skip_small_lines ? ImMax((int)inner_bb.GetWidth(), 1) : conf.values.count;
+
         for (int i = 0; i < ys_count; ++i) {
             if (colors) {
                 if (colors[i]) col_base = colors[i];
                 else col_base = ImGui::GetColorU32(ImGuiCol_PlotLines);
             }
-            float v0 = ys_list[i][conf.values.offset];
-            float t0 = 0.0f;
-            // Point in the normalized space of our target rectangle
-            ImVec2 tp0 = ImVec2(t0, 1.0f - ImSaturate((v0 - conf.scale.min) * inv_scale));
-
-            for (int n = 0; n < res_w; n++)
-            {
-                const float t1 = t0 + t_step;
-                const int v1_idx = (int)(t0 * item_count + 0.5f);
-                IM_ASSERT(v1_idx >= 0 && v1_idx < conf.values.count);
-                const float v1 = ys_list[i][conf.values.offset + (v1_idx + 1) % conf.values.count];
-                const ImVec2 tp1 = ImVec2(
-                            rescale(t1, x_min, x_max, conf.scale.type),
-                            1.0f - ImSaturate((v1 - conf.scale.min) * inv_scale));
-
-                // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
-                ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
-                ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, tp1);
-
-                if (v1_idx == v_hovered) {
-                    window->DrawList->AddCircleFilled(pos0, 3, col_hovered);
-                }
-
-                window->DrawList->AddLine(
-                            pos0,
-                            pos1,
-                            col_base,
-                            conf.line_thickness);
 
-                t0 = t1;
-                tp0 = tp1;
+            // one envelope per plotted array, hashed under the plot id so it can't collide with other plots
+            ImGui::PushID(label);
+            ImGui::PushID(i);
+            PlotEnvelope& env = plot_envelope(ImGui::GetID("##envelope"));
+            ImGui::PopID();
+            ImGui::PopID();
+            if (envelope_changed(env, ys_list[i], conf.values.count, conf.values.offset, columns, conf.scale.min, conf.scale.max, conf.values.version))
+                build_line_envelope(env, ys_list[i], conf.values.count, conf.values.offset, false, columns, conf.scale.min, conf.scale.max, conf.values.version);
+
+            draw_line_envelope(window->DrawList, env, inner_bb, x_min, x_max, conf.scale.type, col_base, conf.line_thickness);
+
+            if (i == 0 && v_hovered >= 0) {
+                const float v = ys_list[i][conf.values.offset + v_hovered];
+                const ImVec2 tp = ImVec2(
+                            rescale(v_hovered / (float)ImMax(item_count, 1), x_min, x_max, conf.scale.type),
+                            1.0f - ImSaturate((v - conf.scale.min) * inv_scale));
+                window->DrawList->AddCircleFilled(ImLerp(inner_bb.Min, inner_bb.Max, tp), 3, col_hovered);
             }
         }
 
@@ -324,14 +399,17 @@ PlotStatus PlotVar(const char* label, const PlotVarConfig& conf, ImU32 color) {
         memset(&pvd.Data[0], 0, sizeof(float) * conf.buffer_size);
         pvd.DataInsertIdx = 0;
         pvd.LastFrame = -1;
+        pvd.Version++;
     }
 
     // Insert (avoid unnecessary modulo operator)
     if (pvd.DataInsertIdx == conf.buffer_size)
         pvd.DataInsertIdx = 0;
     //int display_idx = pvd.DataInsertIdx;
-    if (conf.value != FLT_MAX)
+    if (conf.value != FLT_MAX){
         pvd.Data[pvd.DataInsertIdx++] = conf.value;
+        pvd.Version++;
+    }
 
     // Draw
     int current_frame = ImGui::GetFrameCount();
@@ -339,9 +417,27 @@ PlotStatus PlotVar(const char* label, const PlotVarConfig& conf, ImU32 color) {
     {
         //char overlay[32];
         //sprintf(overlay, "%-3.4f", pvd.Data[display_idx]);
-        ImGui::PushStyleColor(ImGuiCol_PlotLines, color);
-        ImGui::PlotLines("##plot", &pvd.Data[0], conf.buffer_size, pvd.DataInsertIdx, NULL, conf.scale.min, conf.scale.max, ImVec2(conf.frame_size.x, conf.frame_size.y));
-        ImGui::PopStyleColor(1);
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        if (!window->SkipItems) {
+            const ImGuiStyle& style = ImGui::GetStyle();
+            ImVec2 frame_size = conf.frame_size;
+            if (frame_size.x <= 0.0f) frame_size.x = ImGui::CalcItemWidth();
+            if (frame_size.y <= 0.0f) frame_size.y = ImGui::GetTextLineHeight() + style.FramePadding.y * 2.0f;
+
+            const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+            const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+            ImGui::ItemSize(frame_bb, style.FramePadding.y);
+            if (ImGui::ItemAdd(frame_bb, 0)) {
+                ImGui::RenderFrame(frame_bb.Min, frame_bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+                // ring buffer, oldest value first
+                PlotEnvelope& env = plot_envelope(ImGui::GetID("##envelope"));
+                const int columns = ImMax((int)inner_bb.GetWidth(), 1);
+                if (envelope_changed(env, &pvd.Data[0], (int)conf.buffer_size, pvd.DataInsertIdx, columns, conf.scale.min, conf.scale.max, pvd.Version))
+                    build_line_envelope(env, &pvd.Data[0], (int)conf.buffer_size, pvd.DataInsertIdx, true, columns, conf.scale.min, conf.scale.max, pvd.Version);
+                draw_line_envelope(window->DrawList, env, inner_bb, 0.0f, 1.0f, PlotConfig::Scale::Linear, color, 1.0f);
+            }
+        }
         //ImGui::SameLine();
         //ImGui::Text("%s\n%-3.4f", label, pvd.Data[display_idx]);	// Display last value in buffer
         pvd.LastFrame = current_frame;
@@ -408,7 +504,7 @@ void VUMeter(ImDrawList* drawList, float width, float height,float _vol, bool ho
 
 }
 
-void PlotBands(ImDrawList* drawList, float width, float height, std::vector<float> *data, float max, ImU32 color){
+void PlotBands(const char* label, ImDrawList* drawList, float width, float height, std::vector<float> *data, float max, ImU32 color, uint64_t version){
 
     ImGuiWindow* Window = ImGui::GetCurrentWindow();
 
@@ -419,10 +515,39 @@ void PlotBands(ImDrawList* drawList, float width, float height, std::vector<floa
     ImRect bb(Window->DC.CursorPos, Window->DC.CursorPos + Canvas);
     ImGui::ItemSize(bb);
 
-    float bin_w = Canvas.x / data->size();
+    const int count = static_cast<int>(data->size());
+    if(count == 0){
+        return;
+    }
+
+    // one band per horizontal pixel at most, every band shows the peak of the bins it covers
+    const int bands = ImMin(count, ImMax(static_cast<int>(Canvas.x), 1));
+
+    PlotEnvelope& env = plot_envelope(Window->GetID(label));
+    if(envelope_changed(env, data->data(), count, 0, bands, 0.0f, max, version)){
+        env.Source = data->data();
+        env.Version = version;
+        env.Count = count;
+        env.Offset = 0;
+        env.Columns = bands;
+        env.Min = 0.0f;
+        env.Max = max;
+        env.Points.resize(bands);
+        for(int b=0;b<bands;b++){
+            const int start = static_cast<int>((static_cast<int64_t>(b) * count) / bands);
+            const int end = static_cast<int>((static_cast<int64_t>(b + 1) * count) / bands);
+            float peak = data->at(start);
+            for(int i=start+1;i<end;i++){
+                peak = ImMax(peak, (*data)[i]);
+            }
+            env.Points[b] = ImVec2(static_cast<float>(b), peak);
+        }
+    }
+
+    float bin_w = Canvas.x / bands;
 
-    for(int i=0;i<data->size();i++){
-        drawList->AddRect(ImVec2( bb.Min.x + (bin_w*i), bb.Min.y+(Canvas.y*(max-data->at(i)) )),ImVec2(bb.Min.x + (bin_w*i) + bin_w, bb.Max.y),color);
+    for(int i=0;i<bands;i++){
+        drawList->AddRect(ImVec2( bb.Min.x + (bin_w*i), bb.Min.y+(Canvas.y*(max-env.Points[i].y) )),ImVec2(bb.Min.x + (bin_w*i) + bin_w, bb.Max.y),color);
     }
 
 }
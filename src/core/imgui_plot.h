@@ -9,6 +9,7 @@
 #pragma once
 #include <cstdint>
 #include <map>
+#include <vector>
 
 #include "imgui.h"
 
@@ -37,6 +38,10 @@ struct PlotConfig {
         int ys_count = 0;
         // colors for each plot
         const ImU32* colors = nullptr;
+
+        // version of the data, bump it when the values change.
+        // With 0 the plot envelope is recomputed every frame
+        uint64_t version = 0;
     } values;
     struct Scale {
         // Minimum plot value
@@ -75,6 +80,7 @@ struct PlotConfig {
     } v_lines;
     ImVec2 frame_size = ImVec2(0.f, 0.f);
     float line_thickness = 1.f;
+    // decimate to a min/max envelope of max 2 points per horizontal pixel
     bool skip_small_lines = true;
     const char* overlay_text = nullptr;
 };
@@ -101,12 +107,30 @@ struct PlotVarData{
     ImVector<float>     Data;
     int                 DataInsertIdx;
     int                 LastFrame;
+    // counts the inserted values, the plot envelope is rebuilt only when it changes
+    uint64_t            Version;
 
-    PlotVarData() : ID(0), DataInsertIdx(0), LastFrame(-1) {}
+    PlotVarData() : ID(0), DataInsertIdx(0), LastFrame(-1), Version(1) {}
 };
 
 static std::map<ImGuiID, PlotVarData>	g_PlotVarsMap;
 
+// Cached min/max envelope of a plotted array, in normalized (x,y) plot space,
+// so it survives canvas pan/zoom and is rebuilt only when the data changes
+struct PlotEnvelope{
+    std::vector<ImVec2> Points;
+    const float*        Source;
+    uint64_t            Version;
+    int                 Count;
+    int                 Offset;
+    int                 Columns;
+    float               Min;
+    float               Max;
+    int                 LastFrame;
+
+    PlotEnvelope() : Source(nullptr), Version(0), Count(0), Offset(0), Columns(0), Min(0.f), Max(0.f), LastFrame(-1) {}
+};
+
 //--------------------------------------------------
 
 IMGUI_API PlotStatus Plot(const char* label, const PlotConfig& conf);
@@ -115,6 +139,7 @@ IMGUI_API PlotStatus PlotVar(const char* label, const PlotVarConfig& conf, ImU32
 
 void VUMeter(ImDrawList* drawList, float width, float height,float _vol, bool horizontal=true);
 
-void PlotBands(ImDrawList* drawList, float width, float height, std::vector<float> *data, float max=1.0f, ImU32 color=IM_COL32(255,255,120,255));
+// label: id of the cached band envelope, unique among the PlotBands of the same window
+void PlotBands(const char* label, ImDrawList* drawList, float width, float height, std::vector<float> *data, float max=1.0f, ImU32 color=IM_COL32(255,255,120,255), uint64_t version=0);
 
 }
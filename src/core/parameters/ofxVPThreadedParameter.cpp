@@ -0,0 +1,3 @@
+#include "ofxVPThreadedParameter.h"
+
+std::thread::id ofxVPThreadedParameterThreads::main_thread_id = std::this_thread::get_id();
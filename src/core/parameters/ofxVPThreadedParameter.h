@@ -3,16 +3,62 @@
 #include "ofMain.h"
 #include "ofxVPBaseParameter.h"
 
-// creates and keeps in sync a copy of the variable, to access from a thread
+#include <atomic>
+#include <type_traits>
+
+// thread that owns the main copy of every threaded parameter
+struct ofxVPThreadedParameterThreads {
+    static std::thread::id main_thread_id;
+};
+
+// wait-free single producer / single consumer transport of the latest value.
+// write() and read() never block nor allocate, intermediate values are dropped.
 template <typename T>
-class ofxVPThreadedParameter : public ofxVPBaseParameter<T> {
+class ofxVPTripleBuffer {
+
+public:
+
+    ofxVPTripleBuffer() : middle(1), back(0), front(2) {
+
+    }
+
+    // producer
+    void write(const T& _value){
+        slots[back] = _value;
+        back = middle.exchange(back | DIRTY, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // consumer, true (and _value updated) if a new value was written since the last read
+    bool read(T& _value){
+        if( (middle.load(std::memory_order_relaxed) & DIRTY) == 0 ){
+            return false;
+        }
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+        _value = slots[front];
+        return true;
+    }
+
+protected:
+
+    static const uint8_t INDEX = 0x3;
+    static const uint8_t DIRTY = 0x4;
+
+    T slots[3];
+    std::atomic<uint8_t> middle;    // slot shared by both sides (+ dirty flag)
+    uint8_t back;                   // producer only
+    uint8_t front;                  // consumer only
+};
+
+// creates and keeps in sync a copy of the variable, to access from a thread
+template <typename T, typename Enable = void>
+class ofxVPThreadedParameter : public ofxVPBaseParameter<T>, public ofxVPThreadedParameterThreads {
 
 public:
 //	ofxVPThreadedParam(T _value) : ofxVPParameter<T>(_value), threadedValue(_value) {
 //
 //	}
 
-    ofxVPThreadedParameter(T _value, string _name) : ofxVPParameter<T>(_value, _name), threadedValue(_value) {
+    ofxVPThreadedParameter(T _value, string _name) : ofxVPBaseParameter<T>(_value, _name), threadedValue(_value) {
 
     }
 
@@ -31,13 +77,13 @@ public:
 //	}
 
     // implicit conversion operator
-    operator ofxVPParameter<T>&() { return *this; }
+    operator ofxVPBaseParameter<T>&() { return *this; }
 
     virtual bool set(const T& _value){
         //if(ofThread::isMainThread()){
         if( main_thread_id == std::this_thread::get_id() ){
             // set from main thread
-            ofxVPParameter<T>::set(_value);
+            ofxVPBaseParameter<T>::set(_value);
             paramToThread.send(_value);
         }
         else {
@@ -61,7 +107,7 @@ public:
         //if(ofThread::isMainThread()){
         if( main_thread_id == std::this_thread::get_id() ){
             // get from main thread
-            return ofxVPParameter<T>::get();
+            return ofxVPBaseParameter<T>::get();
         }
         else {
             return getFromThread();
@@ -69,7 +115,7 @@ public:
     }
 
     virtual T get() const {
-        return ofxVPParameter<T>::value;
+        return ofxVPBaseParameter<T>::value;
     }
 
     virtual T& getFromThread(){
@@ -96,26 +142,24 @@ public:
     virtual bool syncFromMainThread(){
         // empty queue and keep last param
         bool changed = false;
-        while(paramToThread.tryReceive(ofxVPParameter<T>::value)){
+        while(paramFromThread.tryReceive(ofxVPBaseParameter<T>::value)){
             changed = true;
         }
         if(changed){
             // todo: notifiy threaded change
         }
-        return true;
+        return changed;
     }
 
     virtual void triggerUpdate(){
         if( main_thread_id == std::this_thread::get_id() ){
-            paramToThread.send(ofxVPParameter<T>::value);
+            paramToThread.send(ofxVPBaseParameter<T>::value);
         }
         else {
             paramFromThread.send(threadedValue);
         }
     }
 
-    static std::thread::id main_thread_id;
-
 protected:
 //	string getUniqueName(){
 //		return "";
@@ -126,5 +170,96 @@ protected:
     ofThreadChannel<T> paramToThread;
     ofThreadChannel<T> paramFromThread;
 };
+
+// trivially copyable values (numbers, colors, small structs) only need the latest value,
+// they travel through a triple buffer in each direction instead of two ofThreadChannel:
+// no lock, no allocation, no queue to drain.
 template <typename T>
-std::thread::id ofxVPThreadedParam<T>::main_thread_id = std::this_thread::get_id();
+class ofxVPThreadedParameter<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type> : public ofxVPBaseParameter<T>, public ofxVPThreadedParameterThreads {
+
+public:
+
+    ofxVPThreadedParameter(T _value, string _name) : ofxVPBaseParameter<T>(_value, _name), threadedValue(_value) {
+
+    }
+
+    virtual ~ofxVPThreadedParameter(){
+
+    }
+
+    ofxVPThreadedParameter<T>& operator=(T const & _value){
+        this->set(_value);
+        return *this;
+    }
+
+    // implicit conversion operator
+    operator ofxVPBaseParameter<T>&() { return *this; }
+
+    virtual bool set(const T& _value){
+        if( main_thread_id == std::this_thread::get_id() ){
+            // set from main thread
+            ofxVPBaseParameter<T>::set(_value);
+            paramToThread.write(_value);
+        }
+        else {
+            setFromThread(_value);
+        }
+
+        return true;
+    }
+
+    // use to change the value from thread
+    virtual bool setFromThread(const T& _value){
+        threadedValue = _value;
+        paramFromThread.write(_value);
+
+        return true;
+    }
+
+    virtual T& get(){
+        if( main_thread_id == std::this_thread::get_id() ){
+            // get from main thread
+            return ofxVPBaseParameter<T>::get();
+        }
+        else {
+            return getFromThread();
+        }
+    }
+
+    virtual T get() const {
+        return ofxVPBaseParameter<T>::value;
+    }
+
+    virtual T& getFromThread(){
+        return threadedValue;
+    }
+
+    virtual T getFromThread() const{
+        return threadedValue;
+    }
+
+    // to sync the variable on the thread's update()
+    virtual bool syncFromThread(){
+        return paramToThread.read(threadedValue);
+    }
+
+    virtual bool syncFromMainThread(){
+        return paramFromThread.read(ofxVPBaseParameter<T>::value);
+    }
+
+    virtual void triggerUpdate(){
+        if( main_thread_id == std::this_thread::get_id() ){
+            paramToThread.write(ofxVPBaseParameter<T>::value);
+        }
+        else {
+            paramFromThread.write(threadedValue);
+        }
+    }
+
+protected:
+
+    T threadedValue; // to access from thread only
+
+    ofxVPTripleBuffer<T> paramToThread;
+    ofxVPTripleBuffer<T> paramFromThread;
+};
@@ -0,0 +1,110 @@
+//
+//  portBufferPool.cpp
+//  ofxVisualProgramming
+//
+
+#include "portBufferPool.h"
+
+//--------------------------------------------------------------
+size_t ofxVPPortBufferTraits<ofTexture>::bytes(const ofTexture &b){
+    size_t size = sizeof(ofTexture);
+    if(b.isAllocated()){
+        const ofTextureData &td = b.getTextureData();
+        int glFormat = ofGetGLFormatFromInternal(td.glInternalFormat);
+        int glType = ofGetGLTypeFromInternal(td.glInternalFormat);
+        size += static_cast<size_t>(td.tex_w*td.tex_h)*ofGetNumChannelsFromGLFormat(glFormat)*ofGetBytesPerChannelFromGLType(glType);
+    }
+    return size;
+}
+
+//--------------------------------------------------------------
+ofxVPPortBufferPool& ofxVPPortBufferPool::get(){
+    static ofxVPPortBufferPool pool;
+    return pool;
+}
+
+//--------------------------------------------------------------
+ofxVPPortBufferPool::ofxVPPortBufferPool(){
+    frame = 0;
+}
+
+//--------------------------------------------------------------
+void ofxVPPortBufferPool::release(void *buffer){
+    if(buffer == nullptr){
+        return;
+    }
+    std::lock_guard<std::mutex> lck(mutex);
+    auto it = live.find(buffer);
+    if(it == live.end()){
+        return;
+    }
+    it->second.releaseFrame = frame;
+    released.push_back(it->second);
+    live.erase(it);
+}
+
+//--------------------------------------------------------------
+void ofxVPPortBufferPool::update(){
+    vector<Entry> toDestroy;
+    {
+        std::lock_guard<std::mutex> lck(mutex);
+        frame++;
+
+        size_t kept = 0;
+        for(size_t i=0;i<released.size();i++){
+            Entry &e = released[i];
+            if(frame - e.releaseFrame < PORT_BUFFER_RELEASE_FRAMES){
+                released[kept++] = e;
+                continue;
+            }
+            vector<Entry> &fl = freeLists[e.type];
+            if(e.reusable && fl.size() < PORT_BUFFER_MAX_FREE){
+                // reset as new, keeping its allocation
+                e.recycle(e.buffer);
+                fl.push_back(e);
+            }else{
+                toDestroy.push_back(e);
+            }
+        }
+        released.erase(released.begin()+kept,released.end());
+    }
+
+    // outside the lock: destructors may be slow (GL textures, devices)
+    for(size_t i=0;i<toDestroy.size();i++){
+        toDestroy[i].destroy(toDestroy[i].buffer);
+    }
+}
+
+//--------------------------------------------------------------
+size_t ofxVPPortBufferPool::getBytes(void *buffer) const{
+    std::lock_guard<std::mutex> lck(mutex);
+    auto it = live.find(buffer);
+    return it != live.end() ? it->second.bytes(buffer) : 0;
+}
+
+//--------------------------------------------------------------
+ofxVPPortBufferStats ofxVPPortBufferPool::getStats(int linkType) const{
+    ofxVPPortBufferStats stats;
+    std::lock_guard<std::mutex> lck(mutex);
+    for(auto it = live.begin(); it != live.end(); it++){
+        if(it->second.linkType == linkType){
+            stats.buffers++;
+            stats.bytes += it->second.bytes(it->first);
+        }
+    }
+    for(size_t i=0;i<released.size();i++){
+        if(released[i].linkType == linkType){
+            stats.pooled++;
+            stats.pooledBytes += released[i].bytes(released[i].buffer);
+        }
+    }
+    for(auto it = freeLists.begin(); it != freeLists.end(); it++){
+        for(size_t i=0;i<it->second.size();i++){
+            if(it->second[i].linkType == linkType){
+                stats.pooled++;
+                stats.pooledBytes += it->second[i].bytes(it->second[i].buffer);
+            }
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,191 @@
+//
+//  portBufferPool.h
+//  ofxVisualProgramming
+//
+//  Owner of every inlet/outlet buffer (PatchObject::newInletBuffer() and
+//  newOutletBuffer()). A released buffer is not destroyed: it goes back
+//  to a free list of its type and is handed out again to the next
+//  connection/resize asking for the same type, so live patching stops
+//  allocating (and leaking) a new buffer every time.
+//
+//  Strings, arrays and sound buffers keep their storage when recycled.
+//  ofPixels and ofTexture have no reset that keeps it: their clear()
+//  frees the pixels/GL texture, so only the object itself is reused and
+//  the next owner allocates the size it needs (objects test
+//  isAllocated() for that).
+//
+//  Inlets alias the outlet they are linked to until the next frame
+//  update, so released buffers become reusable only after
+//  PORT_BUFFER_RELEASE_FRAMES calls to update(), never while a link can
+//  still point to them.
+//
+
+#pragma once
+
+#include "ofMain.h"
+
+#include "config.h"
+
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+// frames a released buffer waits before being reused (links refresh their pointers every frame)
+#define PORT_BUFFER_RELEASE_FRAMES  2
+// free buffers kept per type, the exceeding ones are destroyed
+#define PORT_BUFFER_MAX_FREE        32
+
+// per type behaviour of the pool, specialized for every link type buffer.
+// Other types (script references, devices, ...) are tracked but never reused.
+template<typename T>
+struct ofxVPPortBufferTraits {
+    static const int    linkType = VP_LINK_SPECIAL;
+    static const bool   reusable = false;
+    static size_t       bytes(const T &b) { return sizeof(T); }
+    static void         recycle(T &b) {}
+};
+
+template<> struct ofxVPPortBufferTraits<string> {
+    static const int    linkType = VP_LINK_STRING;
+    static const bool   reusable = true;
+    static size_t       bytes(const string &b) { return sizeof(string) + b.capacity(); }
+    static void         recycle(string &b) { b.clear(); }
+};
+
+template<> struct ofxVPPortBufferTraits<vector<float>> {
+    static const int    linkType = VP_LINK_ARRAY;
+    static const bool   reusable = true;
+    static size_t       bytes(const vector<float> &b) { return sizeof(vector<float>) + b.capacity()*sizeof(float); }
+    static void         recycle(vector<float> &b) { b.clear(); }
+};
+
+template<> struct ofxVPPortBufferTraits<ofPixels> {
+    static const int    linkType = VP_LINK_PIXELS;
+    static const bool   reusable = true;
+    static size_t       bytes(const ofPixels &b) { return sizeof(ofPixels) + b.getTotalBytes(); }
+    // frees the pixels, see the header note
+    static void         recycle(ofPixels &b) { b.clear(); }
+};
+
+template<> struct ofxVPPortBufferTraits<ofTexture> {
+    static const int    linkType = VP_LINK_TEXTURE;
+    static const bool   reusable = true;
+    static size_t       bytes(const ofTexture &b);
+    // frees the GL texture, see the header note
+    static void         recycle(ofTexture &b) { b.clear(); }
+};
+
+template<> struct ofxVPPortBufferTraits<ofSoundBuffer> {
+    static const int    linkType = VP_LINK_AUDIO;
+    static const bool   reusable = true;
+    static size_t       bytes(const ofSoundBuffer &b) { return sizeof(ofSoundBuffer) + b.getBuffer().capacity()*sizeof(float); }
+    static void         recycle(ofSoundBuffer &b) { b.clear(); }
+};
+
+struct ofxVPPortBufferStats {
+    size_t  buffers     = 0;    // owned by an object
+    size_t  bytes       = 0;
+    size_t  pooled      = 0;    // released, waiting or free for reuse
+    size_t  pooledBytes = 0;
+};
+
+class ofxVPPortBufferPool {
+
+public:
+
+    static ofxVPPortBufferPool& get();
+
+    // a free buffer of type T (reset as a new one) or a new one,
+    // the constructor arguments are assigned to a reused buffer
+    template<typename T, typename... Args>
+    T*          acquire(Args&&... args);
+
+    // give back a buffer from acquire(), nullptr and unknown pointers are ignored
+    void        release(void *buffer);
+
+    // true if buffer is a live buffer of type T
+    template<typename T>
+    bool        holds(void *buffer) const;
+
+    // main thread, once per frame: recycles the buffers released long enough ago
+    void        update();
+
+    // memory of a live buffer, 0 if unknown
+    size_t      getBytes(void *buffer) const;
+    ofxVPPortBufferStats getStats(int linkType) const;
+
+protected:
+
+    ofxVPPortBufferPool();
+    // buffers are not destroyed at exit: the GL context of the textures may be gone already
+    ~ofxVPPortBufferPool() {}
+
+    struct Entry {
+        void                *buffer;
+        std::type_index     type;
+        int                 linkType;
+        bool                reusable;
+        uint64_t            releaseFrame;
+        size_t              (*bytes)(const void *);
+        void                (*destroy)(void *);
+        void                (*recycle)(void *);
+    };
+
+    template<typename T>
+    static Entry makeEntry(T *buffer);
+
+    // reused buffers are already reset by recycle(), only constructor arguments need applying
+    template<typename T>
+    static void assign(T *buffer) {}
+    template<typename T, typename... Args>
+    static void assign(T *buffer, Args&&... args) { *buffer = T(std::forward<Args>(args)...); }
+
+    mutable std::mutex                                  mutex;
+    std::unordered_map<void*,Entry>                     live;
+    vector<Entry>                                       released;
+    std::unordered_map<std::type_index,vector<Entry>>   freeLists;
+    uint64_t                                            frame;
+
+};
+
+//--------------------------------------------------------------
+template<typename T>
+ofxVPPortBufferPool::Entry ofxVPPortBufferPool::makeEntry(T *buffer){
+    Entry e = { buffer, std::type_index(typeid(T)), ofxVPPortBufferTraits<T>::linkType, ofxVPPortBufferTraits<T>::reusable, 0,
+                [](const void *b){ return ofxVPPortBufferTraits<T>::bytes(*static_cast<const T *>(b)); },
+                [](void *b){ delete static_cast<T *>(b); },
+                [](void *b){ ofxVPPortBufferTraits<T>::recycle(*static_cast<T *>(b)); } };
+    return e;
+}
+
+//--------------------------------------------------------------
+template<typename T, typename... Args>
+T* ofxVPPortBufferPool::acquire(Args&&... args){
+    T *buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lck(mutex);
+        auto fl = freeLists.find(std::type_index(typeid(T)));
+        if(fl != freeLists.end() && !fl->second.empty()){
+            buffer = static_cast<T *>(fl->second.back().buffer);
+            fl->second.pop_back();
+        }
+    }
+
+    if(buffer == nullptr){
+        buffer = new T(std::forward<Args>(args)...);
+    }else{
+        assign(buffer,std::forward<Args>(args)...);
+    }
+
+    std::lock_guard<std::mutex> lck(mutex);
+    live.emplace(buffer,makeEntry(buffer));
+    return buffer;
+}
+
+//--------------------------------------------------------------
+template<typename T>
+bool ofxVPPortBufferPool::holds(void *buffer) const{
+    std::lock_guard<std::mutex> lck(mutex);
+    auto it = live.find(buffer);
+    return it != live.end() && it->second.type == std::type_index(typeid(T));
+}
@@ -0,0 +1,405 @@
+//
+//  shaderCache.cpp
+//  ofxVisualProgramming
+//
+
+#include "shaderCache.h"
+
+//--------------------------------------------------------------
+static uint64_t shaderCacheHash(uint64_t h, const string &s){
+    // FNV-1a, stable across runs and platforms (the hash names cache files)
+    for(size_t i=0;i<s.size();i++){
+        h ^= static_cast<unsigned char>(s[i]);
+        h *= 1099511628211ULL;
+    }
+    h ^= 0xFF;
+    h *= 1099511628211ULL;
+    return h;
+}
+
+//--------------------------------------------------------------
+ofxVPShaderCache& ofxVPShaderCache::get(){
+    static ofxVPShaderCache cache;
+    return cache;
+}
+
+//--------------------------------------------------------------
+ofxVPShaderCache::ofxVPShaderCache(){
+    sharedContext   = nullptr;
+    running         = false;
+    building        = 0;
+    nextTicket      = 1;
+    binaries        = false;
+    cacheBytes      = 0;
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::setup(shared_ptr<ofAppGLFWWindow> &mainWindow){
+    if(sharedContext != nullptr || mainWindow == nullptr){
+        return;
+    }
+
+    const GLubyte *vendor = glGetString(GL_VENDOR);
+    const GLubyte *renderer = glGetString(GL_RENDERER);
+    const GLubyte *version = glGetString(GL_VERSION);
+    driver = string(vendor ? reinterpret_cast<const char*>(vendor) : "")+"|"+(renderer ? reinterpret_cast<const char*>(renderer) : "")+"|"+(version ? reinterpret_cast<const char*>(version) : "");
+
+#ifndef TARGET_OPENGLES
+    GLint numFormats = 0;
+    if(GLEW_ARB_get_program_binary){
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS,&numFormats);
+    }
+    binaries = numFormats > 0;
+#endif
+    cacheFolder = ofToDataPath(SHADER_CACHE_FOLDER,true);
+    if(binaries && !ofDirectory::doesDirectoryExist(cacheFolder,false)){
+        ofDirectory::createDirectory(cacheFolder,false,true);
+    }
+    if(binaries){
+        loadCacheIndex();
+    }
+
+    // programs from the programmable renderer need its attribute bindings, they stay in ofShader
+    if(ofIsGLProgrammableRenderer()){
+        return;
+    }
+
+    glfwWindowHint(GLFW_VISIBLE,GLFW_FALSE);
+    sharedContext = glfwCreateWindow(1,1,"shader compiler",nullptr,mainWindow->getGLFWWindow());
+    glfwDefaultWindowHints();
+
+    if(sharedContext == nullptr){
+        ofLog(OF_LOG_WARNING,"shader cache: no shared GL context, shaders compile on the main thread");
+        return;
+    }
+
+    std::unique_lock<std::mutex> lck(mutex);
+    running = true;
+    thread = std::thread(&ofxVPShaderCache::run,this);
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::exit(){
+    {
+        std::unique_lock<std::mutex> lck(mutex);
+        running = false;
+        condition.notify_all();
+    }
+    if(thread.joinable()){
+        thread.join();
+    }
+    if(sharedContext != nullptr){
+        glfwDestroyWindow(sharedContext);
+        sharedContext = nullptr;
+    }
+}
+
+//--------------------------------------------------------------
+uint64_t ofxVPShaderCache::compile(const string &vertex, const string &fragment){
+    collectOrphans();
+
+    Job job = { 0, vertex, fragment };
+    {
+        std::unique_lock<std::mutex> lck(mutex);
+        job.ticket = nextTicket++;
+        if(running){
+            jobs.push_back(job);
+            stats.pending = jobs.size();
+            condition.notify_all();
+            return job.ticket;
+        }
+    }
+
+    // no compile thread: build now, the result is there at the next poll()
+    ofxVPShaderResult result;
+    uint64_t start = ofGetElapsedTimeMicros();
+    result.program = build(job,result);
+    result.ms = (ofGetElapsedTimeMicros()-start)/1000.0f;
+
+    std::unique_lock<std::mutex> lck(mutex);
+    done[job.ticket] = result;
+    return job.ticket;
+}
+
+//--------------------------------------------------------------
+bool ofxVPShaderCache::poll(uint64_t ticket, ofxVPShaderResult &result){
+    collectOrphans();
+
+    std::unique_lock<std::mutex> lck(mutex);
+    auto it = done.find(ticket);
+    if(it == done.end()){
+        return false;
+    }
+    result = it->second;
+    done.erase(it);
+    return true;
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::cancel(uint64_t ticket){
+    if(ticket == 0){
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lck(mutex);
+        for(auto it = jobs.begin(); it != jobs.end(); it++){
+            if(it->ticket == ticket){
+                jobs.erase(it);
+                stats.pending = jobs.size();
+                return;
+            }
+        }
+        if(building == ticket){
+            cancelled.insert(ticket);
+            return;
+        }
+        auto it = done.find(ticket);
+        if(it != done.end()){
+            orphans.push_back(it->second.program);
+            done.erase(it);
+        }
+    }
+    collectOrphans();
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::deleteProgram(GLuint program){
+    if(program != 0){
+        glDeleteProgram(program);
+    }
+}
+
+//--------------------------------------------------------------
+ofxVPShaderCacheStats ofxVPShaderCache::getStats(){
+    std::unique_lock<std::mutex> lck(mutex);
+    stats.async     = running;
+    stats.binaries  = binaries;
+    return stats;
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::collectOrphans(){
+    vector<GLuint> toDelete;
+    {
+        std::unique_lock<std::mutex> lck(mutex);
+        toDelete.swap(orphans);
+    }
+    for(size_t i=0;i<toDelete.size();i++){
+        deleteProgram(toDelete[i]);
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::run(){
+    glfwMakeContextCurrent(sharedContext);
+
+    std::unique_lock<std::mutex> lck(mutex);
+    while(running){
+        condition.wait(lck,[this]{ return !running || !jobs.empty(); });
+        if(!running){
+            break;
+        }
+        Job job = jobs.front();
+        jobs.pop_front();
+        building = job.ticket;
+        lck.unlock();
+
+        ofxVPShaderResult result;
+        uint64_t start = ofGetElapsedTimeMicros();
+        result.program = build(job,result);
+        // the program must be complete before the main context uses it
+        glFinish();
+        result.ms = (ofGetElapsedTimeMicros()-start)/1000.0f;
+
+        lck.lock();
+        building = 0;
+        stats.pending = jobs.size();
+        if(cancelled.erase(job.ticket) > 0){
+            orphans.push_back(result.program);
+        }else{
+            done[job.ticket] = result;
+        }
+    }
+
+    glfwMakeContextCurrent(nullptr);
+}
+
+//--------------------------------------------------------------
+string ofxVPShaderCache::getCacheFile(const Job &job) const{
+    uint64_t h = 14695981039346656037ULL;
+    h = shaderCacheHash(h,driver);
+    h = shaderCacheHash(h,job.vertex);
+    h = shaderCacheHash(h,job.fragment);
+    char name[32];
+    snprintf(name,sizeof(name),"%016llx.bin",static_cast<unsigned long long>(h));
+    return cacheFolder+name;
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::loadCacheIndex(){
+    cacheFiles.clear();
+    cacheBytes = 0;
+
+    // oldest write first, hits refresh the write time so the order survives restarts
+    vector<pair<std::filesystem::file_time_type,pair<string,uint64_t>>> found;
+    std::error_code ec;
+    for(std::filesystem::directory_iterator it(cacheFolder,ec), end; !ec && it != end; it.increment(ec)){
+        if(it->path().extension() != ".bin"){
+            continue;
+        }
+        uint64_t size = std::filesystem::file_size(it->path(),ec);
+        std::filesystem::file_time_type time = std::filesystem::last_write_time(it->path(),ec);
+        if(!ec){
+            found.push_back(make_pair(time,make_pair(it->path().string(),size)));
+        }
+        ec.clear();
+    }
+    sort(found.begin(),found.end());
+
+    for(size_t i=0;i<found.size();i++){
+        addCacheFile(found[i].second.first,found[i].second.second);
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::touchCacheFile(const string &path){
+    std::error_code ec;
+    std::filesystem::last_write_time(path,std::filesystem::file_time_type::clock::now(),ec);
+
+    for(auto it=cacheFiles.begin();it!=cacheFiles.end();it++){
+        if(it->first == path){
+            pair<string,uint64_t> entry = *it;
+            cacheFiles.erase(it);
+            cacheFiles.push_back(entry);
+            return;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPShaderCache::addCacheFile(const string &path, uint64_t size){
+    for(auto it=cacheFiles.begin();it!=cacheFiles.end();it++){
+        if(it->first == path){
+            cacheBytes -= it->second;
+            cacheFiles.erase(it);
+            break;
+        }
+    }
+    cacheFiles.push_back(make_pair(path,size));
+    cacheBytes += size;
+
+    // drop the least recently used binaries, never the one just written
+    while(cacheBytes > SHADER_CACHE_MAX_BYTES && cacheFiles.size() > 1){
+        std::error_code ec;
+        std::filesystem::remove(cacheFiles.front().first,ec);
+        cacheBytes -= cacheFiles.front().second;
+        cacheFiles.pop_front();
+    }
+}
+
+//--------------------------------------------------------------
+bool ofxVPShaderCache::attachShader(GLuint program, GLenum type, const string &source, string &log){
+    GLuint shader = glCreateShader(type);
+    const char *src = source.c_str();
+    glShaderSource(shader,1,&src,nullptr);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader,GL_COMPILE_STATUS,&status);
+    if(status != GL_TRUE){
+        GLint length = 0;
+        glGetShaderiv(shader,GL_INFO_LOG_LENGTH,&length);
+        vector<GLchar> info(std::max(length,1));
+        glGetShaderInfoLog(shader,length,nullptr,info.data());
+        log += (type == GL_VERTEX_SHADER ? "vertex: " : "fragment: ")+string(info.data());
+        glDeleteShader(shader);
+        return false;
+    }
+
+    glAttachShader(program,shader);
+    // flagged for deletion, freed with the program
+    glDeleteShader(shader);
+    return true;
+}
+
+//--------------------------------------------------------------
+GLuint ofxVPShaderCache::build(const Job &job, ofxVPShaderResult &result){
+    string cacheFile = binaries ? getCacheFile(job) : "";
+
+#ifndef TARGET_OPENGLES
+    // warm start: the linked binary from a previous run
+    if(binaries && ofFile::doesFileExist(cacheFile,false)){
+        ofBuffer buffer = ofBufferFromFile(cacheFile,true);
+        if(buffer.size() > sizeof(GLenum)){
+            GLenum format;
+            memcpy(&format,buffer.getData(),sizeof(GLenum));
+            GLuint program = glCreateProgram();
+            glProgramBinary(program,format,buffer.getData()+sizeof(GLenum),static_cast<GLsizei>(buffer.size()-sizeof(GLenum)));
+            GLint status = GL_FALSE;
+            glGetProgramiv(program,GL_LINK_STATUS,&status);
+            if(status == GL_TRUE){
+                result.fromCache = true;
+                touchCacheFile(cacheFile);
+                std::unique_lock<std::mutex> lck(mutex);
+                stats.cacheHits++;
+                return program;
+            }
+            // rejected (driver update, corrupted file): build it again
+            glDeleteProgram(program);
+        }
+    }
+#endif
+
+    GLuint program = glCreateProgram();
+    bool compiled = true;
+    if(job.vertex != ""){
+        compiled = attachShader(program,GL_VERTEX_SHADER,job.vertex,result.log);
+    }
+    compiled = compiled && attachShader(program,GL_FRAGMENT_SHADER,job.fragment,result.log);
+
+    GLint status = GL_FALSE;
+    if(compiled){
+#ifndef TARGET_OPENGLES
+        if(binaries){
+            glProgramParameteri(program,GL_PROGRAM_BINARY_RETRIEVABLE_HINT,GL_TRUE);
+        }
+#endif
+        glLinkProgram(program);
+        glGetProgramiv(program,GL_LINK_STATUS,&status);
+        if(status != GL_TRUE){
+            GLint length = 0;
+            glGetProgramiv(program,GL_INFO_LOG_LENGTH,&length);
+            vector<GLchar> info(std::max(length,1));
+            glGetProgramInfoLog(program,length,nullptr,info.data());
+            result.log += "link: "+string(info.data());
+        }
+    }
+
+    if(status != GL_TRUE){
+        glDeleteProgram(program);
+        std::unique_lock<std::mutex> lck(mutex);
+        stats.failed++;
+        return 0;
+    }
+
+#ifndef TARGET_OPENGLES
+    if(binaries){
+        GLint length = 0;
+        glGetProgramiv(program,GL_PROGRAM_BINARY_LENGTH,&length);
+        if(length > 0){
+            ofBuffer buffer;
+            buffer.allocate(sizeof(GLenum)+length);
+            GLenum format = 0;
+            glGetProgramBinary(program,length,nullptr,&format,buffer.getData()+sizeof(GLenum));
+            memcpy(buffer.getData(),&format,sizeof(GLenum));
+            if(ofBufferToFile(cacheFile,buffer,true)){
+                addCacheFile(cacheFile,buffer.size());
+            }
+        }
+    }
+#endif
+
+    std::unique_lock<std::mutex> lck(mutex);
+    stats.compiled++;
+    return program;
+}
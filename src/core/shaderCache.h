@@ -0,0 +1,115 @@
+//
+//  shaderCache.h
+//  ofxVisualProgramming
+//
+//  GLSL programs compiled and linked on a background thread, with its
+//  own hidden GL context shared with the main window: a shader object
+//  queues its sources with compile(), keeps drawing with its previous
+//  program and swaps in the new one when poll() returns it.
+//
+//  Linked programs are saved as binaries (ARB_get_program_binary) in
+//  the shader cache folder, keyed by a hash of the sources and of the
+//  GL driver string, so a warm start links from disk with no compile.
+//  Every edit of a live shader writes a new binary, so the folder is
+//  kept under SHADER_CACHE_MAX_BYTES dropping the least recently used.
+//
+//  Fixed pipeline (GL 2.x) programs only, the ones built from raw
+//  sources with no openFrameworks attribute bindings. Without a shared
+//  context compile() builds at once on the main thread.
+//
+
+#pragma once
+
+#include "ofMain.h"
+#include "ofAppGLFWWindow.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#define SHADER_CACHE_FOLDER     "shadercache/"
+#define SHADER_CACHE_MAX_BYTES  (32*1024*1024)
+
+struct ofxVPShaderResult {
+    GLuint      program     = 0;        // 0 when compile or link failed
+    string      log;
+    bool        fromCache   = false;    // linked from a cached binary
+    float       ms          = 0.0f;
+};
+
+struct ofxVPShaderCacheStats {
+    bool        async       = false;
+    bool        binaries    = false;    // program binaries supported by the driver
+    size_t      compiled    = 0;
+    size_t      cacheHits   = 0;
+    size_t      failed      = 0;
+    size_t      pending     = 0;
+};
+
+class ofxVPShaderCache {
+
+public:
+
+    static ofxVPShaderCache& get();
+
+    // main thread, once the main window exists: shared context and compile thread
+    void        setup(shared_ptr<ofAppGLFWWindow> &mainWindow);
+    // main thread: stops the compile thread, destroys its context
+    void        exit();
+
+    // main thread: queues a build (empty vertex source for the fixed pipeline one), returns its ticket
+    uint64_t    compile(const string &vertex, const string &fragment);
+    // main thread: true once the build of ticket is done, result.program is then owned by the caller
+    bool        poll(uint64_t ticket, ofxVPShaderResult &result);
+    // main thread: the program of ticket is not wanted anymore (0 is ignored)
+    void        cancel(uint64_t ticket);
+    // main thread: deletes a program returned by poll() (0 is ignored)
+    void        deleteProgram(GLuint program);
+
+    ofxVPShaderCacheStats getStats();
+
+protected:
+
+    ofxVPShaderCache();
+    ~ofxVPShaderCache() {}
+
+    struct Job {
+        uint64_t    ticket;
+        string      vertex;
+        string      fragment;
+    };
+
+    void        run();
+    GLuint      build(const Job &job, ofxVPShaderResult &result);
+    bool        attachShader(GLuint program, GLenum type, const string &source, string &log);
+    string      getCacheFile(const Job &job) const;
+    // cache folder index, least recently used first (setup, then the building thread only)
+    void        loadCacheIndex();
+    void        touchCacheFile(const string &path);
+    void        addCacheFile(const string &path, uint64_t size);
+    // programs built for cancelled tickets, deleted from the main thread
+    void        collectOrphans();
+
+    GLFWwindow                          *sharedContext;
+    std::thread                         thread;
+    std::mutex                          mutex;
+    std::condition_variable             condition;
+    bool                                running;
+
+    std::deque<Job>                     jobs;
+    map<uint64_t,ofxVPShaderResult>     done;
+    std::set<uint64_t>                  cancelled;
+    vector<GLuint>                      orphans;
+    uint64_t                            building;
+    uint64_t                            nextTicket;
+
+    string                              driver;
+    string                              cacheFolder;
+    std::deque<pair<string,uint64_t>>   cacheFiles;
+    uint64_t                            cacheBytes;
+    bool                                binaries;
+    ofxVPShaderCacheStats               stats;
+
+};
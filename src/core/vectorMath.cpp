@@ -0,0 +1,702 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2019 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+#include "vectorMath.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define OFXVP_SIMD_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define OFXVP_TARGET_AVX
+    #else
+        #define OFXVP_TARGET_AVX __attribute__((target("avx")))
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define OFXVP_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace ofxVPMath {
+
+    enum KERNEL_OP { OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MIN, OP_MAX, OP_COUNT };
+
+    typedef void (*BinaryFunc)(const float*, const float*, float*, size_t);
+    typedef void (*BinaryKFunc)(const float*, float, float*, size_t);
+    typedef void (*AbsFunc)(const float*, float*, size_t);
+    typedef void (*ScaleFunc)(const float*, float, float, float*, size_t);
+    typedef void (*ClampFunc)(const float*, float, float, float*, size_t);
+    typedef float (*DotFunc)(const float*, const float*, size_t);
+    typedef float (*SumFunc)(const float*, size_t);
+    typedef void (*ToBytesFunc)(const float*, float, float, unsigned char*, size_t);
+    typedef void (*ToFloatsFunc)(const unsigned char*, float, float, float*, size_t);
+
+    struct KernelTable {
+        BinaryFunc  binary[OP_COUNT];
+        BinaryKFunc binaryK[OP_COUNT];
+        AbsFunc     abs;
+        ScaleFunc   scale;
+        ClampFunc   clamp;
+        DotFunc     dot;
+        SumFunc     sum;
+        ToBytesFunc toBytes;
+        ToFloatsFunc toFloats;
+    };
+
+    //---------------------------------------------------------------------------------- SCALAR
+    // min/max follow _mm_min_ps/_mm_max_ps: b is returned when either operand is NaN,
+    // so the result doesn't depend on the SIMD level (nor on the scalar tail of a kernel)
+    inline float scalarMin(float a, float b){ return a < b ? a : b; }
+    inline float scalarMax(float a, float b){ return a > b ? a : b; }
+    // max(a,lo) then min(.,hi), like the vector clamps: NaN gives lo
+    inline float scalarClamp(float a, float lo, float hi){ return scalarMin(scalarMax(a,lo),hi); }
+
+    template<int OP>
+    inline float scalarOp(float a, float b){
+        switch(OP){
+            case OP_ADD: return a + b;
+            case OP_SUB: return a - b;
+            case OP_MUL: return a * b;
+            case OP_DIV: return a / b;
+            case OP_MIN: return scalarMin(a,b);
+            case OP_MAX: return scalarMax(a,b);
+            default: return a;
+        }
+    }
+
+    template<int OP>
+    void binaryScalar(const float *a, const float *b, float *out, size_t n){
+        for(size_t i=0;i<n;i++) out[i] = scalarOp<OP>(a[i],b[i]);
+    }
+
+    template<int OP>
+    void binaryKScalar(const float *a, float k, float *out, size_t n){
+        for(size_t i=0;i<n;i++) out[i] = scalarOp<OP>(a[i],k);
+    }
+
+    void absScalar(const float *a, float *out, size_t n){
+        for(size_t i=0;i<n;i++) out[i] = std::fabs(a[i]);
+    }
+
+    void scaleScalar(const float *a, float s, float offset, float *out, size_t n){
+        for(size_t i=0;i<n;i++) out[i] = a[i]*s + offset;
+    }
+
+    void clampScalar(const float *a, float lo, float hi, float *out, size_t n){
+        for(size_t i=0;i<n;i++) out[i] = scalarClamp(a[i],lo,hi);
+    }
+
+    float dotScalar(const float *a, const float *b, size_t n){
+        float r = 0.0f;
+        for(size_t i=0;i<n;i++) r += a[i]*b[i];
+        return r;
+    }
+
+    float sumScalar(const float *a, size_t n){
+        float r = 0.0f;
+        for(size_t i=0;i<n;i++) r += a[i];
+        return r;
+    }
+
+    void toBytesScalar(const float *a, float s, float offset, unsigned char *out, size_t n){
+        for(size_t i=0;i<n;i++){
+            float v = a[i]*s + offset;
+            v = scalarClamp(v,0.0f,255.0f);
+            out[i] = static_cast<unsigned char>(v);
+        }
+    }
+
+    void toFloatsScalar(const unsigned char *a, float s, float offset, float *out, size_t n){
+        for(size_t i=0;i<n;i++) out[i] = static_cast<float>(a[i])*s + offset;
+    }
+
+#ifdef OFXVP_SIMD_X86
+    //---------------------------------------------------------------------------------- SSE
+    template<int OP>
+    inline __m128 sseOp(__m128 a, __m128 b){
+        switch(OP){
+            case OP_ADD: return _mm_add_ps(a,b);
+            case OP_SUB: return _mm_sub_ps(a,b);
+            case OP_MUL: return _mm_mul_ps(a,b);
+            case OP_DIV: return _mm_div_ps(a,b);
+            case OP_MIN: return _mm_min_ps(a,b);
+            case OP_MAX: return _mm_max_ps(a,b);
+            default: return a;
+        }
+    }
+
+    inline float sseHorizontalSum(__m128 v){
+        __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2,3,0,1));
+        __m128 sums = _mm_add_ps(v, shuf);
+        shuf        = _mm_movehl_ps(shuf, sums);
+        sums        = _mm_add_ss(sums, shuf);
+        return _mm_cvtss_f32(sums);
+    }
+
+    template<int OP>
+    void binarySSE(const float *a, const float *b, float *out, size_t n){
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            _mm_storeu_ps(out+i, sseOp<OP>(_mm_loadu_ps(a+i),_mm_loadu_ps(b+i)));
+        }
+        for(;i<n;i++) out[i] = scalarOp<OP>(a[i],b[i]);
+    }
+
+    template<int OP>
+    void binaryKSSE(const float *a, float k, float *out, size_t n){
+        const __m128 vk = _mm_set1_ps(k);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            _mm_storeu_ps(out+i, sseOp<OP>(_mm_loadu_ps(a+i),vk));
+        }
+        for(;i<n;i++) out[i] = scalarOp<OP>(a[i],k);
+    }
+
+    void absSSE(const float *a, float *out, size_t n){
+        const __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            _mm_storeu_ps(out+i, _mm_and_ps(_mm_loadu_ps(a+i),mask));
+        }
+        for(;i<n;i++) out[i] = std::fabs(a[i]);
+    }
+
+    void scaleSSE(const float *a, float s, float offset, float *out, size_t n){
+        const __m128 vs = _mm_set1_ps(s);
+        const __m128 vo = _mm_set1_ps(offset);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            _mm_storeu_ps(out+i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a+i),vs),vo));
+        }
+        for(;i<n;i++) out[i] = a[i]*s + offset;
+    }
+
+    void clampSSE(const float *a, float lo, float hi, float *out, size_t n){
+        const __m128 vlo = _mm_set1_ps(lo);
+        const __m128 vhi = _mm_set1_ps(hi);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            _mm_storeu_ps(out+i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(a+i),vlo),vhi));
+        }
+        for(;i<n;i++) out[i] = scalarClamp(a[i],lo,hi);
+    }
+
+    float dotSSE(const float *a, const float *b, size_t n){
+        __m128 acc = _mm_setzero_ps();
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a+i),_mm_loadu_ps(b+i)));
+        }
+        float r = sseHorizontalSum(acc);
+        for(;i<n;i++) r += a[i]*b[i];
+        return r;
+    }
+
+    float sumSSE(const float *a, size_t n){
+        __m128 acc = _mm_setzero_ps();
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            acc = _mm_add_ps(acc, _mm_loadu_ps(a+i));
+        }
+        float r = sseHorizontalSum(acc);
+        for(;i<n;i++) r += a[i];
+        return r;
+    }
+
+    void toBytesSSE(const float *a, float s, float offset, unsigned char *out, size_t n){
+        const __m128 vs     = _mm_set1_ps(s);
+        const __m128 vo     = _mm_set1_ps(offset);
+        const __m128 vzero  = _mm_setzero_ps();
+        const __m128 vmax   = _mm_set1_ps(255.0f);
+        size_t i = 0;
+        for(;i+16<=n;i+=16){
+            __m128i i0 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a+i),vs),vo),vzero),vmax));
+            __m128i i1 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a+i+4),vs),vo),vzero),vmax));
+            __m128i i2 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a+i+8),vs),vo),vzero),vmax));
+            __m128i i3 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a+i+12),vs),vo),vzero),vmax));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out+i), _mm_packus_epi16(_mm_packs_epi32(i0,i1),_mm_packs_epi32(i2,i3)));
+        }
+        toBytesScalar(a+i,s,offset,out+i,n-i);
+    }
+
+    void toFloatsSSE(const unsigned char *a, float s, float offset, float *out, size_t n){
+        const __m128 vs     = _mm_set1_ps(s);
+        const __m128 vo     = _mm_set1_ps(offset);
+        const __m128i vzero = _mm_setzero_si128();
+        size_t i = 0;
+        for(;i+16<=n;i+=16){
+            __m128i bytes   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a+i));
+            __m128i lo      = _mm_unpacklo_epi8(bytes,vzero);
+            __m128i hi      = _mm_unpackhi_epi8(bytes,vzero);
+            _mm_storeu_ps(out+i,    _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo,vzero)),vs),vo));
+            _mm_storeu_ps(out+i+4,  _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo,vzero)),vs),vo));
+            _mm_storeu_ps(out+i+8,  _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi,vzero)),vs),vo));
+            _mm_storeu_ps(out+i+12, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi,vzero)),vs),vo));
+        }
+        toFloatsScalar(a+i,s,offset,out+i,n-i);
+    }
+
+    // AVX1 has no 256 bit integer packing, byte conversions stay on SSE
+    #define toBytesAVX  toBytesSSE
+    #define toFloatsAVX toFloatsSSE
+
+    //---------------------------------------------------------------------------------- AVX
+    template<int OP>
+    OFXVP_TARGET_AVX inline __m256 avxOp(__m256 a, __m256 b){
+        switch(OP){
+            case OP_ADD: return _mm256_add_ps(a,b);
+            case OP_SUB: return _mm256_sub_ps(a,b);
+            case OP_MUL: return _mm256_mul_ps(a,b);
+            case OP_DIV: return _mm256_div_ps(a,b);
+            case OP_MIN: return _mm256_min_ps(a,b);
+            case OP_MAX: return _mm256_max_ps(a,b);
+            default: return a;
+        }
+    }
+
+    OFXVP_TARGET_AVX inline float avxHorizontalSum(__m256 v){
+        __m128 lo = _mm256_castps256_ps128(v);
+        __m128 hi = _mm256_extractf128_ps(v, 1);
+        return sseHorizontalSum(_mm_add_ps(lo, hi));
+    }
+
+    template<int OP>
+    OFXVP_TARGET_AVX void binaryAVX(const float *a, const float *b, float *out, size_t n){
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            _mm256_storeu_ps(out+i, avxOp<OP>(_mm256_loadu_ps(a+i),_mm256_loadu_ps(b+i)));
+        }
+        for(;i<n;i++) out[i] = scalarOp<OP>(a[i],b[i]);
+    }
+
+    template<int OP>
+    OFXVP_TARGET_AVX void binaryKAVX(const float *a, float k, float *out, size_t n){
+        const __m256 vk = _mm256_set1_ps(k);
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            _mm256_storeu_ps(out+i, avxOp<OP>(_mm256_loadu_ps(a+i),vk));
+        }
+        for(;i<n;i++) out[i] = scalarOp<OP>(a[i],k);
+    }
+
+    OFXVP_TARGET_AVX void absAVX(const float *a, float *out, size_t n){
+        const __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            _mm256_storeu_ps(out+i, _mm256_and_ps(_mm256_loadu_ps(a+i),mask));
+        }
+        for(;i<n;i++) out[i] = std::fabs(a[i]);
+    }
+
+    OFXVP_TARGET_AVX void scaleAVX(const float *a, float s, float offset, float *out, size_t n){
+        const __m256 vs = _mm256_set1_ps(s);
+        const __m256 vo = _mm256_set1_ps(offset);
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            _mm256_storeu_ps(out+i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(a+i),vs),vo));
+        }
+        for(;i<n;i++) out[i] = a[i]*s + offset;
+    }
+
+    OFXVP_TARGET_AVX void clampAVX(const float *a, float lo, float hi, float *out, size_t n){
+        const __m256 vlo = _mm256_set1_ps(lo);
+        const __m256 vhi = _mm256_set1_ps(hi);
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            _mm256_storeu_ps(out+i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(a+i),vlo),vhi));
+        }
+        for(;i<n;i++) out[i] = scalarClamp(a[i],lo,hi);
+    }
+
+    OFXVP_TARGET_AVX float dotAVX(const float *a, const float *b, size_t n){
+        __m256 acc = _mm256_setzero_ps();
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a+i),_mm256_loadu_ps(b+i)));
+        }
+        float r = avxHorizontalSum(acc);
+        for(;i<n;i++) r += a[i]*b[i];
+        return r;
+    }
+
+    OFXVP_TARGET_AVX float sumAVX(const float *a, size_t n){
+        __m256 acc = _mm256_setzero_ps();
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            acc = _mm256_add_ps(acc, _mm256_loadu_ps(a+i));
+        }
+        float r = avxHorizontalSum(acc);
+        for(;i<n;i++) r += a[i];
+        return r;
+    }
+
+    bool cpuHasAVX(){
+    #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx     = (info[2] & (1 << 28)) != 0;
+        if(!osxsave || !avx) return false;
+        // check the OS saves the ymm registers
+        return (_xgetbv(0) & 0x6) == 0x6;
+    #else
+        return __builtin_cpu_supports("avx");
+    #endif
+    }
+#endif
+
+#ifdef OFXVP_SIMD_NEON
+    //---------------------------------------------------------------------------------- NEON
+    // vminq/vmaxq propagate NaN, select like the SSE min/max instead
+    inline float32x4_t neonMin(float32x4_t a, float32x4_t b){ return vbslq_f32(vcltq_f32(a,b),a,b); }
+    inline float32x4_t neonMax(float32x4_t a, float32x4_t b){ return vbslq_f32(vcgtq_f32(a,b),a,b); }
+
+    template<int OP>
+    inline float32x4_t neonOp(float32x4_t a, float32x4_t b){
+        switch(OP){
+            case OP_ADD: return vaddq_f32(a,b);
+            case OP_SUB: return vsubq_f32(a,b);
+            case OP_MUL: return vmulq_f32(a,b);
+            case OP_DIV: return vdivq_f32(a,b);
+            case OP_MIN: return neonMin(a,b);
+            case OP_MAX: return neonMax(a,b);
+            default: return a;
+        }
+    }
+
+    template<int OP>
+    void binaryNEON(const float *a, const float *b, float *out, size_t n){
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            vst1q_f32(out+i, neonOp<OP>(vld1q_f32(a+i),vld1q_f32(b+i)));
+        }
+        for(;i<n;i++) out[i] = scalarOp<OP>(a[i],b[i]);
+    }
+
+    template<int OP>
+    void binaryKNEON(const float *a, float k, float *out, size_t n){
+        const float32x4_t vk = vdupq_n_f32(k);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            vst1q_f32(out+i, neonOp<OP>(vld1q_f32(a+i),vk));
+        }
+        for(;i<n;i++) out[i] = scalarOp<OP>(a[i],k);
+    }
+
+    void absNEON(const float *a, float *out, size_t n){
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            vst1q_f32(out+i, vabsq_f32(vld1q_f32(a+i)));
+        }
+        for(;i<n;i++) out[i] = std::fabs(a[i]);
+    }
+
+    void scaleNEON(const float *a, float s, float offset, float *out, size_t n){
+        const float32x4_t vs = vdupq_n_f32(s);
+        const float32x4_t vo = vdupq_n_f32(offset);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            vst1q_f32(out+i, vmlaq_f32(vo,vld1q_f32(a+i),vs));
+        }
+        for(;i<n;i++) out[i] = a[i]*s + offset;
+    }
+
+    void clampNEON(const float *a, float lo, float hi, float *out, size_t n){
+        const float32x4_t vlo = vdupq_n_f32(lo);
+        const float32x4_t vhi = vdupq_n_f32(hi);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            vst1q_f32(out+i, neonMin(neonMax(vld1q_f32(a+i),vlo),vhi));
+        }
+        for(;i<n;i++) out[i] = scalarClamp(a[i],lo,hi);
+    }
+
+    float dotNEON(const float *a, const float *b, size_t n){
+        float32x4_t acc = vdupq_n_f32(0.0f);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            acc = vmlaq_f32(acc,vld1q_f32(a+i),vld1q_f32(b+i));
+        }
+        float r = vaddvq_f32(acc);
+        for(;i<n;i++) r += a[i]*b[i];
+        return r;
+    }
+
+    float sumNEON(const float *a, size_t n){
+        float32x4_t acc = vdupq_n_f32(0.0f);
+        size_t i = 0;
+        for(;i+4<=n;i+=4){
+            acc = vaddq_f32(acc,vld1q_f32(a+i));
+        }
+        float r = vaddvq_f32(acc);
+        for(;i<n;i++) r += a[i];
+        return r;
+    }
+
+    void toBytesNEON(const float *a, float s, float offset, unsigned char *out, size_t n){
+        const float32x4_t vs    = vdupq_n_f32(s);
+        const float32x4_t vo    = vdupq_n_f32(offset);
+        const float32x4_t vzero = vdupq_n_f32(0.0f);
+        const float32x4_t vmax  = vdupq_n_f32(255.0f);
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            uint32x4_t i0 = vcvtq_u32_f32(neonMin(neonMax(vmlaq_f32(vo,vld1q_f32(a+i),vs),vzero),vmax));
+            uint32x4_t i1 = vcvtq_u32_f32(neonMin(neonMax(vmlaq_f32(vo,vld1q_f32(a+i+4),vs),vzero),vmax));
+            vst1_u8(out+i, vmovn_u16(vcombine_u16(vmovn_u32(i0),vmovn_u32(i1))));
+        }
+        toBytesScalar(a+i,s,offset,out+i,n-i);
+    }
+
+    void toFloatsNEON(const unsigned char *a, float s, float offset, float *out, size_t n){
+        const float32x4_t vs    = vdupq_n_f32(s);
+        const float32x4_t vo    = vdupq_n_f32(offset);
+        size_t i = 0;
+        for(;i+8<=n;i+=8){
+            uint16x8_t w = vmovl_u8(vld1_u8(a+i));
+            vst1q_f32(out+i,   vmlaq_f32(vo,vcvtq_f32_u32(vmovl_u16(vget_low_u16(w))),vs));
+            vst1q_f32(out+i+4, vmlaq_f32(vo,vcvtq_f32_u32(vmovl_u16(vget_high_u16(w))),vs));
+        }
+        toFloatsScalar(a+i,s,offset,out+i,n-i);
+    }
+#endif
+
+    //---------------------------------------------------------------------------------- DISPATCH
+    #define OFXVP_FILL_TABLE(T, SUFFIX)                                                         \
+        T.binary[OP_ADD] = binary##SUFFIX<OP_ADD>;   T.binaryK[OP_ADD] = binaryK##SUFFIX<OP_ADD>; \
+        T.binary[OP_SUB] = binary##SUFFIX<OP_SUB>;   T.binaryK[OP_SUB] = binaryK##SUFFIX<OP_SUB>; \
+        T.binary[OP_MUL] = binary##SUFFIX<OP_MUL>;   T.binaryK[OP_MUL] = binaryK##SUFFIX<OP_MUL>; \
+        T.binary[OP_DIV] = binary##SUFFIX<OP_DIV>;   T.binaryK[OP_DIV] = binaryK##SUFFIX<OP_DIV>; \
+        T.binary[OP_MIN] = binary##SUFFIX<OP_MIN>;   T.binaryK[OP_MIN] = binaryK##SUFFIX<OP_MIN>; \
+        T.binary[OP_MAX] = binary##SUFFIX<OP_MAX>;   T.binaryK[OP_MAX] = binaryK##SUFFIX<OP_MAX>; \
+        T.abs   = abs##SUFFIX;                                                                  \
+        T.scale = scale##SUFFIX;                                                                \
+        T.clamp = clamp##SUFFIX;                                                                \
+        T.dot   = dot##SUFFIX;                                                                  \
+        T.sum   = sum##SUFFIX;                                                                  \
+        T.toBytes  = toBytes##SUFFIX;                                                           \
+        T.toFloats = toFloats##SUFFIX;
+
+    static KernelTable makeTable(SIMD_LEVEL level){
+        KernelTable t;
+        switch(level){
+    #ifdef OFXVP_SIMD_X86
+            case SIMD_AVX:
+                OFXVP_FILL_TABLE(t, AVX)
+                break;
+            case SIMD_SSE:
+                OFXVP_FILL_TABLE(t, SSE)
+                break;
+    #endif
+    #ifdef OFXVP_SIMD_NEON
+            case SIMD_NEON:
+                OFXVP_FILL_TABLE(t, NEON)
+                break;
+    #endif
+            default:
+                OFXVP_FILL_TABLE(t, Scalar)
+                break;
+        }
+        return t;
+    }
+
+    SIMD_LEVEL getSupportedSIMDLevel(){
+    #if defined(OFXVP_SIMD_X86)
+        static const SIMD_LEVEL supported = cpuHasAVX() ? SIMD_AVX : SIMD_SSE;
+        return supported;
+    #elif defined(OFXVP_SIMD_NEON)
+        return SIMD_NEON;
+    #else
+        return SIMD_SCALAR;
+    #endif
+    }
+
+    static std::atomic<int>& currentLevel(){
+        static std::atomic<int> level(static_cast<int>(getSupportedSIMDLevel()));
+        return level;
+    }
+
+    static const KernelTable& kernels(){
+        static const KernelTable tables[] = { makeTable(SIMD_SCALAR), makeTable(SIMD_SSE), makeTable(SIMD_AVX), makeTable(SIMD_NEON) };
+        return tables[currentLevel().load(std::memory_order_relaxed)];
+    }
+
+    SIMD_LEVEL getSIMDLevel(){
+        return static_cast<SIMD_LEVEL>(currentLevel().load());
+    }
+
+    const char* getSIMDLevelName(SIMD_LEVEL level){
+        switch(level){
+            case SIMD_SSE:  return "SSE";
+            case SIMD_AVX:  return "AVX";
+            case SIMD_NEON: return "NEON";
+            default:        return "scalar";
+        }
+    }
+
+    void setSIMDLevel(SIMD_LEVEL level){
+        SIMD_LEVEL supported = getSupportedSIMDLevel();
+        if(level != SIMD_SCALAR && level > supported){
+            level = supported;
+        }
+        if(supported == SIMD_NEON && level != SIMD_SCALAR){
+            level = SIMD_NEON;
+        }
+        currentLevel().store(static_cast<int>(level));
+    }
+
+    //---------------------------------------------------------------------------------- API
+    void add(const float *a, const float *b, float *out, size_t n){ kernels().binary[OP_ADD](a,b,out,n); }
+    void sub(const float *a, const float *b, float *out, size_t n){ kernels().binary[OP_SUB](a,b,out,n); }
+    void mul(const float *a, const float *b, float *out, size_t n){ kernels().binary[OP_MUL](a,b,out,n); }
+    void div(const float *a, const float *b, float *out, size_t n){ kernels().binary[OP_DIV](a,b,out,n); }
+    void min(const float *a, const float *b, float *out, size_t n){ kernels().binary[OP_MIN](a,b,out,n); }
+    void max(const float *a, const float *b, float *out, size_t n){ kernels().binary[OP_MAX](a,b,out,n); }
+
+    void add(const float *a, float k, float *out, size_t n){ kernels().binaryK[OP_ADD](a,k,out,n); }
+    void sub(const float *a, float k, float *out, size_t n){ kernels().binaryK[OP_SUB](a,k,out,n); }
+    void mul(const float *a, float k, float *out, size_t n){ kernels().binaryK[OP_MUL](a,k,out,n); }
+    void div(const float *a, float k, float *out, size_t n){ kernels().binaryK[OP_DIV](a,k,out,n); }
+    void min(const float *a, float k, float *out, size_t n){ kernels().binaryK[OP_MIN](a,k,out,n); }
+    void max(const float *a, float k, float *out, size_t n){ kernels().binaryK[OP_MAX](a,k,out,n); }
+
+    void abs(const float *a, float *out, size_t n){ kernels().abs(a,out,n); }
+    void scale(const float *a, float s, float offset, float *out, size_t n){ kernels().scale(a,s,offset,out,n); }
+    void clamp(const float *a, float lo, float hi, float *out, size_t n){ kernels().clamp(a,lo,hi,out,n); }
+
+    void map(const float *a, float inMin, float inMax, float outMin, float outMax, float *out, size_t n, bool clampOutput){
+        if(std::fabs(inMin - inMax) < 1.192092896e-07F){
+            // same as ofMap, degenerate input range
+            for(size_t i=0;i<n;i++) out[i] = outMin;
+            return;
+        }
+        float s = (outMax - outMin)/(inMax - inMin);
+        kernels().scale(a,s,outMin - inMin*s,out,n);
+        if(clampOutput){
+            if(outMax < outMin){
+                kernels().clamp(out,outMax,outMin,out,n);
+            }else{
+                kernels().clamp(out,outMin,outMax,out,n);
+            }
+        }
+    }
+
+    float dot(const float *a, const float *b, size_t n){ return kernels().dot(a,b,n); }
+    float sum(const float *a, size_t n){ return kernels().sum(a,n); }
+
+    void copy(const float *a, size_t n, std::vector<float> &out, size_t offset){
+        if(out.size() < offset + n){
+            prepare(out,offset + n);
+        }
+        if(n > 0){
+            std::memcpy(out.data() + offset, a, n*sizeof(float));
+        }
+    }
+
+    void floatsToBytes(const float *a, float inMin, float inMax, unsigned char *out, size_t n){
+        if(std::fabs(inMin - inMax) < 1.192092896e-07F){
+            std::memset(out, 0, n);
+            return;
+        }
+        float s = 255.0f/(inMax - inMin);
+        kernels().toBytes(a,s,-inMin*s,out,n);
+    }
+
+    void bytesToFloats(const unsigned char *a, float outMin, float outMax, float *out, size_t n){
+        kernels().toFloats(a,(outMax - outMin)/255.0f,outMin,out,n);
+    }
+
+    void resampleNearest(const float *a, size_t srcN, float *out, size_t outN){
+        if(srcN == outN){
+            if(a != out && outN > 0) std::memcpy(out, a, outN*sizeof(float));
+            return;
+        }
+        if(srcN == 0){
+            std::memset(out, 0, outN*sizeof(float));
+            return;
+        }
+        // integer stepping, avoids a division per element
+        size_t index = 0;
+        size_t error = 0;
+        for(size_t i=0;i<outN;i++){
+            out[i] = a[index];
+            error += srcN;
+            while(error >= outN){
+                error -= outN;
+                index++;
+            }
+        }
+    }
+
+    void interleaveRGB(const unsigned char *r, const unsigned char *g, const unsigned char *b, unsigned char *out, size_t n){
+        for(size_t i=0;i<n;i++){
+            out[i*3]    = r[i];
+            out[i*3+1]  = g[i];
+            out[i*3+2]  = b[i];
+        }
+    }
+
+    void resizeNearest(const unsigned char *src, size_t srcW, size_t srcH, unsigned char *dst, size_t dstW, size_t dstH, size_t channels){
+        if(srcW == 0 || srcH == 0 || dstW == 0 || dstH == 0) return;
+
+        thread_local std::vector<size_t> columnOffsets;
+        columnOffsets.resize(dstW);
+        for(size_t x=0;x<dstW;x++){
+            columnOffsets[x] = (x*srcW/dstW)*channels;
+        }
+
+        const size_t dstRowSize = dstW*channels;
+        size_t prevSrcY = srcH;
+        for(size_t y=0;y<dstH;y++){
+            size_t srcY = y*srcH/dstH;
+            unsigned char *dstRow = dst + y*dstRowSize;
+            if(srcY == prevSrcY){
+                // same source row as the previous one, just duplicate it
+                std::memcpy(dstRow, dstRow - dstRowSize, dstRowSize);
+                continue;
+            }
+            const unsigned char *srcRow = src + srcY*srcW*channels;
+            for(size_t x=0;x<dstW;x++){
+                const unsigned char *p = srcRow + columnOffsets[x];
+                unsigned char *q = dstRow + x*channels;
+                for(size_t c=0;c<channels;c++){
+                    q[c] = p[c];
+                }
+            }
+            prevSrcY = srcY;
+        }
+    }
+
+}
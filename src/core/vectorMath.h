@@ -0,0 +1,125 @@
+/*==============================================================================
+
+    ofxVisualProgramming: A visual programming patching environment for OF
+
+    Copyright (c) 2019 Emanuele Mazza aka n3m3da <emanuelemazza@d3cod3.org>
+
+    ofxVisualProgramming is distributed under the MIT License.
+    This gives everyone the freedoms to use ofxVisualProgramming in any context:
+    commercial or non-commercial, public or private, open or closed source.
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+    OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+    See https://github.com/d3cod3/ofxVisualProgramming for documentation
+
+==============================================================================*/
+
+//  Vectorized float kernels shared by the data objects.
+//  The best instruction set available (SSE, AVX or NEON) is selected
+//  at runtime, with a plain scalar fallback on every other platform.
+//
+//  min, max and clamp follow the SSE rules on NaN (the second operand,
+//  lo for clamp), whatever the level, so results never depend on it.
+//
+//  All kernels accept out == a (in place), and the std::vector helpers
+//  only grow the output capacity, so a buffer reused every frame never
+//  reallocates once it reached its working size.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ofxVPMath {
+
+    enum SIMD_LEVEL {
+        SIMD_SCALAR,
+        SIMD_SSE,
+        SIMD_AVX,
+        SIMD_NEON
+    };
+
+    // best level supported by the running cpu
+    SIMD_LEVEL getSupportedSIMDLevel();
+    // level currently used by the kernels
+    SIMD_LEVEL getSIMDLevel();
+    const char* getSIMDLevelName(SIMD_LEVEL level);
+    // force a lower level (ex. to compare against the scalar path), clamped to the supported one
+    void setSIMDLevel(SIMD_LEVEL level);
+
+    // out[i] = a[i] (op) b[i]
+    void add(const float *a, const float *b, float *out, size_t n);
+    void sub(const float *a, const float *b, float *out, size_t n);
+    void mul(const float *a, const float *b, float *out, size_t n);
+    void div(const float *a, const float *b, float *out, size_t n);
+    void min(const float *a, const float *b, float *out, size_t n);
+    void max(const float *a, const float *b, float *out, size_t n);
+
+    // out[i] = a[i] (op) k
+    void add(const float *a, float k, float *out, size_t n);
+    void sub(const float *a, float k, float *out, size_t n);
+    void mul(const float *a, float k, float *out, size_t n);
+    void div(const float *a, float k, float *out, size_t n);
+    void min(const float *a, float k, float *out, size_t n);
+    void max(const float *a, float k, float *out, size_t n);
+
+    // out[i] = |a[i]|
+    void abs(const float *a, float *out, size_t n);
+    // out[i] = a[i]*s + offset
+    void scale(const float *a, float s, float offset, float *out, size_t n);
+    // out[i] = clamp(a[i], lo, hi)
+    void clamp(const float *a, float lo, float hi, float *out, size_t n);
+    // same as ofMap on every element
+    void map(const float *a, float inMin, float inMax, float outMin, float outMax, float *out, size_t n, bool clampOutput=false);
+
+    float dot(const float *a, const float *b, size_t n);
+    float sum(const float *a, size_t n);
+
+    // resize without ever shrinking the allocated capacity
+    inline void prepare(std::vector<float> &out, size_t n){
+        if(out.capacity() < n){
+            out.reserve(n);
+        }
+        out.resize(n);
+    }
+
+    // std::vector conveniences, out is resized to a.size()
+    inline void add(const std::vector<float> &a, float k, std::vector<float> &out){ prepare(out,a.size()); add(a.data(),k,out.data(),a.size()); }
+    inline void sub(const std::vector<float> &a, float k, std::vector<float> &out){ prepare(out,a.size()); sub(a.data(),k,out.data(),a.size()); }
+    inline void mul(const std::vector<float> &a, float k, std::vector<float> &out){ prepare(out,a.size()); mul(a.data(),k,out.data(),a.size()); }
+    inline void div(const std::vector<float> &a, float k, std::vector<float> &out){ prepare(out,a.size()); div(a.data(),k,out.data(),a.size()); }
+    inline void min(const std::vector<float> &a, float k, std::vector<float> &out){ prepare(out,a.size()); min(a.data(),k,out.data(),a.size()); }
+    inline void max(const std::vector<float> &a, float k, std::vector<float> &out){ prepare(out,a.size()); max(a.data(),k,out.data(),a.size()); }
+
+    // copy a range into out at offset, growing out if needed
+    void copy(const float *a, size_t n, std::vector<float> &out, size_t offset=0);
+
+    // DATA <-> PIXELS conversion
+    // out[i] = floor(clamp((a[i]-inMin)/(inMax-inMin), 0, 1) * 255)
+    void floatsToBytes(const float *a, float inMin, float inMax, unsigned char *out, size_t n);
+    // out[i] = outMin + a[i]/255 * (outMax-outMin)
+    void bytesToFloats(const unsigned char *a, float outMin, float outMax, float *out, size_t n);
+    // nearest neighbour resampling, out[i] = a[floor(i*srcN/outN)]
+    void resampleNearest(const float *a, size_t srcN, float *out, size_t outN);
+    // pack three planar channels into interleaved RGB
+    void interleaveRGB(const unsigned char *r, const unsigned char *g, const unsigned char *b, unsigned char *out, size_t n);
+    // nearest neighbour image scaling of interleaved 8 bit pixels
+    void resizeNearest(const unsigned char *src, size_t srcW, size_t srcH, unsigned char *dst, size_t dstW, size_t dstH, size_t channels);
+
+}
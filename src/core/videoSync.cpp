@@ -0,0 +1,237 @@
+//
+//  videoSync.cpp
+//  ofxVisualProgramming
+//
+
+#include "videoSync.h"
+
+#include "audioClock.h"
+
+#include <cmath>
+
+//--------------------------------------------------------------
+ofxVPVideoSync& ofxVPVideoSync::get(){
+    static ofxVPVideoSync sync;
+    return sync;
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::join(int g, const void *clip){
+    if(!isGroup(g)){
+        return;
+    }
+    std::lock_guard<std::mutex> lck(mutex);
+    group(g).clips[clip] = Clip();
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::leave(int g, const void *clip){
+    if(!isGroup(g)){
+        return;
+    }
+    std::lock_guard<std::mutex> lck(mutex);
+    group(g).clips.erase(clip);
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::play(int g){
+    if(!isGroup(g)){
+        return;
+    }
+    double now = ofxVPAudioClock::get().now();
+    std::lock_guard<std::mutex> lck(mutex);
+    Group &gr = group(g);
+    if(gr.state == VIDEO_SYNC_PLAYING || gr.state == VIDEO_SYNC_PREROLL){
+        return;
+    }
+    gr.state = VIDEO_SYNC_PREROLL;
+    gr.epoch++;
+    gr.prerollStart = now;
+    startIfPrerolled(gr,now);
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::stop(int g){
+    if(!isGroup(g)){
+        return;
+    }
+    std::lock_guard<std::mutex> lck(mutex);
+    Group &gr = group(g);
+    gr.state = VIDEO_SYNC_STOPPED;
+    gr.basePosition = 0.0;
+    gr.epoch++;
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::setPaused(int g, bool paused){
+    if(!isGroup(g)){
+        return;
+    }
+    double now = ofxVPAudioClock::get().now();
+    {
+        std::lock_guard<std::mutex> lck(mutex);
+        Group &gr = group(g);
+        if(paused){
+            if(gr.state == VIDEO_SYNC_PLAYING){
+                gr.basePosition = position(gr,now);
+                gr.state = VIDEO_SYNC_PAUSED;
+                gr.epoch++;
+            }else if(gr.state == VIDEO_SYNC_PREROLL){
+                gr.state = VIDEO_SYNC_PAUSED;
+            }
+            return;
+        }
+        if(gr.state != VIDEO_SYNC_PAUSED){
+            return;
+        }
+    }
+    // resuming prerolls again, the clips may have drifted while paused
+    play(g);
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::seek(int g, double seconds){
+    if(!isGroup(g)){
+        return;
+    }
+    double now = ofxVPAudioClock::get().now();
+    std::lock_guard<std::mutex> lck(mutex);
+    Group &gr = group(g);
+    gr.basePosition = seconds < 0.0 ? 0.0 : seconds;
+    gr.startTime = now;
+    gr.epoch++;
+    if(gr.state == VIDEO_SYNC_PREROLL){
+        gr.prerollStart = now;
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::setSpeed(int g, float speed){
+    if(!isGroup(g)){
+        return;
+    }
+    double now = ofxVPAudioClock::get().now();
+    std::lock_guard<std::mutex> lck(mutex);
+    Group &gr = group(g);
+    if(gr.speed == speed){
+        return;
+    }
+    gr.basePosition = position(gr,now);
+    gr.startTime = now;
+    gr.speed = speed;
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::setLoop(int g, bool loop){
+    if(!isGroup(g)){
+        return;
+    }
+    std::lock_guard<std::mutex> lck(mutex);
+    group(g).loop = loop;
+}
+
+//--------------------------------------------------------------
+ofxVPVideoSyncTarget ofxVPVideoSync::getTarget(int g){
+    ofxVPVideoSyncTarget target;
+    if(!isGroup(g)){
+        return target;
+    }
+    double now = ofxVPAudioClock::get().now();
+    std::lock_guard<std::mutex> lck(mutex);
+    Group &gr = group(g);
+    startIfPrerolled(gr,now);
+    target.state    = gr.state;
+    target.position = position(gr,now);
+    target.speed    = gr.speed;
+    target.loop     = gr.loop;
+    target.epoch    = gr.epoch;
+    return target;
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::report(int g, const void *clip, uint32_t prerolledEpoch, double error){
+    if(!isGroup(g)){
+        return;
+    }
+    double now = ofxVPAudioClock::get().now();
+    std::lock_guard<std::mutex> lck(mutex);
+    Group &gr = group(g);
+    auto it = gr.clips.find(clip);
+    if(it == gr.clips.end()){
+        return;
+    }
+    it->second.prerolledEpoch = prerolledEpoch;
+    it->second.error = error;
+    startIfPrerolled(gr,now);
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::countCorrection(int g, bool resync){
+    if(!isGroup(g)){
+        return;
+    }
+    std::lock_guard<std::mutex> lck(mutex);
+    if(resync){
+        group(g).resyncs++;
+    }else{
+        group(g).nudges++;
+    }
+}
+
+//--------------------------------------------------------------
+ofxVPVideoSyncStats ofxVPVideoSync::getStats(int g){
+    ofxVPVideoSyncStats stats;
+    if(!isGroup(g)){
+        return stats;
+    }
+    std::lock_guard<std::mutex> lck(mutex);
+    Group &gr = group(g);
+    stats.state     = gr.state;
+    stats.clips     = static_cast<int>(gr.clips.size());
+    stats.resyncs   = gr.resyncs;
+    stats.nudges    = gr.nudges;
+    stats.prerollMs = gr.prerollMs;
+    double sum = 0.0;
+    for(auto it = gr.clips.begin(); it != gr.clips.end(); it++){
+        double e = std::fabs(it->second.error)*1000.0;
+        sum += e;
+        if(e > stats.maxErrorMs){
+            stats.maxErrorMs = static_cast<float>(e);
+        }
+    }
+    if(!gr.clips.empty()){
+        stats.errorMs = static_cast<float>(sum/gr.clips.size());
+    }
+    return stats;
+}
+
+//--------------------------------------------------------------
+double ofxVPVideoSync::position(const Group &g, double now) const{
+    if(g.state != VIDEO_SYNC_PLAYING){
+        return g.basePosition;
+    }
+    double p = g.basePosition + (now - g.startTime)*g.speed;
+    return p < 0.0 ? 0.0 : p;
+}
+
+//--------------------------------------------------------------
+void ofxVPVideoSync::startIfPrerolled(Group &g, double now){
+    if(g.state != VIDEO_SYNC_PREROLL){
+        return;
+    }
+    bool ready = now - g.prerollStart > VIDEO_SYNC_PREROLL_TIMEOUT;
+    if(!ready){
+        ready = true;
+        for(auto it = g.clips.begin(); it != g.clips.end(); it++){
+            if(it->second.prerolledEpoch != g.epoch){
+                ready = false;
+                break;
+            }
+        }
+    }
+    if(ready){
+        g.state = VIDEO_SYNC_PLAYING;
+        g.startTime = now;
+        g.prerollMs = static_cast<float>((now - g.prerollStart)*1000.0);
+    }
+}
@@ -0,0 +1,117 @@
+//
+//  videoSync.h
+//  ofxVisualProgramming
+//
+//  Sync groups of video players. The clips of a group follow one master
+//  transport running on the patch clock (ofxVPAudioClock) instead of their
+//  own player clocks: every decode step a clip compares its position with
+//  the group position and corrects the drift, nudging its speed for small
+//  errors and seeking to the exact frame for large ones.
+//
+//  Starting a group prerolls it: all the clips seek to the start frame and
+//  wait paused until each one decoded it (or VIDEO_SYNC_PREROLL_TIMEOUT),
+//  then the group clock starts for all of them at once.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#define VIDEO_SYNC_MAX_GROUPS       8
+// drift (in frames) corrected by nudging the clip speed
+#define VIDEO_SYNC_NUDGE_FRAMES     1.0
+// drift (in frames) corrected by seeking
+#define VIDEO_SYNC_RESYNC_FRAMES    6.0
+// speed change of a nudge
+#define VIDEO_SYNC_NUDGE            0.03f
+// seconds a group waits for its late clips before starting
+#define VIDEO_SYNC_PREROLL_TIMEOUT  2.0
+
+enum VIDEO_SYNC_STATE {
+    VIDEO_SYNC_STOPPED,
+    VIDEO_SYNC_PREROLL,
+    VIDEO_SYNC_PLAYING,
+    VIDEO_SYNC_PAUSED
+};
+
+struct ofxVPVideoSyncTarget {
+    int         state       = VIDEO_SYNC_STOPPED;
+    double      position    = 0.0;  // group time in seconds
+    float       speed       = 1.0f;
+    bool        loop        = false;
+    uint32_t    epoch       = 0;    // changes on every seek, clips seek once per epoch
+};
+
+struct ofxVPVideoSyncStats {
+    int         state       = VIDEO_SYNC_STOPPED;
+    int         clips       = 0;
+    float       errorMs     = 0.0f; // mean absolute drift of the clips
+    float       maxErrorMs  = 0.0f;
+    uint64_t    resyncs     = 0;
+    uint64_t    nudges      = 0;
+    float       prerollMs   = 0.0f; // duration of the last preroll
+};
+
+class ofxVPVideoSync {
+
+public:
+
+    static ofxVPVideoSync& get();
+
+    static bool isGroup(int group) { return group >= 1 && group <= VIDEO_SYNC_MAX_GROUPS; }
+
+    void        join(int group, const void *clip);
+    void        leave(int group, const void *clip);
+
+    // MASTER TRANSPORT (any thread)
+    // preroll every clip at the current position, then start them together
+    void        play(int group);
+    // back to the start
+    void        stop(int group);
+    void        setPaused(int group, bool paused);
+    void        seek(int group, double seconds);
+    void        setSpeed(int group, float speed);
+    void        setLoop(int group, bool loop);
+
+    // CLIP SIDE (decode threads)
+    ofxVPVideoSyncTarget getTarget(int group);
+    // prerolledEpoch: last epoch whose target frame the clip decoded, error: clip - group position (seconds)
+    void        report(int group, const void *clip, uint32_t prerolledEpoch, double error);
+    void        countCorrection(int group, bool resync);
+
+    ofxVPVideoSyncStats getStats(int group);
+
+protected:
+
+    ofxVPVideoSync() {}
+
+    struct Clip {
+        uint32_t    prerolledEpoch  = 0;
+        double      error           = 0.0;
+    };
+
+    struct Group {
+        int         state           = VIDEO_SYNC_STOPPED;
+        double      basePosition    = 0.0;  // group time at startTime
+        double      startTime       = 0.0;  // clock time
+        float       speed           = 1.0f;
+        bool        loop            = false;
+        uint32_t    epoch           = 1;
+        double      prerollStart    = 0.0;
+        std::map<const void*,Clip>  clips;
+        uint64_t    resyncs         = 0;
+        uint64_t    nudges          = 0;
+        float       prerollMs       = 0.0f;
+    };
+
+    // holding mutex
+    Group&      group(int g) { return groups[g-1]; }
+    double      position(const Group &g, double now) const;
+    void        startIfPrerolled(Group &g, double now);
+
+    std::mutex  mutex;
+    Group       groups[VIDEO_SYNC_MAX_GROUPS];
+
+};
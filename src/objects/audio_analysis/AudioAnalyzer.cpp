@@ -40,19 +40,21 @@ AudioAnalyzer::AudioAnalyzer() : PatchObject("audio analyzer"){
     this->numInlets  = 3;
     this->numOutlets = 2;
 
-    _inletParams[0] = new ofSoundBuffer();  // Audio stream
+    this->newInletBuffer<ofSoundBuffer>(0);  // Audio stream
 
-    _inletParams[1] = new float();  // level
-    _inletParams[2] = new float();  // smooth
+    *(float *)&_inletParams[1] = 0.0f;  // level
+    *(float *)&_inletParams[2] = 0.0f;  // smooth
     *(float *)&_inletParams[1] = 1.0f;
     *(float *)&_inletParams[2] = 0.0f;
 
-    _outletParams[0] = new vector<float>();  // Analysis Data
+    this->newOutletBuffer<vector<float>>(0);  // Analysis Data
 
     this->initInletsState();
 
     isAudioINObject                 = true;
 
+    plotVersion                     = 0;
+
     smoothingValue                  = 0.0f;
     audioInputLevel                 = 1.0f;
 
@@ -230,7 +232,7 @@ void AudioAnalyzer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
 
         // draw waveform
-        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y*0.5f), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor);
+        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y*0.5f), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor, plotVersion.load());
 
         // draw signal RMS amplitude
         _nodeCanvas.getNodeDrawList()->AddRectFilled(ImGui::GetWindowPos()+ImVec2(0,ImGui::GetWindowSize().y*0.5f),ImGui::GetWindowPos()+ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y *0.5f * (1.0f - ofClamp(static_cast<ofSoundBuffer *>(_inletParams[0])->getRMSAmplitude()*audioInputLevel,0.0,1.0))),IM_COL32(255,255,120,12));
@@ -282,6 +284,7 @@ void AudioAnalyzer::audioInObject(ofSoundBuffer &inputBuffer){
             // SIGNAL BUFFER
             static_cast<vector<float> *>(_outletParams[0])->at(i) = lastBuffer.getSample(i,0);
         }
+        plotVersion++;
 
         // ESSENTIA Analyze Audio
         lastBuffer.copyTo(monoBuffer, lastBuffer.getNumFrames(), 1, 0);
@@ -317,7 +320,7 @@ void AudioAnalyzer::loadAudioSettings(){
         audioInputLevel = this->getCustomVar("INPUT_LEVEL");
         smoothingValue = this->getCustomVar("SMOOTHING");
 
-        _outletParams[0] = new vector<float>();
+        this->newOutletBuffer<vector<float>>(0);
         // SIGNAL BUFFER
         for(int i=0;i<bufferSize;i++){
             static_cast<vector<float> *>(_outletParams[0])->push_back(0.0f);
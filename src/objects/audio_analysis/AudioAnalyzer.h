@@ -77,6 +77,7 @@ public:
     ofxAudioAnalyzer                        audioAnalyzer;
     ofxBTrack                               *beatTrack;
     float                                   plot_data[1024];
+    std::atomic<uint64_t>                   plotVersion;
     vector<float>                           spectrum;
     vector<float>                           melBands;
     vector<float>                           mfcc;
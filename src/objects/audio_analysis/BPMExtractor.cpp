@@ -40,13 +40,11 @@ BPMExtractor::BPMExtractor() : PatchObject("bpm extractor"){
     this->numInlets  = 1;
     this->numOutlets = 3;
 
-    _inletParams[0] = new vector<float>();  // RAW Data
+    this->newInletBuffer<vector<float>>(0);  // RAW Data
 
-    _outletParams[0] = new float(); // beat
-    *(float *)&_outletParams[0] = 0.0f;
-    _outletParams[1] = new float(); // BPM
-    *(float *)&_outletParams[1] = 0.0f;
-    _outletParams[2] = new float(); // MS
+    *(float *)&_outletParams[0] = 0.0f; // beat
+    *(float *)&_outletParams[1] = 0.0f; // BPM
+    *(float *)&_outletParams[2] = 0.0f; // MS
     *(float *)&_outletParams[3] = 0.0f;
 
     this->initInletsState();
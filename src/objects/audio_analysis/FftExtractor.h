@@ -57,6 +57,7 @@ public:
     
     int             bufferSize;
     int             spectrumSize;
+    uint64_t        plotVersion;
 
     bool            isNewConnection;
     bool            isConnectionRight;
@@ -40,10 +40,9 @@ HFCExtractor::HFCExtractor() : PatchObject("hfc extractor"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();  // RAW Data
+    this->newInletBuffer<vector<float>>(0);  // RAW Data
 
-    _outletParams[0] = new float(); // hfc
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // hfc
 
     this->initInletsState();
 
@@ -40,10 +40,9 @@ InharmonicityExtractor::InharmonicityExtractor() : PatchObject("inharmonicity ex
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();  // RAW Data
+    this->newInletBuffer<vector<float>>(0);  // RAW Data
 
-    _outletParams[0] = new float(); // inharmonicity
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // inharmonicity
 
     this->initInletsState();
 
@@ -58,6 +58,7 @@ public:
 
     int             bufferSize;
     int             spectrumSize;
+    uint64_t        plotVersion;
 
     int             startPosition;
     int             endPosition;
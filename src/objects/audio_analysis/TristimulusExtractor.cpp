@@ -40,9 +40,9 @@ TristimulusExtractor::TristimulusExtractor() : PatchObject("tristimulus extracto
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();  // RAW Data
+    this->newInletBuffer<vector<float>>(0);  // RAW Data
 
-    _outletParams[0] = new vector<float>();  // MFCC Data
+    this->newOutletBuffer<vector<float>>(0);  // MFCC Data
 
     this->initInletsState();
 
@@ -54,6 +54,8 @@ TristimulusExtractor::TristimulusExtractor() : PatchObject("tristimulus extracto
 
     isNewConnection   = false;
     isConnectionRight = false;
+
+    plotVersion = 0;
 }
 
 //--------------------------------------------------------------
@@ -112,10 +114,18 @@ void TristimulusExtractor::updateObjectContent(map<int,shared_ptr<PatchObject>>
 
     if(this->inletsConnected[0] && !static_cast<vector<float> *>(_inletParams[0])->empty() && isConnectionRight){
         int index = 0;
+        bool changed = false;
         for(int i=startPosition;i<endPosition;i++){
-            static_cast<vector<float> *>(_outletParams[0])->at(index) = static_cast<vector<float> *>(_inletParams[0])->at(i);
+            float value = static_cast<vector<float> *>(_inletParams[0])->at(i);
+            if(static_cast<vector<float> *>(_outletParams[0])->at(index) != value){
+                static_cast<vector<float> *>(_outletParams[0])->at(index) = value;
+                changed = true;
+            }
             index++;
         }
+        if(changed){
+            plotVersion++;
+        }
     }else if(this->inletsConnected[0] && !isConnectionRight){
         ofLog(OF_LOG_ERROR,"%s --> This object can receive data from audio analyzer object ONLY! Just reconnect it right!",this->getName().c_str());
     }
@@ -155,7 +165,7 @@ void TristimulusExtractor::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas )
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
 
         // draw FFT
-        ImGuiEx::PlotBands(_nodeCanvas.getNodeDrawList(), 0, ImGui::GetWindowSize().y - 26, static_cast<vector<float> *>(_outletParams[0]));
+        ImGuiEx::PlotBands("##tristimulusBands", _nodeCanvas.getNodeDrawList(), 0, ImGui::GetWindowSize().y - 26, static_cast<vector<float> *>(_outletParams[0]), 1.0f, IM_COL32(255,255,120,255), plotVersion);
 
         _nodeCanvas.EndNodeContent();
     }
@@ -40,9 +40,9 @@ ArduinoSerial::ArduinoSerial() : PatchObject("arduino serial"){
     this->numInlets  = 1;
     this->numOutlets  = 1;
 
-    _inletParams[0] = new vector<float>();
+    this->newInletBuffer<vector<float>>(0);
 
-    _outletParams[0] = new vector<float>();
+    this->newOutletBuffer<vector<float>>(0);
 
     this->initInletsState();
 
@@ -51,8 +51,12 @@ ArduinoSerial::ArduinoSerial() : PatchObject("arduino serial"){
 
     serialDeviceID      = 0;
     baudRateID          = 0;
+    framingID           = SERIAL_FRAMING_RAW;
+    protocolID          = SERIAL_PROTOCOL_TEXT;
 
     baudrateList        = {"9600","19200","38400","57600","74880","115200","230400","250000"};
+    framingList         = {"Line","COBS","SLIP","Raw (MosaicConnector)"};
+    protocolList        = {"Text","Binary float"};
 
     resetTime           = ofGetElapsedTimeMillis();
 
@@ -71,6 +75,8 @@ void ArduinoSerial::newObject(){
 
     this->setCustomVar(static_cast<float>(serialDeviceID),"DEVICE_ID");
     this->setCustomVar(static_cast<float>(baudRateID),"BAUDRATE_ID");
+    this->setCustomVar(static_cast<float>(framingID),"FRAMING_ID");
+    this->setCustomVar(static_cast<float>(protocolID),"PROTOCOL_ID");
 }
 
 //--------------------------------------------------------------
@@ -82,7 +88,7 @@ void ArduinoSerial::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     ofLog(OF_LOG_NOTICE,"------------------- SERIAL DEVICES");
 
 
-    deviceList = serial.getDeviceList();
+    deviceList = serialEnumerator.getDeviceList();
     for(int i=0;i<deviceList.size();i++){
         ofLog(OF_LOG_NOTICE,"[%i] - %s",i,deviceList.at(i).getDeviceName().c_str());
         deviceNameList.push_back(deviceList.at(i).getDeviceName());
@@ -99,45 +105,31 @@ void ArduinoSerial::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 //--------------------------------------------------------------
 void ArduinoSerial::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
 
-    if(deviceNameList.size() > 0){
-        if(ofGetElapsedTimeMillis()-resetTime > 40){
+    if(serial.isConnected()){
+        // SENDING DATA (the serial thread always writes the latest queued vector)
+        if(this->inletsConnected[0] && ofGetElapsedTimeMillis()-resetTime > 40){
             resetTime = ofGetElapsedTimeMillis();
 
-            // SENDING DATA
-            if(this->inletsConnected[0]){
-                temp = "";
-                if(static_cast<int>(static_cast<vector<float> *>(_inletParams[0])->size()) <= MAX_ARDUINO_SENDING_VECTOR_LENGTH){
-                    temp += ofToString(static_cast<int>(static_cast<vector<float> *>(_inletParams[0])->size()));
-                    temp += ",";
-                    for(size_t s=0;s<static_cast<size_t>(static_cast<vector<float> *>(_inletParams[0])->size());s++){
-                        temp += ofToString(ofClamp(static_cast<int>(static_cast<vector<float> *>(_inletParams[0])->at(s)),0,127));
-                        if(s<static_cast<size_t>(static_cast<vector<float> *>(_inletParams[0])->size())-1){
-                            temp += ",";
-                        }
-                    }
-                    serial.writeBytes((unsigned char*)temp.c_str(),temp.length());
-                    serial.writeByte('\n');
+            vector<float> *data = static_cast<vector<float> *>(_inletParams[0]);
+            if(protocolID == SERIAL_PROTOCOL_BINARY){
+                if(data->size()*sizeof(float) <= SERIAL_MAX_FRAME_SIZE){
+                    serial.send(*data);
                 }else{
-                    ofLog(OF_LOG_ERROR,"Arduino Serial --> The data vector MAX SIZE for sending data to Arduino is %i, your data vector is too big, so just reduce it to MAX %i!",MAX_ARDUINO_SENDING_VECTOR_LENGTH,MAX_ARDUINO_SENDING_VECTOR_LENGTH);
+                    ofLog(OF_LOG_ERROR,"Arduino Serial --> The data vector MAX SIZE for sending binary data to Arduino is %i, your data vector is too big!",static_cast<int>(SERIAL_MAX_FRAME_SIZE/sizeof(float)));
                 }
-            }
-
-
-            // RECEIVING DATA
-            if(serial.available() > 0){
-                memset(bytesReturned, 0, MAX_ARDUINO_RECEIVING_VECTOR_LENGTH);
-                memset(bytesReadString, 0, MAX_ARDUINO_RECEIVING_VECTOR_LENGTH+1);
-
-                if(serial.readBytes(bytesReturned, MAX_ARDUINO_RECEIVING_VECTOR_LENGTH) > 0){
-                    memcpy(bytesReadString, bytesReturned, MAX_ARDUINO_RECEIVING_VECTOR_LENGTH);
-
-                    for(int i=0;i<MAX_ARDUINO_RECEIVING_VECTOR_LENGTH;i++){
-                        static_cast<vector<float> *>(_outletParams[0])->at(i) = static_cast<int>(bytesReadString[i]);
-                    }
+            }else if(static_cast<int>(data->size()) <= MAX_ARDUINO_SENDING_VECTOR_LENGTH){
+                sendBuffer.resize(data->size());
+                for(size_t s=0;s<data->size();s++){
+                    sendBuffer[s] = ofClamp(static_cast<int>(data->at(s)),0,127);
                 }
+                serial.send(sendBuffer);
+            }else{
+                ofLog(OF_LOG_ERROR,"Arduino Serial --> The data vector MAX SIZE for sending data to Arduino is %i, your data vector is too big, so just reduce it to MAX %i!",MAX_ARDUINO_SENDING_VECTOR_LENGTH,MAX_ARDUINO_SENDING_VECTOR_LENGTH);
             }
-
         }
+
+        // RECEIVING DATA (last complete frame)
+        serial.receive(*static_cast<vector<float> *>(_outletParams[0]));
     }
 
     if(!loaded){
@@ -155,9 +147,22 @@ void ArduinoSerial::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
             baudRateID = 0;
             this->setCustomVar(static_cast<float>(baudRateID),"BAUDRATE_ID");
         }
+        if(this->existsCustomVar("FRAMING_ID")){
+            framingID = ofClamp(static_cast<int>(floor(this->getCustomVar("FRAMING_ID"))),0,static_cast<int>(framingList.size())-1);
+        }else{
+            this->setCustomVar(static_cast<float>(framingID),"FRAMING_ID");
+        }
+        if(this->existsCustomVar("PROTOCOL_ID")){
+            protocolID = ofClamp(static_cast<int>(floor(this->getCustomVar("PROTOCOL_ID"))),0,static_cast<int>(protocolList.size())-1);
+        }else{
+            this->setCustomVar(static_cast<float>(protocolID),"PROTOCOL_ID");
+        }
+
+        serial.setFraming(static_cast<SERIAL_FRAMING>(framingID));
+        serial.setProtocol(static_cast<SERIAL_PROTOCOL>(protocolID));
 
         if(deviceNameList.size() > 0){
-            serial.setup(serialDeviceID, ofToInt(baudrateList.at(baudRateID)));
+            serial.setup(deviceList.at(serialDeviceID).getDevicePath(), ofToInt(baudrateList.at(baudRateID)));
 
         }else{
             ofLog(OF_LOG_WARNING,"You have no SERIAL devices available, please enable one in order to use the arduino serial object!");
@@ -240,16 +245,47 @@ void ArduinoSerial::drawObjectNodeConfig(){
         ImGui::EndCombo();
     }
 
+    ImGui::Spacing();
+    if(ImGui::BeginCombo("Framing", framingList.at(framingID).c_str() )){
+        for(int i=0; i < framingList.size(); ++i){
+            bool is_selected = (framingID == i );
+            if (ImGui::Selectable(framingList.at(i).c_str(), is_selected)){
+                resetFramingSettings(i,protocolID);
+            }
+            if (is_selected) ImGui::SetItemDefaultFocus();
+        }
+        ImGui::EndCombo();
+    }
+
+    ImGui::Spacing();
+    if(ImGui::BeginCombo("Protocol", protocolList.at(protocolID).c_str() )){
+        for(int i=0; i < protocolList.size(); ++i){
+            bool is_selected = (protocolID == i );
+            if (ImGui::Selectable(protocolList.at(i).c_str(), is_selected)){
+                resetFramingSettings(framingID,i);
+            }
+            if (is_selected) ImGui::SetItemDefaultFocus();
+        }
+        ImGui::EndCombo();
+    }
+
+    if(serial.isConnected()){
+        SerialStats stats = serial.getStats();
+        ImGui::Spacing();
+        ImGui::Text("IN:  %.0f B/s  (%llu frames)", stats.bytesInPerSec, static_cast<unsigned long long>(stats.framesIn));
+        ImGui::Text("OUT: %.0f B/s  (%llu frames, %llu failed)", stats.bytesOutPerSec, static_cast<unsigned long long>(stats.framesOut), static_cast<unsigned long long>(stats.framesOutFailed));
+        ImGui::Text("Latency: %.2f ms", stats.latencyMs);
+        ImGui::Text("Dropped frames: %llu", static_cast<unsigned long long>(stats.framesDropped));
+    }
+
     ImGuiEx::ObjectInfo(
-                "This object communicates with Arduino for both sending and receiving data. This template MosaicConnector.ino must be used as Arduino template file",
+                "This object communicates with Arduino for both sending and receiving data. This template MosaicConnector.ino must be used as Arduino template file, with the Raw framing. The Line, COBS and SLIP framings need a sketch sending framed text or float32 values.",
                 "https://mosaic.d3cod3.org/reference.php?r=arduino-serial", scaleFactor);
 }
 
 //--------------------------------------------------------------
 void ArduinoSerial::removeObjectContent(bool removeFileFromData){
-    if(serial.isInitialized() && deviceNameList.size() > 0){
-        serial.close();
-    }
+    serial.close();
 }
 
 //--------------------------------------------------------------
@@ -265,19 +301,28 @@ void ArduinoSerial::resetSERIALSettings(int devID, int br){
         baudRateID = ofClamp(br,0,7);
         this->setCustomVar(static_cast<float>(baudRateID),"BAUDRATE_ID");
 
-        if(serial.isInitialized()){
-            serial.close();
-        }
-
-        serial.setup(serialDeviceID,ofToInt(baudrateList.at(baudRateID)));
-
-        if(serial.isInitialized() && serial.available()){
+        if(serial.setup(deviceList.at(serialDeviceID).getDevicePath(),ofToInt(baudrateList.at(baudRateID)))){
             ofLog(OF_LOG_NOTICE,"SERIAL device %s connected!", deviceNameList.at(devID).c_str());
             this->saveConfig(false);
         }
     }
 }
 
+//--------------------------------------------------------------
+void ArduinoSerial::resetFramingSettings(int fr, int pr){
+
+    if(fr != framingID || pr != protocolID){
+        framingID = ofClamp(fr,0,static_cast<int>(framingList.size())-1);
+        this->setCustomVar(static_cast<float>(framingID),"FRAMING_ID");
+
+        protocolID = ofClamp(pr,0,static_cast<int>(protocolList.size())-1);
+        this->setCustomVar(static_cast<float>(protocolID),"PROTOCOL_ID");
+
+        serial.setFraming(static_cast<SERIAL_FRAMING>(framingID));
+        serial.setProtocol(static_cast<SERIAL_PROTOCOL>(protocolID));
+    }
+}
+
 OBJECT_REGISTER( ArduinoSerial, "arduino serial", OFXVP_OBJECT_CAT_COMMUNICATIONS)
 
 #endif
@@ -36,8 +36,10 @@
 
 #include "PatchObject.h"
 
+#include "ThreadedSerial.h"
+
 #define MAX_ARDUINO_SENDING_VECTOR_LENGTH 24
-#define MAX_ARDUINO_RECEIVING_VECTOR_LENGTH 64
+#define MAX_ARDUINO_RECEIVING_VECTOR_LENGTH SERIAL_RAW_FRAME_SIZE
 
 class ArduinoSerial : public PatchObject {
 
@@ -56,20 +58,23 @@ public:
     void            removeObjectContent(bool removeFileFromData=false) override;
 
     void            resetSERIALSettings(int devID,int br);
+    void            resetFramingSettings(int fr,int pr);
 
 
-    ofSerial                    serial;
+    ThreadedSerial              serial;
+    ofSerial                    serialEnumerator;
     vector <ofSerialDeviceInfo> deviceList;
     vector<string>              deviceNameList;
     vector<string>              baudrateList;
+    vector<string>              framingList;
+    vector<string>              protocolList;
     int                         serialDeviceID;
     int                         baudRateID;
+    int                         framingID;
+    int                         protocolID;
 
     size_t                      resetTime;
-    string                      temp;
-
-    unsigned char               bytesReturned[MAX_ARDUINO_RECEIVING_VECTOR_LENGTH];
-    char                        bytesReadString[MAX_ARDUINO_RECEIVING_VECTOR_LENGTH+1];
+    vector<float>               sendBuffer;
 
     ofImage                     *arduinoIcon;
     float                       posX, posY, drawW, drawH;
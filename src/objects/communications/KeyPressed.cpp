@@ -40,8 +40,7 @@ KeyPressed::KeyPressed() : PatchObject("key pressed"){
     this->numInlets  = 0;
     this->numOutlets = 1;
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
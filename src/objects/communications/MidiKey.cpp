@@ -40,17 +40,12 @@ MidiKey::MidiKey() : PatchObject("midi key"){
     this->numInlets  = 2;
     this->numOutlets = 3;
 
-    _inletParams[0] = new float();  // pitch (index)
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // velocity
-    *(float *)&_inletParams[1] = 0.0f;
-
-    _outletParams[0] = new float(); // bang
-    *(float *)&_outletParams[0] = 0.0f;
-    _outletParams[1] = new float(); // pitch
-    *(float *)&_outletParams[1] = 0.0f;
-    _outletParams[2] = new float(); // velocity
-    *(float *)&_outletParams[2] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // pitch (index)
+    *(float *)&_inletParams[1] = 0.0f;  // velocity
+
+    *(float *)&_outletParams[0] = 0.0f; // bang
+    *(float *)&_outletParams[1] = 0.0f; // pitch
+    *(float *)&_outletParams[2] = 0.0f; // velocity
 
     this->initInletsState();
 
@@ -40,13 +40,10 @@ MidiKnob::MidiKnob() : PatchObject("midi knob"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // control
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // value
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // control
+    *(float *)&_inletParams[1] = 0.0f;  // value
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
@@ -40,19 +40,13 @@ MidiPad::MidiPad() : PatchObject("midi pad"){
     this->numInlets  = 3;
     this->numOutlets = 3;
 
-    _inletParams[0] = new float();  // pitch (index)
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // value
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // velocity
-    *(float *)&_inletParams[2] = 0.0f;
-
-    _outletParams[0] = new float(); // bang
-    *(float *)&_outletParams[0] = 0.0f;
-    _outletParams[1] = new float(); // value
-    *(float *)&_outletParams[1] = 0.0f;
-    _outletParams[2] = new float(); // velocity
-    *(float *)&_outletParams[2] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // pitch (index)
+    *(float *)&_inletParams[1] = 0.0f;  // value
+    *(float *)&_inletParams[2] = 0.0f;  // velocity
+
+    *(float *)&_outletParams[0] = 0.0f; // bang
+    *(float *)&_outletParams[1] = 0.0f; // value
+    *(float *)&_outletParams[2] = 0.0f; // velocity
 
     this->initInletsState();
 
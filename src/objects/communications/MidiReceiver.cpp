@@ -40,16 +40,11 @@ MidiReceiver::MidiReceiver() : PatchObject("midi receiver"){
     this->numInlets  = 0;
     this->numOutlets = 5;
 
-    _outletParams[0] = new float();         // channel
-    *(float *)&_outletParams[0] = 0.0f;
-    _outletParams[1] = new float();         // control
-    *(float *)&_outletParams[1] = 0.0f;
-    _outletParams[2] = new float();         // value
-    *(float *)&_outletParams[2] = 0.0f;
-    _outletParams[3] = new float();         // pitch
-    *(float *)&_outletParams[3] = 0.0f;
-    _outletParams[4] = new float();         // velocity
-    *(float *)&_outletParams[4] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f;         // channel
+    *(float *)&_outletParams[1] = 0.0f;         // control
+    *(float *)&_outletParams[2] = 0.0f;         // value
+    *(float *)&_outletParams[3] = 0.0f;         // pitch
+    *(float *)&_outletParams[4] = 0.0f;         // velocity
 
     this->initInletsState();
 
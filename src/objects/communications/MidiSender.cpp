@@ -40,14 +40,10 @@ MidiSender::MidiSender() : PatchObject("midi sender"){
     this->numInlets  = 4;
     this->numOutlets = 0;
 
-    _inletParams[0] = new float();         // trigger
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();         // channel
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();         // note
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();         // velocity
-    *(float *)&_inletParams[3] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;         // trigger
+    *(float *)&_inletParams[1] = 0.0f;         // channel
+    *(float *)&_inletParams[2] = 0.0f;         // note
+    *(float *)&_inletParams[3] = 0.0f;         // velocity
 
     this->initInletsState();
 
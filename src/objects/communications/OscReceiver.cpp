@@ -42,6 +42,9 @@ OscReceiver::OscReceiver() : PatchObject("osc receiver"){
 
     this->initInletsState();
 
+    // texture outlets change only with a received image
+    this->setTracksOutletChanges(true);
+
     osc_port            = 12345;
     osc_port_string     = ofToString(osc_port);
     local_ip            = "0.0.0.0";
@@ -109,6 +112,7 @@ void OscReceiver::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObj
                                 static_cast<ofTexture *>(_outletParams[i])->allocate(m.getArgAsInt32(0),m.getArgAsInt32(1),GL_RGBA);
                                 static_cast<ofTexture *>(_outletParams[i])->loadData(_tempImage->getPixels(),GL_RGB);
                             }
+                            this->markOutletChanged(i);
                         }
                     }
                     break;
@@ -192,7 +196,6 @@ void OscReceiver::drawObjectNodeConfig(){
     ImGui::Spacing();
 
     if(ImGui::Button("ADD OSC NUMBER",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _outletParams[this->numOutlets] = new float();
         *(float *)&_outletParams[this->numOutlets] = 0.0f;
         this->addOutlet(VP_LINK_NUMERIC,"number");
 
@@ -205,7 +208,7 @@ void OscReceiver::drawObjectNodeConfig(){
     }
     ImGui::Spacing();
     if(ImGui::Button("ADD OSC TEXT",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _outletParams[this->numOutlets] = new string();  // control
+        this->newOutletBuffer<string>(this->numOutlets);  // control
         *static_cast<string *>(_outletParams[this->numOutlets]) = "";
         this->addOutlet(VP_LINK_STRING,"text");
 
@@ -218,7 +221,7 @@ void OscReceiver::drawObjectNodeConfig(){
     }
     ImGui::Spacing();
     if(ImGui::Button("ADD OSC VECTOR",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _outletParams[this->numOutlets] = new vector<float>();
+        this->newOutletBuffer<vector<float>>(this->numOutlets);
         this->addOutlet(VP_LINK_ARRAY,"vector");
 
         osc_labels.push_back("/vectorlabel");
@@ -230,7 +233,7 @@ void OscReceiver::drawObjectNodeConfig(){
     }
     ImGui::Spacing();
     if(ImGui::Button("ADD OSC TEXTURE",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _outletParams[this->numOutlets] = new ofTexture();
+        this->newOutletBuffer<ofTexture>(this->numOutlets);
         this->addOutlet(VP_LINK_TEXTURE,"texture");
 
         osc_labels.push_back("/texturelabel");
@@ -318,24 +321,23 @@ void OscReceiver::initOutlets(){
                             if(XML.pushTag("var",t)){
                                 if(XML.getValue("name","") != "PORT"){
                                     if(tempTypes.at(tempCounter) == 0){
-                                        _outletParams[tempCounter] = new float();
                                         *(float *)&_outletParams[tempCounter] = 0.0f;
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_NUMERIC);
                                         tempCounter++;
                                     }else if(tempTypes.at(tempCounter) == 1){
-                                        _outletParams[tempCounter] = new string();
+                                        this->newOutletBuffer<string>(tempCounter);
                                         *static_cast<string *>(_outletParams[tempCounter]) = "";
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_STRING);
                                         tempCounter++;
                                     }else if(tempTypes.at(tempCounter) == 2){
-                                        _outletParams[tempCounter] = new vector<float>();
+                                        this->newOutletBuffer<vector<float>>(tempCounter);
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_ARRAY);
                                         tempCounter++;
                                     }else if(tempTypes.at(tempCounter) == 3){
-                                        _outletParams[tempCounter] = new ofTexture();
+                                        this->newOutletBuffer<ofTexture>(tempCounter);
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_TEXTURE);
                                         tempCounter++;
@@ -207,7 +207,6 @@ void OscSender::drawObjectNodeConfig(){
     ImGui::Spacing();
 
     if(ImGui::Button("ADD OSC NUMBER",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _inletParams[this->numInlets] = new float();
         *(float *)&_inletParams[this->numInlets] = 0.0f;
         this->addInlet(VP_LINK_NUMERIC,"number");
         this->inletsConnected.push_back(false);
@@ -221,7 +220,7 @@ void OscSender::drawObjectNodeConfig(){
     }
     ImGui::Spacing();
     if(ImGui::Button("ADD OSC TEXT",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _inletParams[this->numInlets] = new string();  // control
+        this->newInletBuffer<string>(this->numInlets);  // control
         *static_cast<string *>(_inletParams[this->numInlets]) = "";
         this->addInlet(VP_LINK_STRING,"text");
         this->inletsConnected.push_back(false);
@@ -235,7 +234,7 @@ void OscSender::drawObjectNodeConfig(){
     }
     ImGui::Spacing();
     if(ImGui::Button("ADD OSC VECTOR",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _inletParams[this->numInlets] = new vector<float>();
+        this->newInletBuffer<vector<float>>(this->numInlets);
         this->addInlet(VP_LINK_ARRAY,"vector");
         this->inletsConnected.push_back(false);
 
@@ -248,7 +247,7 @@ void OscSender::drawObjectNodeConfig(){
     }
     ImGui::Spacing();
     if(ImGui::Button("ADD OSC TEXTURE",ImVec2(224*scaleFactor,26*scaleFactor))){
-        _inletParams[this->numInlets] = new ofTexture();
+        this->newInletBuffer<ofTexture>(this->numInlets);
         this->addInlet(VP_LINK_TEXTURE,"texture");
         this->inletsConnected.push_back(false);
 
@@ -342,24 +341,23 @@ void OscSender::initInlets(){
                                 }
                                 if(XML.getValue("name","") != "PORT" && !isreceiverIP){
                                     if(tempTypes.at(tempCounter) == 0){ // float
-                                        _inletParams[tempCounter] = new float();
                                         *(float *)&_inletParams[tempCounter] = 0.0f;
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_NUMERIC);
                                         tempCounter++;
                                     }else if(tempTypes.at(tempCounter) == 1){ // string
-                                        _inletParams[tempCounter] = new string();  // control
+                                        this->newInletBuffer<string>(tempCounter);  // control
                                         *static_cast<string *>(_inletParams[tempCounter]) = "";
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_STRING);
                                         tempCounter++;
                                     }else if(tempTypes.at(tempCounter) == 2){ // vector<float>
-                                        _inletParams[tempCounter] = new vector<float>();
+                                        this->newInletBuffer<vector<float>>(tempCounter);
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_ARRAY);
                                         tempCounter++;
                                     }else if(tempTypes.at(tempCounter) == 3){ // ofTexture
-                                        _inletParams[tempCounter] = new ofTexture();
+                                        this->newInletBuffer<ofTexture>(tempCounter);
                                         osc_labels.push_back(XML.getValue("name",""));
                                         osc_labels_type.push_back(VP_LINK_TEXTURE);
                                         tempCounter++;
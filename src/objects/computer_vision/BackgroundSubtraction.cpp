@@ -43,14 +43,16 @@ BackgroundSubtraction::BackgroundSubtraction() : PatchObject("background subtrac
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
-    _inletParams[1] = new float();  // bang
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofTexture>(0);  // input
+    *(float *)&_inletParams[1] = 0.0f;  // bang
 
-    _outletParams[0] = new ofTexture(); // output
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
+    // the learned background changes the output on every processed frame
+    this->setTracksOutletChanges(true);
+
     resetTextures(320,240);
 
     bgSubTech           = 0; // 0 abs, 1 lighter than, 2 darker than
@@ -176,6 +178,7 @@ void BackgroundSubtraction::drawObjectContent(ofTrueTypeFont *font, shared_ptr<o
         finalBackground->updateTexture();
 
         *static_cast<ofTexture *>(_outletParams[0]) = finalBackground->getTexture();
+        this->markOutletChanged(0);
 
     }else if(!this->inletsConnected[0]){
         newConnection = false;
@@ -43,12 +43,15 @@ ChromaKey::ChromaKey() : PatchObject("chroma key"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
-    _inletParams[1] = new ofTexture();  // mask
-    _outletParams[0] = new ofTexture(); // output
+    this->newInletBuffer<ofTexture>(0);  // input
+    this->newInletBuffer<ofTexture>(1);  // mask
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
+    // the output changes only with the input textures and the key settings
+    this->setTracksOutletChanges(true);
+
     posX = posY = drawW = drawH = 0.0f;
 
     isInputConnected    = false;
@@ -126,6 +129,9 @@ void ChromaKey::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRende
         }else{
             *static_cast<ofTexture *>(_outletParams[0]) = *static_cast<ofTexture *>(_inletParams[0]);
         }
+        if(this->inputsChanged()){
+            this->markOutletChanged(0);
+        }
     }else{
         isInputConnected = false;
     }
@@ -43,14 +43,17 @@ ColorTracking::ColorTracking() : PatchObject("color tracking"){
     this->numInlets  = 1;
     this->numOutlets = 4;
 
-    _inletParams[0] = new ofTexture();  // input texture
-    _outletParams[0] = new ofTexture(); // output texture (for visualization)
-    _outletParams[1] = new vector<float>();  // blobs vector
-    _outletParams[2] = new vector<float>();  // contour vector
-    _outletParams[3] = new vector<float>();  // convex hull vector
+    this->newInletBuffer<ofTexture>(0);  // input texture
+    this->newOutletBuffer<ofTexture>(0); // output texture (for visualization)
+    this->newOutletBuffer<vector<float>>(1);  // blobs vector
+    this->newOutletBuffer<vector<float>>(2);  // contour vector
+    this->newOutletBuffer<vector<float>>(3);  // convex hull vector
 
     this->initInletsState();
 
+    // the tracking state changes the output on every drawn frame
+    this->setTracksOutletChanges(true);
+
     contourFinder   = new ofxCv::ContourFinder();
     pix             = new ofPixels();
     outputFBO       = new ofFbo();
@@ -262,6 +265,7 @@ void ColorTracking::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLR
             }
 
             outputFBO->end();
+            this->markOutletChanged(0);
 
         }
 
@@ -43,17 +43,20 @@ ContourTracking::ContourTracking() : PatchObject("contour tracking"){
     this->numInlets  = 1;
     this->numOutlets = 4;
 
-    _inletParams[0] = new ofTexture();  // input texture
-    _outletParams[0] = new ofTexture(); // output texture (for visualization)
-    _outletParams[1] = new vector<float>();  // blobs vector
-    _outletParams[2] = new vector<float>();  // contour vector
-    _outletParams[3] = new vector<float>();  // convex hull vector
+    this->newInletBuffer<ofTexture>(0);  // input texture
+    this->newOutletBuffer<ofTexture>(0); // output texture (for visualization)
+    this->newOutletBuffer<vector<float>>(1);  // blobs vector
+    this->newOutletBuffer<vector<float>>(2);  // contour vector
+    this->newOutletBuffer<vector<float>>(3);  // convex hull vector
 
     this->initInletsState();
 
+    // the tracking state changes the output on every drawn frame
+    this->setTracksOutletChanges(true);
+
     contourFinder   = new ofxCv::ContourFinder();
     pix             = new ofPixels();
-    outputFBO       = new ofFbo();
+    outputFBO       = nullptr;
 
     posX = posY = drawW = drawH = 0.0f;
 
@@ -134,7 +137,8 @@ void ContourTracking::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseG
         if(!isFBOAllocated){
             isFBOAllocated = true;
             pix             = new ofPixels();
-            outputFBO->allocate(static_cast<ofTexture *>(_inletParams[0])->getWidth(),static_cast<ofTexture *>(_inletParams[0])->getHeight(),GL_RGB,1);
+            ofxVPFboPool::get().release(outputFBO);
+            outputFBO = ofxVPFboPool::get().acquire(static_cast<ofTexture *>(_inletParams[0])->getWidth(),static_cast<ofTexture *>(_inletParams[0])->getHeight(),GL_RGB,1,this->getId());
         }
 
         static_cast<ofTexture *>(_inletParams[0])->readToPixels(*pix);
@@ -143,7 +147,7 @@ void ContourTracking::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseG
         contourFinder->findContours(*pix);
 
 
-        if(outputFBO->isAllocated()){
+        if(outputFBO != nullptr){
 
             *static_cast<ofTexture *>(_outletParams[0]) = outputFBO->getTexture();
 
@@ -269,6 +273,7 @@ void ContourTracking::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseG
             }
 
             outputFBO->end();
+            this->markOutletChanged(0);
         }
 
 
@@ -356,7 +361,8 @@ void ContourTracking::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void ContourTracking::removeObjectContent(bool removeFileFromData){
-    
+    ofxVPFboPool::get().release(outputFBO);
+    outputFBO = nullptr;
 }
 
 
@@ -43,12 +43,15 @@ HaarTracking::HaarTracking() : PatchObject("haar tracking"){
     this->numInlets  = 1;
     this->numOutlets = 2;
 
-    _inletParams[0] = new ofTexture();  // input texture
-    _outletParams[0] = new ofTexture(); // output texture (for visualization)
-    _outletParams[1] = new vector<float>();  // haar blobs vector
+    this->newInletBuffer<ofTexture>(0);  // input texture
+    this->newOutletBuffer<ofTexture>(0); // output texture (for visualization)
+    this->newOutletBuffer<vector<float>>(1);  // haar blobs vector
 
     this->initInletsState();
 
+    // the tracking state changes the output on every drawn frame
+    this->setTracksOutletChanges(true);
+
     haarFinder      = new ofxCv::ObjectFinder();
     pix             = new ofPixels();
     outputFBO       = new ofFbo();
@@ -183,6 +186,7 @@ void HaarTracking::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRe
         }
 
         outputFBO->end();
+        this->markOutletChanged(0);
 
     }
 
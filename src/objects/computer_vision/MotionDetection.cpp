@@ -43,10 +43,9 @@ MotionDetection::MotionDetection() : PatchObject("motion detection"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
+    this->newInletBuffer<ofTexture>(0);  // input
 
-    _outletParams[0] = new float(); // MOTION QUANTITY
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // MOTION QUANTITY
 
     this->initInletsState();
 
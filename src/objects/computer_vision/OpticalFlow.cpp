@@ -43,13 +43,16 @@ OpticalFlow::OpticalFlow() : PatchObject("optical flow"){
     this->numInlets  = 1;
     this->numOutlets = 2;
 
-    _inletParams[0] = new ofTexture();  // input
+    this->newInletBuffer<ofTexture>(0);  // input
 
-    _outletParams[0] = new ofTexture(); // output texture
-    _outletParams[1] = new vector<float>(); // optical flow data
+    this->newOutletBuffer<ofTexture>(0); // output texture
+    this->newOutletBuffer<vector<float>>(1); // optical flow data
 
     this->initInletsState();
 
+    // the tracking state changes the output on every drawn frame
+    this->setTracksOutletChanges(true);
+
     posX = posY = drawW = drawH = 0.0f;
 
     pix                 = new ofPixels();
@@ -177,6 +180,7 @@ void OpticalFlow::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRen
         fb.draw(0,0,static_cast<ofTexture *>(_outletParams[0])->getWidth(),static_cast<ofTexture *>(_outletParams[0])->getHeight());
 
         outputFBO->end();
+        this->markOutletChanged(0);
     }
 
     ofSetColor(255);
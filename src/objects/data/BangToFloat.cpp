@@ -40,14 +40,11 @@ BangToFloat::BangToFloat() : PatchObject("bang to float"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new float();  // number
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // number
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
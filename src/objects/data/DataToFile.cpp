@@ -42,10 +42,9 @@ DataToFile::DataToFile() :
     this->numInlets  = 2;
     this->numOutlets = 0;
 
-    _inletParams[0] = new vector<float>(); // input
+    this->newInletBuffer<vector<float>>(0); // input
 
-    _inletParams[1] = new float();  // bang
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // bang
 
     this->initInletsState();
 
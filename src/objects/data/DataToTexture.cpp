@@ -34,23 +34,64 @@
 
 #include "DataToTexture.h"
 
+// GLSL 120, same grid mapping as the CPU path: every output pixel belongs to a grid cell,
+// the cell raster index is mapped onto the uploaded data and the value converted from -0.5..0.5
+static const string dataToTextureVert = R"(
+#version 120
+
+varying vec2 pos;
+
+void main(){
+    pos = gl_Vertex.xy;
+    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+}
+)";
+
+static const string dataToTextureFrag = R"(
+#version 120
+
+uniform sampler2D data;
+uniform vec2 dataSize;
+uniform vec2 grid;
+uniform vec2 outSize;
+uniform float ratio;
+uniform vec3 mask;
+
+varying vec2 pos;
+
+void main(){
+    vec2 cell = min(floor(pos / outSize * grid), grid - 1.0);
+    float idx = floor((cell.y * grid.x + cell.x) * ratio);
+    vec2 tc = vec2(mod(idx, dataSize.x) + 0.5, floor(idx / dataSize.x) + 0.5) / dataSize;
+    vec3 v = texture2D(data, tc).rgb;
+    gl_FragColor = vec4(clamp(v + 0.5, 0.0, 1.0) * mask, 1.0);
+}
+)";
+
 //--------------------------------------------------------------
 DataToTexture::DataToTexture() : PatchObject("data to texture"){
 
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();  // red
-    _inletParams[1] = new vector<float>();  // green
-    _inletParams[2] = new vector<float>();  // blu
+    this->newInletBuffer<vector<float>>(0);  // red
+    this->newInletBuffer<vector<float>>(1);  // green
+    this->newInletBuffer<vector<float>>(2);  // blu
 
-    _outletParams[0] = new ofTexture(); // texture output
+    this->newOutletBuffer<ofTexture>(0); // texture output
 
     this->initInletsState();
 
+    // the output changes only with the input data and the settings
+    this->setTracksOutletChanges(true);
+
     pix                 = new ofPixels();
     scaledPix           = new ofPixels();
 
+    gpuShader           = new ofShader();
+    gpuFbo              = new ofFbo();
+    dataTex             = new ofTexture();
+
     this->output_width  = STANDARD_TEXTURE_WIDTH;
     this->output_height = STANDARD_TEXTURE_HEIGHT;
 
@@ -59,6 +100,8 @@ DataToTexture::DataToTexture() : PatchObject("data to texture"){
 
     loaded              = false;
     needReset           = false;
+    useGPU              = false;
+    gpuAvailable        = false;
 
     this->setIsTextureObj(true);
 
@@ -76,12 +119,19 @@ void DataToTexture::newObject(){
 
     this->setCustomVar(static_cast<float>(this->output_width),"OUTPUT_WIDTH");
     this->setCustomVar(static_cast<float>(this->output_height),"OUTPUT_HEIGHT");
+    this->setCustomVar(0.0f,"GPU_MODE");
 }
 
 //--------------------------------------------------------------
 void DataToTexture::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
-    pix->allocate(320,240,OF_PIXELS_RGB);
+    pix->allocate(DATA_TO_TEXTURE_GRID_WIDTH,DATA_TO_TEXTURE_GRID_HEIGHT,OF_PIXELS_RGB);
+    for(int c=0;c<3;c++){
+        channelData[c].assign(DATA_TO_TEXTURE_GRID_WIDTH*DATA_TO_TEXTURE_GRID_HEIGHT,0.0f);
+        channelBytes[c].assign(DATA_TO_TEXTURE_GRID_WIDTH*DATA_TO_TEXTURE_GRID_HEIGHT,0);
+    }
+
+    setupGPU();
 }
 
 //--------------------------------------------------------------
@@ -90,41 +140,19 @@ void DataToTexture::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
     if(needReset){
         needReset = false;
         resetResolution();
+        this->markOutletChanged(0);
     }
 
     if(static_cast<ofTexture *>(_outletParams[0])->isAllocated()){
         if(this->inletsConnected[0] || this->inletsConnected[1] || this->inletsConnected[2]){
-            for(int s=0;s<pix->size();s++){
-                int posR = 0;
-                int sampleR = 0;
-                int posG = 0;
-                int sampleG = 0;
-                int posB = 0;
-                int sampleB = 0;
-                // RED
-                if(this->inletsConnected[0] && static_cast<int>(static_cast<vector<float> *>(_inletParams[0])->size()) > 0){
-                    posR = static_cast<int>(floor(ofMap(s,0,pix->size(),0,static_cast<int>(static_cast<vector<float> *>(_inletParams[0])->size()))));
-                    sampleR = static_cast<int>(floor(ofMap(static_cast<vector<float> *>(_inletParams[0])->at(posR), -0.5f, 0.5f, 0, 255)));
-                }
-                // GREEN
-                if(this->inletsConnected[1] && static_cast<int>(static_cast<vector<float> *>(_inletParams[1])->size()) > 0){
-                    posG = static_cast<int>(floor(ofMap(s,0,pix->size(),0,static_cast<int>(static_cast<vector<float> *>(_inletParams[1])->size()))));
-                    sampleG = static_cast<int>(floor(ofMap(static_cast<vector<float> *>(_inletParams[1])->at(posG), -0.5f, 0.5f, 0, 255)));
-                }
-                // BLUE
-                if(this->inletsConnected[2] && static_cast<int>(static_cast<vector<float> *>(_inletParams[2])->size()) > 0){
-                    posB = static_cast<int>(floor(ofMap(s,0,pix->size(),0,static_cast<int>(static_cast<vector<float> *>(_inletParams[2])->size()))));
-                    sampleB = static_cast<int>(floor(ofMap(static_cast<vector<float> *>(_inletParams[2])->at(posB), -0.5f, 0.5f, 0, 255)));
-                }
-                ofColor c(sampleR,sampleG,sampleB);
-                int x = s % pix->getWidth();
-                int y = static_cast<int>(ceil(s / pix->getWidth()));
-                if(x >= 0 && x <= pix->getWidth() && y >= 0 && y <= pix->getHeight()){
-                    pix->setColor(x,y,c);
-                }
+            if(useGPU && gpuAvailable){
+                updateGPU();
+            }else{
+                updateCPU();
+            }
+            if(this->inputsChanged()){
+                this->markOutletChanged(0);
             }
-            pix->resizeTo(*scaledPix);
-            static_cast<ofTexture *>(_outletParams[0])->loadData(*scaledPix);
         }
     }
 
@@ -135,10 +163,14 @@ void DataToTexture::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
         temp_width      = this->output_width;
         temp_height     = this->output_height;
 
+        if(this->existsCustomVar("GPU_MODE")){
+            useGPU = static_cast<int>(floor(this->getCustomVar("GPU_MODE"))) == 1;
+        }
+
         scaledPix->allocate(this->output_width,this->output_height,OF_PIXELS_RGB);
 
-        _outletParams[0] = new ofTexture();
         static_cast<ofTexture *>(_outletParams[0])->allocate(this->output_width,this->output_height,GL_RGB);
+        gpuFbo->allocate(this->output_width,this->output_height,GL_RGB);
     }
 
 }
@@ -217,6 +249,19 @@ void DataToTexture::drawObjectNodeConfig(){
         needReset = true;
     }
 
+    ImGui::Spacing();
+    if(gpuAvailable){
+        if(ImGui::Checkbox("GPU conversion",&useGPU)){
+            this->setCustomVar(static_cast<float>(useGPU),"GPU_MODE");
+            // the outlet texture was shared with the fbo, give the CPU path its own again
+            if(!useGPU){
+                static_cast<ofTexture *>(_outletParams[0])->clear();
+                static_cast<ofTexture *>(_outletParams[0])->allocate(this->output_width,this->output_height,GL_RGB);
+            }
+        }
+        ImGui::SameLine(); ImGuiEx::HelpMarker("Upload the data vectors as a float texture and convert them on the GPU, instead of converting every pixel on the CPU");
+    }
+
     ImGuiEx::ObjectInfo(
                 "This object performs “analog style” video synthesis, with a separate control over RGB channels",
                 "https://mosaic.d3cod3.org/reference.php?r=data-to-texture", scaleFactor);
@@ -234,11 +279,11 @@ void DataToTexture::resetResolution(){
         this->output_width = temp_width;
         this->output_height = temp_height;
 
-        scaledPix = new ofPixels();
         scaledPix->allocate(this->output_width,this->output_height,OF_PIXELS_RGB);
 
-        _outletParams[0] = new ofTexture();
+        static_cast<ofTexture *>(_outletParams[0])->clear();
         static_cast<ofTexture *>(_outletParams[0])->allocate(this->output_width,this->output_height,GL_RGB);
+        gpuFbo->allocate(this->output_width,this->output_height,GL_RGB);
 
 
         if(static_cast<ofTexture *>(_outletParams[0])->isAllocated()){
@@ -252,6 +297,99 @@ void DataToTexture::resetResolution(){
 
 }
 
+//--------------------------------------------------------------
+void DataToTexture::updateCPU(){
+    const size_t gridSize = pix->getWidth()*pix->getHeight();
+
+    // every channel is resampled over the whole grid and converted to bytes in one pass
+    for(int c=0;c<3;c++){
+        vector<float> *data = static_cast<vector<float> *>(_inletParams[c]);
+        if(this->inletsConnected[c] && !data->empty()){
+            ofxVPMath::prepare(channelData[c],gridSize);
+            ofxVPMath::resampleNearest(data->data(),data->size(),channelData[c].data(),gridSize);
+            ofxVPMath::floatsToBytes(channelData[c].data(),-0.5f,0.5f,channelBytes[c].data(),gridSize);
+        }else{
+            std::fill(channelBytes[c].begin(),channelBytes[c].end(),0);
+        }
+    }
+
+    ofxVPMath::interleaveRGB(channelBytes[0].data(),channelBytes[1].data(),channelBytes[2].data(),pix->getData(),gridSize);
+    ofxVPMath::resizeNearest(pix->getData(),pix->getWidth(),pix->getHeight(),scaledPix->getData(),scaledPix->getWidth(),scaledPix->getHeight(),3);
+
+    static_cast<ofTexture *>(_outletParams[0])->loadData(*scaledPix);
+}
+
+//--------------------------------------------------------------
+void DataToTexture::updateGPU(){
+    // all channels share the length of the longest one
+    size_t length = 0;
+    for(int c=0;c<3;c++){
+        if(this->inletsConnected[c]){
+            length = std::max(length,static_cast<vector<float> *>(_inletParams[c])->size());
+        }
+    }
+    if(length == 0){
+        return;
+    }
+
+    const int texW = static_cast<int>(std::min(length,static_cast<size_t>(DATA_TO_TEXTURE_GPU_ROW)));
+    const int texH = static_cast<int>((length + texW - 1) / texW);
+    ofxVPMath::prepare(gpuData,static_cast<size_t>(texW*texH*3));
+
+    float mask[3] = {0.0f,0.0f,0.0f};
+    for(int c=0;c<3;c++){
+        vector<float> *data = static_cast<vector<float> *>(_inletParams[c]);
+        if(this->inletsConnected[c] && !data->empty()){
+            mask[c] = 1.0f;
+            ofxVPMath::prepare(channelData[c],length);
+            ofxVPMath::resampleNearest(data->data(),data->size(),channelData[c].data(),length);
+            for(size_t i=0;i<length;i++){
+                gpuData[i*3+c] = channelData[c][i];
+            }
+        }
+    }
+
+    if(!dataTex->isAllocated() || static_cast<int>(dataTex->getWidth()) != texW || static_cast<int>(dataTex->getHeight()) != texH){
+        dataTex->allocate(texW,texH,GL_RGB32F,false);
+        dataTex->setTextureMinMagFilter(GL_NEAREST,GL_NEAREST);
+    }
+    dataTex->loadData(gpuData.data(),texW,texH,GL_RGB);
+
+    gpuFbo->begin();
+    ofClear(0,0,0,255);
+    ofSetColor(255);
+    gpuShader->begin();
+    gpuShader->setUniformTexture("data",*dataTex,0);
+    gpuShader->setUniform2f("dataSize",static_cast<float>(texW),static_cast<float>(texH));
+    gpuShader->setUniform2f("grid",static_cast<float>(DATA_TO_TEXTURE_GRID_WIDTH),static_cast<float>(DATA_TO_TEXTURE_GRID_HEIGHT));
+    gpuShader->setUniform2f("outSize",static_cast<float>(this->output_width),static_cast<float>(this->output_height));
+    gpuShader->setUniform1f("ratio",static_cast<float>(length)/static_cast<float>(DATA_TO_TEXTURE_GRID_WIDTH*DATA_TO_TEXTURE_GRID_HEIGHT));
+    gpuShader->setUniform3f("mask",mask[0],mask[1],mask[2]);
+    ofDrawRectangle(0,0,this->output_width,this->output_height);
+    gpuShader->end();
+    gpuFbo->end();
+
+    *static_cast<ofTexture *>(_outletParams[0]) = gpuFbo->getTexture();
+}
+
+//--------------------------------------------------------------
+void DataToTexture::setupGPU(){
+    if(ofIsGLProgrammableRenderer()){
+        ofLog(OF_LOG_NOTICE,"%s: GPU conversion available only with the GL 2.1 renderer, using CPU conversion",this->name.c_str());
+        return;
+    }
+
+    gpuShader->setupShaderFromSource(GL_VERTEX_SHADER, dataToTextureVert);
+    gpuShader->setupShaderFromSource(GL_FRAGMENT_SHADER, dataToTextureFrag);
+    gpuShader->bindDefaults();
+    gpuShader->linkProgram();
+
+    gpuAvailable = gpuShader->isLoaded();
+    if(!gpuAvailable){
+        ofLog(OF_LOG_WARNING,"%s: GPU conversion shader not loaded, using CPU conversion",this->name.c_str());
+    }
+}
+
 OBJECT_REGISTER( DataToTexture, "data to texture", OFXVP_OBJECT_CAT_DATA)
 
 #endif
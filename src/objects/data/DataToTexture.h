@@ -36,6 +36,14 @@
 
 #include "PatchObject.h"
 
+#include "vectorMath.h"
+
+// data is painted on a fixed grid, then scaled to the output resolution
+#define DATA_TO_TEXTURE_GRID_WIDTH      320
+#define DATA_TO_TEXTURE_GRID_HEIGHT     240
+// row length of the float texture used by the GPU path
+#define DATA_TO_TEXTURE_GPU_ROW         1024
+
 class DataToTexture : public PatchObject {
 
 public:
@@ -53,13 +61,26 @@ public:
     void            removeObjectContent(bool removeFileFromData=false) override;
 
     void            resetResolution();
+    void            updateCPU();
+    void            updateGPU();
+    void            setupGPU();
 
 
     ofPixels                *pix;
     ofPixels                *scaledPix;
 
+    vector<float>           channelData[3];
+    vector<unsigned char>   channelBytes[3];
+
+    ofShader                *gpuShader;
+    ofFbo                   *gpuFbo;
+    ofTexture               *dataTex;
+    vector<float>           gpuData;
+
     bool                    loaded;
     bool                    needReset;
+    bool                    useGPU;
+    bool                    gpuAvailable;
 
     int                     temp_width, temp_height;
     float                   posX, posY, drawW, drawH;
@@ -40,9 +40,8 @@ FileToData::FileToData() : PatchObject("file to data"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
-    _outletParams[0] = new vector<float>(); // output
+    *(float *)&_inletParams[0] = 0.0f;  // bang
+    this->newOutletBuffer<vector<float>>(0); // output
 
     this->initInletsState();
 
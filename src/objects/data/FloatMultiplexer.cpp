@@ -40,12 +40,12 @@ FloatMultiplexer::FloatMultiplexer() : PatchObject("float multiplexer"){
     this->numInlets  = 6;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // float1
-    _inletParams[1] = new float();  // float2
-    _inletParams[2] = new float();  // float3
-    _inletParams[3] = new float();  // float4
-    _inletParams[4] = new float();  // float5
-    _inletParams[5] = new float();  // float6
+    *(float *)&_inletParams[0] = 0.0f;  // float1
+    *(float *)&_inletParams[1] = 0.0f;  // float2
+    *(float *)&_inletParams[2] = 0.0f;  // float3
+    *(float *)&_inletParams[3] = 0.0f;  // float4
+    *(float *)&_inletParams[4] = 0.0f;  // float5
+    *(float *)&_inletParams[5] = 0.0f;  // float6
     *(float *)&_inletParams[0] = 0.0f;
     *(float *)&_inletParams[1] = 0.0f;
     *(float *)&_inletParams[2] = 0.0f;
@@ -53,8 +53,7 @@ FloatMultiplexer::FloatMultiplexer() : PatchObject("float multiplexer"){
     *(float *)&_inletParams[4] = 0.0f;
     *(float *)&_inletParams[5] = 0.0f;
 
-    _outletParams[0] = new float();  // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f;  // output
 
     floatInlets     = 6;
 
@@ -231,7 +230,6 @@ void FloatMultiplexer::resetInletsSettings(){
     inletsMemory.assign(this->numInlets,0.0f);
 
     for(size_t i=0;i<floatInlets;i++){
-        _inletParams[i] = new float();
         *(float *)&_inletParams[i] = 0.0f;
     }
 
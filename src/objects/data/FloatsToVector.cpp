@@ -40,12 +40,12 @@ FloatsToVector::FloatsToVector() : PatchObject("floats to vector"){
     this->numInlets  = 6;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // float1
-    _inletParams[1] = new float();  // float2
-    _inletParams[2] = new float();  // float3
-    _inletParams[3] = new float();  // float4
-    _inletParams[4] = new float();  // float5
-    _inletParams[5] = new float();  // float6
+    *(float *)&_inletParams[0] = 0.0f;  // float1
+    *(float *)&_inletParams[1] = 0.0f;  // float2
+    *(float *)&_inletParams[2] = 0.0f;  // float3
+    *(float *)&_inletParams[3] = 0.0f;  // float4
+    *(float *)&_inletParams[4] = 0.0f;  // float5
+    *(float *)&_inletParams[5] = 0.0f;  // float6
     *(float *)&_inletParams[0] = 0.0f;
     *(float *)&_inletParams[1] = 0.0f;
     *(float *)&_inletParams[2] = 0.0f;
@@ -53,7 +53,7 @@ FloatsToVector::FloatsToVector() : PatchObject("floats to vector"){
     *(float *)&_inletParams[4] = 0.0f;
     *(float *)&_inletParams[5] = 0.0f;
 
-    _outletParams[0] = new vector<float>();  // final vector
+    this->newOutletBuffer<vector<float>>(0);  // final vector
 
     floatInlets     = 6;
 
@@ -96,12 +96,11 @@ void FloatsToVector::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow)
 
 //--------------------------------------------------------------
 void FloatsToVector::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    vector<float> &result = *static_cast<vector<float> *>(_outletParams[0]);
+    ofxVPMath::prepare(result,static_cast<size_t>(this->numInlets));
+    float *dst = result.data();
     for(int i=0;i<this->numInlets;i++){
-        if(this->inletsConnected[i]){
-            static_cast<vector<float> *>(_outletParams[0])->at(i) = *(float *)&_inletParams[i];
-        }else{
-            static_cast<vector<float> *>(_outletParams[0])->at(i) = 0.0f;
-        }
+        dst[i] = this->inletsConnected[i] ? *(float *)&_inletParams[i] : 0.0f;
     }
 
     if(needReset){
@@ -229,7 +228,6 @@ void FloatsToVector::resetInletsSettings(){
     static_cast<vector<float> *>(_outletParams[0])->assign(this->numInlets,0.0f);
 
     for(size_t i=0;i<floatInlets;i++){
-        _inletParams[i] = new float();
         *(float *)&_inletParams[i] = 0.0f;
     }
 
@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "vectorMath.h"
+
 class FloatsToVector : public PatchObject {
 
 public:
@@ -40,12 +40,14 @@ TextureToData::TextureToData() : PatchObject("texture to data"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // texture
+    this->newInletBuffer<ofTexture>(0);  // texture
 
-    _outletParams[0] = new vector<float>(); // data
+    this->newOutletBuffer<vector<float>>(0); // data
 
     this->initInletsState();
 
+    pix                 = new ofPixels();
+
     newConnection       = false;
     col                 = 0;
 
@@ -69,22 +71,40 @@ void TextureToData::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void TextureToData::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
-    static_cast<vector<float> *>(_outletParams[0])->clear();
-    if(this->inletsConnected[0]){
+    vector<float> *data = static_cast<vector<float> *>(_outletParams[0]);
+    ofTexture *tex = static_cast<ofTexture *>(_inletParams[0]);
+
+    if(this->inletsConnected[0] && tex->isAllocated()){
         if(!newConnection){
             newConnection = true;
-            pix = new ofPixels();
-            pix->allocate(static_cast<ofTexture *>(_inletParams[0])->getWidth(),static_cast<ofTexture *>(_inletParams[0])->getHeight(),OF_PIXELS_RGB);
-            col = static_cast<int>(static_cast<ofTexture *>(_inletParams[0])->getWidth()/2);
+            col = static_cast<int>(tex->getWidth()/2);
+        }
+        // readToPixels reallocates only when the texture size/format changes
+        tex->readToPixels(*pix);
+
+        const size_t w = pix->getWidth();
+        const size_t h = pix->getHeight();
+        const size_t channels = pix->getNumChannels();
+        if(w == 0 || h == 0 || channels == 0){
+            data->clear();
+            return;
         }
-        static_cast<ofTexture *>(_inletParams[0])->readToPixels(*pix);
-        for(int n=0; n<static_cast<ofTexture *>(_inletParams[0])->getHeight(); ++n){
-            float sampleR = ofMap(pix->getColor(col, n).r, 0, 255, -0.5f, 0.5f);        // RED CHANNEL
-            float sampleG = ofMap(pix->getColor(col, n).g, 0, 255, -0.5f, 0.5f);        // GREEN CHANNEL
-            float sampleB = ofMap(pix->getColor(col, n).b, 0, 255, -0.5f, 0.5f);        // BLUE CHANNEL
-            static_cast<vector<float> *>(_outletParams[0])->push_back((sampleR+sampleG+sampleB)/3.0f);
+        const size_t c = static_cast<size_t>(ofClamp(col,0,static_cast<int>(w)-1));
+        // gray textures use the same channel three times, as ofPixels::getColor does
+        const size_t gOff = channels >= 3 ? 1 : 0;
+        const size_t bOff = channels >= 3 ? 2 : 0;
+
+        // sum the column RGB values, then map them to -0.5 .. 0.5 in one vectorized pass
+        ofxVPMath::prepare(*data,h);
+        const unsigned char *src = pix->getData() + c*channels;
+        const size_t stride = w*channels;
+        for(size_t n=0;n<h;n++){
+            (*data)[n] = static_cast<float>(src[0] + src[gOff] + src[bOff]);
+            src += stride;
         }
+        ofxVPMath::scale(data->data(),1.0f/(3.0f*255.0f),-0.5f,data->data(),h);
     }else{
+        data->clear();
         newConnection       = false;
     }
 
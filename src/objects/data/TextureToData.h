@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "vectorMath.h"
+
 class TextureToData : public PatchObject {
 
 public:
@@ -40,12 +40,10 @@ VectorAt::VectorAt() : PatchObject("vector at"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();  // input vector
-    _inletParams[1] = new float();          // at
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<vector<float>>(0);  // input vector
+    *(float *)&_inletParams[1] = 0.0f;          // at
 
-    _outletParams[0] = new float();         // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f;         // output
 
     this->initInletsState();
 
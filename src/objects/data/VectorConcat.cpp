@@ -40,14 +40,14 @@ VectorConcat::VectorConcat() : PatchObject("vector concat"){
     this->numInlets  = 6;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>(); // vector1
-    _inletParams[1] = new vector<float>(); // vector2
-    _inletParams[2] = new vector<float>(); // vector3
-    _inletParams[3] = new vector<float>(); // vector4
-    _inletParams[4] = new vector<float>(); // vector5
-    _inletParams[5] = new vector<float>(); // vector6
+    this->newInletBuffer<vector<float>>(0); // vector1
+    this->newInletBuffer<vector<float>>(1); // vector2
+    this->newInletBuffer<vector<float>>(2); // vector3
+    this->newInletBuffer<vector<float>>(3); // vector4
+    this->newInletBuffer<vector<float>>(4); // vector5
+    this->newInletBuffer<vector<float>>(5); // vector6
 
-    _outletParams[0] = new vector<float>();  // final vector
+    this->newOutletBuffer<vector<float>>(0);  // final vector
 
     this->initInletsState();
 
@@ -89,12 +89,20 @@ void VectorConcat::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void VectorConcat::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
-    static_cast<vector<float> *>(_outletParams[0])->clear();
+    vector<float> &result = *static_cast<vector<float> *>(_outletParams[0]);
+    size_t totalSize = 0;
     for(int i=0;i<this->numInlets;i++){
         if(this->inletsConnected[i]){
-            for(size_t s=0;s<static_cast<size_t>(static_cast<vector<float> *>(_inletParams[i])->size());s++){
-                static_cast<vector<float> *>(_outletParams[0])->push_back(static_cast<vector<float> *>(_inletParams[i])->at(s));
-            }
+            totalSize += static_cast<vector<float> *>(_inletParams[i])->size();
+        }
+    }
+    ofxVPMath::prepare(result,totalSize);
+    size_t offset = 0;
+    for(int i=0;i<this->numInlets;i++){
+        if(this->inletsConnected[i]){
+            const vector<float> &data = *static_cast<vector<float> *>(_inletParams[i]);
+            ofxVPMath::copy(data.data(),data.size(),result,offset);
+            offset += data.size();
         }
     }
 
@@ -227,7 +235,7 @@ void VectorConcat::resetInletsSettings(){
     this->numInlets = dataInlets;
 
     for(size_t i=0;i<dataInlets;i++){
-        _inletParams[i] = new vector<float>();
+        this->newInletBuffer<vector<float>>(i);
     }
 
     this->inletsType.clear();
@@ -40,13 +40,11 @@ VectorExtract::VectorExtract() : PatchObject("vector extract"){
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>(); // data vector
-    _inletParams[1] = new float();  // start
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // end
-    *(float *)&_inletParams[2] = 0.0f;
+    this->newInletBuffer<vector<float>>(0); // data vector
+    *(float *)&_inletParams[1] = 0.0f;  // start
+    *(float *)&_inletParams[2] = 0.0f;  // end
 
-    _outletParams[0] = new vector<float>();  // final vector
+    this->newOutletBuffer<vector<float>>(0);  // final vector
 
     this->initInletsState();
 
@@ -78,12 +76,11 @@ void VectorExtract::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void VectorExtract::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
-    static_cast<vector<float> *>(_outletParams[0])->clear();
-
-    if(this->inletsConnected[0] && start < end){
-        for(size_t s=start;s<end;s++){
-            static_cast<vector<float> *>(_outletParams[0])->push_back(static_cast<vector<float> *>(_inletParams[0])->at(s));
-        }
+    if(this->inletsConnected[0] && start >= 0 && start < end && static_cast<size_t>(end) <= static_cast<vector<float> *>(_inletParams[0])->size()){
+        ofxVPMath::prepare(*static_cast<vector<float> *>(_outletParams[0]),static_cast<size_t>(end-start));
+        ofxVPMath::copy(static_cast<vector<float> *>(_inletParams[0])->data()+start,static_cast<size_t>(end-start),*static_cast<vector<float> *>(_outletParams[0]));
+    }else{
+        static_cast<vector<float> *>(_outletParams[0])->clear();
     }
 
     if(this->inletsConnected[1]){
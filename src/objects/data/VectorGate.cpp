@@ -40,17 +40,16 @@ VectorGate::VectorGate() : PatchObject("vector gate"){
     this->numInlets  = 7;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
-    _inletParams[1] = new vector<float>();  // vector1
-    _inletParams[2] = new vector<float>();  // vector2
-    _inletParams[3] = new vector<float>();  // vector3
-    _inletParams[4] = new vector<float>();  // vector4
-    _inletParams[5] = new vector<float>();  // vector5
-    _inletParams[6] = new vector<float>();  // vector6
+    this->newInletBuffer<vector<float>>(1);  // vector1
+    this->newInletBuffer<vector<float>>(2);  // vector2
+    this->newInletBuffer<vector<float>>(3);  // vector3
+    this->newInletBuffer<vector<float>>(4);  // vector4
+    this->newInletBuffer<vector<float>>(5);  // vector5
+    this->newInletBuffer<vector<float>>(6);  // vector6
 
-    _outletParams[0] = new vector<float>(); // output
+    this->newOutletBuffer<vector<float>>(0); // output
 
     dataInlets      = 6;
 
@@ -236,11 +235,10 @@ void VectorGate::resetInletsSettings(){
 
     this->numInlets = dataInlets+1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
     for(size_t i=1;i<this->numInlets;i++){
-        _inletParams[i] = new vector<float>();
+        this->newInletBuffer<vector<float>>(i);
     }
 
     this->inletsType.clear();
@@ -40,11 +40,10 @@ VectorOperator::VectorOperator() : PatchObject("vector operator"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();  // input data
-    _inletParams[1] = new float();  // multiplier
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<vector<float>>(0);  // input data
+    *(float *)&_inletParams[1] = 0.0f;  // multiplier
 
-    _outletParams[0] = new vector<float>(); // output
+    this->newOutletBuffer<vector<float>>(0); // output
 
     this->initInletsState();
 
@@ -88,19 +87,18 @@ void VectorOperator::updateObjectContent(map<int,shared_ptr<PatchObject>> &patch
         number = *(float *)&_inletParams[1];
     }
 
-    static_cast<vector<float> *>(_outletParams[0])->clear();
     if(this->inletsConnected[0]){
-        for(size_t s=0;s<static_cast<size_t>(static_cast<vector<float> *>(_inletParams[0])->size());s++){
-            if(_operator == Vec_Operator_ADD){
-                static_cast<vector<float> *>(_outletParams[0])->push_back(static_cast<vector<float> *>(_inletParams[0])->at(s)+number);
-            }else if(_operator == Vec_Operator_SUBTRACT){
-                static_cast<vector<float> *>(_outletParams[0])->push_back(static_cast<vector<float> *>(_inletParams[0])->at(s)-number);
-            }else if(_operator == Vec_Operator_MULTIPLY){
-                static_cast<vector<float> *>(_outletParams[0])->push_back(static_cast<vector<float> *>(_inletParams[0])->at(s)*number);
-            }else if(_operator == Vec_Operator_DIVIDE){
-                static_cast<vector<float> *>(_outletParams[0])->push_back(static_cast<vector<float> *>(_inletParams[0])->at(s)/number);
-            }
+        const vector<float> &data = *static_cast<vector<float> *>(_inletParams[0]);
+        vector<float> &result = *static_cast<vector<float> *>(_outletParams[0]);
+        switch(_operator){
+            case Vec_Operator_ADD:      ofxVPMath::add(data,number,result); break;
+            case Vec_Operator_SUBTRACT: ofxVPMath::sub(data,number,result); break;
+            case Vec_Operator_MULTIPLY: ofxVPMath::mul(data,number,result); break;
+            case Vec_Operator_DIVIDE:   ofxVPMath::div(data,number,result); break;
+            default: result.clear(); break;
         }
+    }else{
+        static_cast<vector<float> *>(_outletParams[0])->clear();
     }
 }
 
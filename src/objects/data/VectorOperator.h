@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "vectorMath.h"
+
 enum Vector_Operator { Vec_Operator_ADD, Vec_Operator_SUBTRACT, Vec_Operator_MULTIPLY, Vec_Operator_DIVIDE, Vec_Operator_COUNT };
 
 class VectorOperator : public PatchObject {
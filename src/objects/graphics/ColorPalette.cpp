@@ -40,11 +40,10 @@ ColorPalette::ColorPalette() : PatchObject("color palette"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>(); // base color
-    _inletParams[1] = new float();      // bang
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<vector<float>>(0); // base color
+    *(float *)&_inletParams[1] = 0.0f;      // bang
 
-    _outletParams[0] = new vector<float>(); // palette
+    this->newOutletBuffer<vector<float>>(0); // palette
 
     this->initInletsState();
 
@@ -40,7 +40,7 @@ ImageLoader::ImageLoader() : PatchObject("image loader"){
     this->numInlets  = 0;
     this->numOutlets = 1;
 
-    _outletParams[0] = new ofTexture(); // output
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
@@ -58,6 +58,8 @@ ImageLoader::ImageLoader() : PatchObject("image loader"){
     imgPath = "";
 
     this->setIsTextureObj(true);
+    // the same image is sent every frame, it changes only on file load
+    this->setTracksOutletChanges(true);
 
 }
 
@@ -94,6 +96,7 @@ void ImageLoader::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObj
     if(!isFileLoaded && img->isAllocated()){
         isFileLoaded = true;
         static_cast<ofTexture *>(_outletParams[0])->allocate(img->getPixels());
+        this->markOutletChanged(0);
         ofLog(OF_LOG_NOTICE,"[verbose] image file loaded: %s",filepath.c_str());
     }
 
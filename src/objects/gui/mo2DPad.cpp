@@ -40,13 +40,13 @@ mo2DPad::mo2DPad() : PatchObject("2d pad"){
     this->numInlets  = 2;
     this->numOutlets = 2;
 
-    _inletParams[0] = new float();  // X
-    _inletParams[1] = new float();  // Y
+    *(float *)&_inletParams[0] = 0.0f;  // X
+    *(float *)&_inletParams[1] = 0.0f;  // Y
     *(float *)&_inletParams[0] = 0.0f;
     *(float *)&_inletParams[1] = 0.0f;
 
-    _outletParams[0] = new float(); // output X
-    _outletParams[1] = new float(); // output Y
+    *(float *)&_outletParams[0] = 0.0f; // output X
+    *(float *)&_outletParams[1] = 0.0f; // output Y
     *(float *)&_outletParams[0] = 0.0f;
     *(float *)&_outletParams[1] = 0.0f;
 
@@ -43,13 +43,11 @@ moBang::moBang() :
     this->numInlets  = 1;
     this->numOutlets = 2;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
-    _outletParams[1] = new string(); // output string
+    this->newOutletBuffer<string>(1); // output string
     *static_cast<string *>(_outletParams[1]) = "";
 
     this->initInletsState();
@@ -40,12 +40,11 @@ moComment::moComment() : PatchObject("comment"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new string();  // comment
+    *(float *)&_inletParams[0] = 0.0f;  // bang
+    this->newInletBuffer<string>(1);  // comment
     *static_cast<string *>(_inletParams[1]) = "";
 
-    _outletParams[0] = new string(); // output string
+    this->newOutletBuffer<string>(0); // output string
     *static_cast<string *>(_outletParams[0]) = "";
 
     this->initInletsState();
@@ -40,7 +40,7 @@ moDataViewer::moDataViewer() : PatchObject("data viewer"){
     this->numInlets  = 1;
     this->numOutlets = 0;
 
-    _inletParams[0] = new vector<float>();  // RAW Data
+    this->newInletBuffer<vector<float>>(0);  // RAW Data
 
     this->initInletsState();
 
@@ -123,9 +123,9 @@ void moDataViewer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
     // Visualize (Object main view)
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
 
-        // draw data
+        // draw data (rebuilt when the linked outlet version changes)
         if(this->inletsConnected[0] && !static_cast<vector<float> *>(_inletParams[0])->empty()){
-            ImGuiEx::PlotBands(_nodeCanvas.getNodeDrawList(), 0, ImGui::GetWindowSize().y - 26, static_cast<vector<float> *>(_inletParams[0]), max, IM_COL32(color.x*255,color.y*255,color.z*255,color.w*255));
+            ImGuiEx::PlotBands("##dataBands", _nodeCanvas.getNodeDrawList(), 0, ImGui::GetWindowSize().y - 26, static_cast<vector<float> *>(_inletParams[0]), max, IM_COL32(color.x*255,color.y*255,color.z*255,color.w*255), this->_inletVersions[0]+1);
         }
 
         _nodeCanvas.EndNodeContent();
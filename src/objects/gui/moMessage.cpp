@@ -40,13 +40,12 @@ moMessage::moMessage() : PatchObject("message"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new string();  // message
+    this->newInletBuffer<string>(1);  // message
     *static_cast<string *>(_inletParams[1]) = "";
 
-    _outletParams[0] = new string(); // output
+    this->newOutletBuffer<string>(0); // output
     *static_cast<string *>(_outletParams[0]) = "";
 
     this->initInletsState();
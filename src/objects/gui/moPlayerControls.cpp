@@ -40,13 +40,11 @@ moPlayerControls::moPlayerControls() : PatchObject("player controls"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new float();  // select
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // select
 
-    _outletParams[0] = new string(); // output
+    this->newOutletBuffer<string>(0); // output
     *static_cast<string *>(_outletParams[0]) = "";
 
     this->initInletsState();
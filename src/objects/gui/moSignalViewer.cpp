@@ -43,18 +43,19 @@ moSignalViewer::moSignalViewer() :
     this->numInlets  = 1;
     this->numOutlets = 4;
 
-    _inletParams[0] = new ofSoundBuffer();  // signal
+    this->newInletBuffer<ofSoundBuffer>(0);  // signal
 
-    _outletParams[0] = new ofSoundBuffer();     // signal
-    _outletParams[1] = new ofSoundBuffer();     // signal
-    _outletParams[2] = new vector<float>();     // audio buffer
-    _outletParams[3] = new float();             // RMS
-    *(float *)&_outletParams[3] = 0.0f;
+    this->newOutletBuffer<ofSoundBuffer>(0);     // signal
+    this->newOutletBuffer<ofSoundBuffer>(1);     // signal
+    this->newOutletBuffer<vector<float>>(2);     // audio buffer
+    *(float *)&_outletParams[3] = 0.0f;             // RMS
 
     this->initInletsState();
 
     this->width             *= 2;
 
+    plotVersion             = 0;
+
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
@@ -121,7 +122,7 @@ void moSignalViewer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
 
         // draw waveform
-        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImGui::GetWindowSize(), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor);
+        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImGui::GetWindowSize(), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor, plotVersion.load());
 
         // draw signal RMS amplitude
         _nodeCanvas.getNodeDrawList()->AddRectFilled(ImGui::GetWindowPos()+ImVec2(0,ImGui::GetWindowSize().y),ImGui::GetWindowPos()+ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y * (1.0f - ofClamp(static_cast<ofSoundBuffer *>(_inletParams[0])->getRMSAmplitude(),0.0,1.0))),IM_COL32(255,255,120,12));
@@ -175,19 +176,31 @@ void moSignalViewer::audioInObject(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void moSignalViewer::audioOutObject(ofSoundBuffer &outBuffer){
     if(this->inletsConnected[0]){
-        *static_cast<ofSoundBuffer *>(_outletParams[0]) = *static_cast<ofSoundBuffer *>(_inletParams[0]);
-        *static_cast<ofSoundBuffer *>(_outletParams[1]) = *static_cast<ofSoundBuffer *>(_inletParams[0]);
+        if(this->getIsOutletConnectedDSP(0)){
+            *static_cast<ofSoundBuffer *>(_outletParams[0]) = *static_cast<ofSoundBuffer *>(_inletParams[0]);
+        }
+        if(this->getIsOutletConnectedDSP(1)){
+            *static_cast<ofSoundBuffer *>(_outletParams[1]) = *static_cast<ofSoundBuffer *>(_inletParams[0]);
+        }
 
+        bool sendData = this->getIsOutletConnectedDSP(2);
         for(size_t i = 0; i < static_cast<ofSoundBuffer *>(_inletParams[0])->getNumFrames(); i++) {
             float sample = static_cast<ofSoundBuffer *>(_inletParams[0])->getSample(i,0);
             plot_data[i] = hardClip(sample);
 
             // SIGNAL BUFFER DATA
-            static_cast<vector<float> *>(_outletParams[2])->at(i) = sample;
+            if(sendData){
+                static_cast<vector<float> *>(_outletParams[2])->at(i) = sample;
+            }
         }
+        plotVersion++;
     }else{
-        *static_cast<ofSoundBuffer *>(_outletParams[0]) *= 0.0f;
-        *static_cast<ofSoundBuffer *>(_outletParams[1]) *= 0.0f;
+        if(this->getIsOutletConnectedDSP(0)){
+            *static_cast<ofSoundBuffer *>(_outletParams[0]) *= 0.0f;
+        }
+        if(this->getIsOutletConnectedDSP(1)){
+            *static_cast<ofSoundBuffer *>(_outletParams[1]) *= 0.0f;
+        }
     }
 
 }
@@ -60,6 +60,7 @@ public:
     void            audioOutObject(ofSoundBuffer &outBuffer) override;
 
     float           plot_data[1024];
+    std::atomic<uint64_t> plotVersion;
 
     int             bufferSize;
     int             sampleRate;
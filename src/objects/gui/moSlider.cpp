@@ -40,12 +40,10 @@ moSlider::moSlider() : PatchObject("slider"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // value
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // value
 
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
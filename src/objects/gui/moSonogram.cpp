@@ -40,12 +40,15 @@ moSonogram::moSonogram() : PatchObject("sonogram"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();  // fft
+    this->newInletBuffer<vector<float>>(0);  // fft
 
-    _outletParams[0] = new ofTexture();  // texture
+    this->newOutletBuffer<ofTexture>(0);  // texture
 
     this->initInletsState();
 
+    // the texture changes only while drawing the incoming fft
+    this->setTracksOutletChanges(true);
+
      // 16:9 proportion
     this->width             = 428;
     this->height            = 240;
@@ -155,6 +158,7 @@ void moSonogram::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRend
         ofPopView();
         glPopAttrib();
         sonogram->end();
+        this->markOutletChanged(0);
 
         if(static_cast<ofTexture *>(_outletParams[0])->isAllocated()){
             if(scaledObjW*canvasZoom > 90.0f){
@@ -227,7 +231,7 @@ void moSonogram::removeObjectContent(bool removeFileFromData){
 void moSonogram::resetTextures(){
 
     sonogram                = new ofFbo();
-    _outletParams[0]        = new ofTexture();
+    this->newOutletBuffer<ofTexture>(0);
 
     sonogram->allocate(this->width,this->height,GL_RGBA);
 
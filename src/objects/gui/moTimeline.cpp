@@ -42,10 +42,9 @@ moTimeline::moTimeline() : PatchObject("timeline"){
     this->numInlets  = 2;
     this->numOutlets = 0;
 
-    _inletParams[0] = new string();  // control
+    this->newInletBuffer<string>(0);  // control
     *static_cast<string *>(_inletParams[0]) = "";
-    _inletParams[1] = new float();  // playhead
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // playhead
 
     this->initInletsState();
 
@@ -199,12 +198,18 @@ void moTimeline::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
         if(lastMessage != *static_cast<string *>(_inletParams[0])){
             lastMessage = *static_cast<string *>(_inletParams[0]);
 
+            // time elapsed since the message was sent, the playhead starts from there
+            double now  = ofxVPAudioClock::get().now();
+            double late = now - ofxVPAudioClock::eventTime(this->_inletTimes[0],now);
+
             if(lastMessage == "play"){
                 timeline->play();
+                timeline->setCurrentTimeSeconds(timeline->getCurrentTime()+late);
             }else if(lastMessage == "pause"){
                 timeline->stop();
             }else if(lastMessage == "unpause"){
                 timeline->play();
+                timeline->setCurrentTimeSeconds(timeline->getCurrentTime()+late);
             }else if(lastMessage == "stop"){
                 timeline->setCurrentTimeSeconds(0);
                 timeline->stop();
@@ -226,7 +231,9 @@ void moTimeline::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
     }
 
     // pass timeline data to outlets (if any)
+    double sampleTime = ofxVPAudioClock::get().now();
     for(int i=0;i<actualTracks->size();i++){
+        this->_outletTimes[i] = sampleTime;
         if(this->getOutletType(i) == VP_LINK_NUMERIC){
             if(actualTracks->at(i).at(2) == 'S' || (actualTracks->at(i).at(0) == '_' && actualTracks->at(i).at(3) == 'S')){ // SWITCHES
                 ofxTLSwitches* tempMT = (ofxTLSwitches*)timeline->getTrack(actualTracks->at(i));
@@ -745,11 +752,10 @@ void moTimeline::resetOutlets(){
 
     for( int i = 0; i < tempTracks.size(); i++){
         if(tempTracks.at(i)->getTrackType() == "Colors"){
-            _outletParams[i] = new vector<float>();
+            this->newOutletBuffer<vector<float>>(i);
             static_cast<vector<float> *>(_outletParams[i])->assign(3,0.0f);
             this->addOutlet(VP_LINK_ARRAY,"colorTrackRGB");
         }else{
-            _outletParams[i] = new float();
             *(float *)&_outletParams[i] = 0.0f;
             this->addOutlet(VP_LINK_NUMERIC,"trackData");
         }
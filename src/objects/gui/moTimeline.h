@@ -35,6 +35,7 @@
 #pragma once
 
 #include "PatchObject.h"
+#include "audioClock.h"
 
 #include "IconsFontAwesome5.h"
 
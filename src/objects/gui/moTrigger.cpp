@@ -40,11 +40,9 @@ moTrigger::moTrigger() : PatchObject("trigger"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
     this->initInletsState();
 
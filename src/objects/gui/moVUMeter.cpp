@@ -40,10 +40,9 @@ moVUMeter::moVUMeter() : PatchObject("vu meter"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // signal
+    this->newInletBuffer<ofSoundBuffer>(0);  // signal
 
-    _outletParams[0] = new float(); // RMS
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // RMS
 
     this->initInletsState();
 
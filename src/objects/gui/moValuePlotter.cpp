@@ -47,14 +47,12 @@ moValuePlotter::moValuePlotter() :
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // value
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // value
 
     *(float *)&_inletParams[1] = lastMinRange.get();
     *(float *)&_inletParams[2] = lastMaxRange.get();
 
-    _outletParams[0] = new float(); // value
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // value
 
     this->initInletsState();
 
@@ -40,9 +40,9 @@ moVideoViewer::moVideoViewer() : PatchObject("video viewer"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // texture
+    this->newInletBuffer<ofTexture>(0);  // texture
 
-    _outletParams[0] = new ofTexture();  // texture
+    this->newOutletBuffer<ofTexture>(0);  // texture
 
     posX = posY = drawW = drawH = 0.0f;
 
@@ -51,6 +51,9 @@ moVideoViewer::moVideoViewer() : PatchObject("video viewer"){
 
     this->initInletsState();
 
+    // the output is the input texture
+    this->setTracksOutletChanges(true);
+
     this->setIsResizable(true);
     this->setIsTextureObj(true);
 
@@ -81,6 +84,9 @@ void moVideoViewer::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 void moVideoViewer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated()){
         *static_cast<ofTexture *>(_outletParams[0]) = *static_cast<ofTexture *>(_inletParams[0]);
+        if(this->inputsChanged()){
+            this->markOutletChanged(0);
+        }
     }
 
     if(!loaded){
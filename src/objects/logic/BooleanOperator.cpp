@@ -40,13 +40,10 @@ BooleanOperator::BooleanOperator() : PatchObject("boolean operator"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // b1
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // b2
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // b1
+    *(float *)&_inletParams[1] = 0.0f;  // b2
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
@@ -40,14 +40,11 @@ Conditional::Conditional() : PatchObject("conditional operator"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // input number
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // input number
 
-    _inletParams[1] = new float();  // value
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // value
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
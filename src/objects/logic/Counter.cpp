@@ -40,17 +40,13 @@ Counter::Counter() : PatchObject("counter"){
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new float();  // start
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // start
 
-    _inletParams[2] = new float();  // end
-    *(float *)&_inletParams[2] = 1.0f;
+    *(float *)&_inletParams[2] = 1.0f;  // end
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
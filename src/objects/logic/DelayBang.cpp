@@ -40,16 +40,13 @@ DelayBang::DelayBang() : PatchObject("delay bang"){
     this->numInlets  = 2;
     this->numOutlets = 2;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new float();  // ms
-    *(float *)&_inletParams[1] = 1000.0f;
+    *(float *)&_inletParams[1] = 1000.0f;  // ms
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
-    _outletParams[1] = new string(); // output string
+    this->newOutletBuffer<string>(1); // output string
     *static_cast<string *>(_outletParams[1]) = "";
 
     this->initInletsState();
@@ -60,7 +57,7 @@ DelayBang::DelayBang() : PatchObject("delay bang"){
     loadStart           = false;
 
     wait                = 1000;
-    startTime           = ofGetElapsedTimeMillis();
+    startTime           = ofxVPAudioClock::get().now();
 
     loaded              = false;
 
@@ -91,6 +88,8 @@ void DelayBang::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
 //--------------------------------------------------------------
 void DelayBang::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
+    double now = ofxVPAudioClock::get().now();
+
     if(this->inletsConnected[1]){
         wait                = static_cast<int>(floor(*(float *)&_inletParams[1]));
     }
@@ -99,14 +98,17 @@ void DelayBang::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
         if(*(float *)&_inletParams[0] == 1.0 && !bang){
             bang        = true;
             loadStart   = false;
-            startTime   = ofGetElapsedTimeMillis();
+            // count the delay from when the bang was sent, not from this frame
+            startTime   = ofxVPAudioClock::eventTime(this->_inletTimes[0],now);
         }
     }
 
-    if(!loadStart && (ofGetElapsedTimeMillis()-startTime > wait)){
+    if(!loadStart && (now-startTime >= wait/1000.0)){
         bang        = false;
         loadStart   = true;
         delayBang   = true;
+        this->_outletTimes[0] = startTime + wait/1000.0;
+        this->_outletTimes[1] = this->_outletTimes[0];
     }else{
         delayBang   = false;
     }
@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "audioClock.h"
+
 #include "imgui_controls.h"
 
 class DelayBang : public PatchObject {
@@ -63,7 +65,7 @@ public:
 
     bool                    loadStart;
     int                     wait;
-    size_t                  startTime;
+    double                  startTime;
 
     bool                    loaded;
 
@@ -40,17 +40,13 @@ DelayFloat::DelayFloat() : PatchObject("delay float"){
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new float();  // number
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // number
 
-    _inletParams[2] = new float();  // ms
-    *(float *)&_inletParams[2] = 1000.0f;
+    *(float *)&_inletParams[2] = 1000.0f;  // ms
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
     this->initInletsState();
 
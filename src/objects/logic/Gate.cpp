@@ -40,15 +40,14 @@ Gate::Gate() : PatchObject("gate"){
     this->numInlets  = 7;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
-
-    _inletParams[1] = new float();  // float1
-    _inletParams[2] = new float();  // float2
-    _inletParams[3] = new float();  // float3
-    _inletParams[4] = new float();  // float4
-    _inletParams[5] = new float();  // float5
-    _inletParams[6] = new float();  // float5
+    *(float *)&_inletParams[0] = 0.0f;  // open
+
+    *(float *)&_inletParams[1] = 0.0f;  // float1
+    *(float *)&_inletParams[2] = 0.0f;  // float2
+    *(float *)&_inletParams[3] = 0.0f;  // float3
+    *(float *)&_inletParams[4] = 0.0f;  // float4
+    *(float *)&_inletParams[5] = 0.0f;  // float5
+    *(float *)&_inletParams[6] = 0.0f;  // float5
     *(float *)&_inletParams[1] = 0.0f;
     *(float *)&_inletParams[2] = 0.0f;
     *(float *)&_inletParams[3] = 0.0f;
@@ -56,8 +55,7 @@ Gate::Gate() : PatchObject("gate"){
     *(float *)&_inletParams[5] = 0.0f;
     *(float *)&_inletParams[6] = 0.0f;
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
     floatInlets      = 6;
 
@@ -243,11 +241,9 @@ void Gate::resetInletsSettings(){
 
     this->numInlets = floatInlets+1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
     for(size_t i=1;i<this->numInlets;i++){
-        _inletParams[i] = new float();
         *(float *)&_inletParams[i] = 0.0f;
     }
 
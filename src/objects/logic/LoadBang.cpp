@@ -40,13 +40,11 @@ LoadBang::LoadBang() : PatchObject("loadbang"){
     this->numInlets  = 1;
     this->numOutlets = 2;
 
-    _inletParams[0] = new float();  // time
-    *(float *)&_inletParams[0] = 1000.0f;
+    *(float *)&_inletParams[0] = 1000.0f;  // time
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
-    _outletParams[1] = new string(); // output string
+    this->newOutletBuffer<string>(1); // output string
     *static_cast<string *>(_outletParams[1]) = "";
 
     this->initInletsState();
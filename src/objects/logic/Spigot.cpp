@@ -40,34 +40,35 @@ Spigot::Spigot() : PatchObject("spigot"){
     this->numInlets  = 6;
     this->numOutlets = 5;
 
-    _inletParams[0] = new vector<float>();  // state
+    this->newInletBuffer<vector<float>>(0);  // state
 
-    _inletParams[1] = new float();  // float
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // float
 
-    _inletParams[2] = new string();  // string
+    this->newInletBuffer<string>(2);  // string
     *static_cast<string *>(_inletParams[2]) = "";
 
-    _inletParams[3] = new vector<float>(); // vector
+    this->newInletBuffer<vector<float>>(3); // vector
 
-    _inletParams[4] = new ofTexture(); // texture
+    this->newInletBuffer<ofTexture>(4); // texture
 
-    _inletParams[5] = new ofSoundBuffer();  // signal
+    this->newInletBuffer<ofSoundBuffer>(5);  // signal
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
-    _outletParams[1] = new string();  // string
+    this->newOutletBuffer<string>(1);  // string
     *static_cast<string *>(_outletParams[1]) = "";
 
-    _outletParams[2] = new vector<float>(); // vector
+    this->newOutletBuffer<vector<float>>(2); // vector
 
-    _outletParams[3] = new ofTexture(); // texture
+    this->newOutletBuffer<ofTexture>(3); // texture
 
-    _outletParams[4] = new ofSoundBuffer();  // signal
+    this->newOutletBuffer<ofSoundBuffer>(4);  // signal
 
     this->initInletsState();
 
+    // the texture outlet changes only with the inputs and the open gates
+    this->setTracksOutletChanges(true);
+
     isOpen = new bool[5];
     for(int i=0;i<5;i++){
         isOpen[i] = false;
@@ -160,6 +161,9 @@ void Spigot::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects)
         }else{
             *static_cast<ofTexture *>(_outletParams[3]) = kuro->getTexture();
         }
+        if(this->inputsChanged()){
+            this->markOutletChanged(3);
+        }
 
     }
 
@@ -257,6 +261,10 @@ void Spigot::removeObjectContent(bool removeFileFromData){
 
 //--------------------------------------------------------------
 void Spigot::audioOutObject(ofSoundBuffer &outputBuffer){
+    if(!this->getIsOutletConnectedDSP(4)){
+        return;
+    }
+
     if(isOpen[4]){
         if(this->inletsConnected[5]){
             *static_cast<ofSoundBuffer *>(_outletParams[4]) = *static_cast<ofSoundBuffer *>(_inletParams[5]);
@@ -40,14 +40,11 @@ TimedSemaphore::TimedSemaphore() : PatchObject("timed semaphore"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new float();  // ms
-    *(float *)&_inletParams[1] = 1000.0f;
+    *(float *)&_inletParams[1] = 1000.0f;  // ms
 
-    _outletParams[0] = new float(); // output numeric
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output numeric
 
     this->initInletsState();
 
@@ -56,7 +53,7 @@ TimedSemaphore::TimedSemaphore() : PatchObject("timed semaphore"){
     loadStart           = true;
 
     wait                = 1000;
-    startTime           = ofGetElapsedTimeMillis();
+    startTime           = ofxVPAudioClock::get().now();
 
 }
 
@@ -84,6 +81,8 @@ void TimedSemaphore::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow)
 //--------------------------------------------------------------
 void TimedSemaphore::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
 
+    double now = ofxVPAudioClock::get().now();
+
     if(this->inletsConnected[1]){
       wait = static_cast<int>(floor(*(float *)&_inletParams[1]));
     }
@@ -92,13 +91,14 @@ void TimedSemaphore::updateObjectContent(map<int,shared_ptr<PatchObject>> &patch
         if(*(float *)&_inletParams[0] == 1.0 && !bang){
             bang        = true;
             loadStart   = false;
-            startTime   = ofGetElapsedTimeMillis();
+            startTime   = ofxVPAudioClock::eventTime(this->_inletTimes[0],now);
+            this->_outletTimes[0] = startTime;
         }
     }else{
       bang        = false;
     }
 
-    if(!loadStart && (ofGetElapsedTimeMillis()-startTime > wait)){
+    if(!loadStart && (now-startTime >= wait/1000.0)){
         loadStart   = true;
     }
     
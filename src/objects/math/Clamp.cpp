@@ -40,15 +40,11 @@ Clamp::Clamp() : PatchObject("clamp"){
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // min
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // max
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // value
-    *(float *)&_inletParams[2] = 0.0f;
-
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // min
+    *(float *)&_inletParams[1] = 0.0f;  // max
+    *(float *)&_inletParams[2] = 0.0f;  // value
+
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
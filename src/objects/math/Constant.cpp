@@ -45,15 +45,14 @@ Constant::Constant() :
     this->numOutlets = 2;
 
     // Bind Inlets to values
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
     *(float *)&_inletParams[1] = inputValueNew.get(); // value
 
     // Bind outlets to values
     *(float *)&_outletParams[0] = inputValueNew.get(); // float output
 
-     _outletParams[1] = new string(); // string output
+     this->newOutletBuffer<string>(1); // string output
      *static_cast<string *>(_outletParams[1]) = "";
 
     this->initInletsState();
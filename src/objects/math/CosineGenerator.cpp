@@ -41,13 +41,10 @@ CosineGenerator::CosineGenerator() : PatchObject("cosine generator")
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // speed
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
+    *(float *)&_inletParams[1] = 0.0f;  // speed
 
-    _outletParams[0] = new float(); // cosine value
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // cosine value
 
     this->initInletsState();
 
@@ -40,19 +40,13 @@ Map::Map() : PatchObject("map"){
     this->numInlets  = 5;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // value
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // in min
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // in max
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();  // out min
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();  // out max
-    *(float *)&_inletParams[4] = 0.0f;
-
-    _outletParams[0] = new float(); // mapped value
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // value
+    *(float *)&_inletParams[1] = 0.0f;  // in min
+    *(float *)&_inletParams[2] = 0.0f;  // in max
+    *(float *)&_inletParams[3] = 0.0f;  // out min
+    *(float *)&_inletParams[4] = 0.0f;  // out max
+
+    *(float *)&_outletParams[0] = 0.0f; // mapped value
 
     this->initInletsState();
 
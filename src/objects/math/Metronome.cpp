@@ -47,20 +47,14 @@ Metronome::Metronome() :
 
     *(float *)&_inletParams[0] = timeSetting.get();
 
-    _inletParams[1] = new float(); // bang
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f; // bang
 
-    _outletParams[0] = new float(); // bang
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // bang
 
-    _outletParams[1] = new float(); // system bpm bang
-    *(float *)&_outletParams[1] = 0.0f;
+    *(float *)&_outletParams[1] = 0.0f; // system bpm bang
 
     this->initInletsState();
 
-    resetTime = ofGetElapsedTimeMillis();
-    metroTime = ofGetElapsedTimeMillis();
-
     sync                = false;
 
     bpmMetro            = false;
@@ -94,7 +88,7 @@ void Metronome::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 //--------------------------------------------------------------
 void Metronome::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
 
-    metroTime = ofGetElapsedTimeMillis();
+    double now = ofxVPAudioClock::get().now();
 
     if(this->inletsConnected[0] && static_cast<int>(floor(*(float *)&_inletParams[0])) != timeSetting.get()){
         timeSetting.get() = static_cast<int>(floor(*(float *)&_inletParams[0]));
@@ -105,13 +99,25 @@ void Metronome::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
         sync = static_cast<bool>(floor(*(float *)&_inletParams[1]));
     }
 
-    if(sync){
-        resetTime = ofGetElapsedTimeMillis();
+    double period = std::max(timeSetting.get(),1)/1000.0;
+
+    if(sync || !metroTimer.isPending()){
+        // restart the period from the sync bang (or from now)
+        double start = sync ? ofxVPAudioClock::eventTime(this->_inletTimes[1],now) : now;
+        metroTimer.schedule(start + period);
     }
 
-    if(metroTime-resetTime > timeSetting.get()){
-        resetTime = ofGetElapsedTimeMillis();
+    double bangTime;
+    if(metroTimer.elapsed(now,bangTime)){
         *(float *)&_outletParams[0] = 1.0f;
+        this->_outletTimes[0] = bangTime;
+        // next bang is scheduled from the intended time, not from the frame that noticed it,
+        // so the metronome never drifts; periods entirely lost (stalled frames) are skipped
+        double next = bangTime + period;
+        if(next <= now){
+            next += (floor((now - next)/period) + 1.0)*period;
+        }
+        metroTimer.schedule(next);
     }else{
         *(float *)&_outletParams[0] = 0.0f;
     }
@@ -119,6 +125,7 @@ void Metronome::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
     if(bpmMetro){
         bpmMetro = false;
         *(float *)&_outletParams[1] = 1.0f;
+        this->_outletTimes[1] = now;
     }else{
         *(float *)&_outletParams[1] = 0.0f;
     }
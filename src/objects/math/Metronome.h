@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "audioClock.h"
+
 #include "imgui_plot.h"
 
 class Metronome : public PatchObject {
@@ -57,8 +59,7 @@ public:
     pdsp::Function          systemBPM;
     bool                    bpmMetro;
 
-    size_t                  resetTime;
-    size_t                  metroTime;
+    ofxVPClockTimer         metroTimer;
 
     bool                    sync;
 
@@ -40,11 +40,9 @@ SimpleNoise::SimpleNoise() : PatchObject("1D noise"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // step
-    *(float *)&_inletParams[0] = 0.001f;
+    *(float *)&_inletParams[0] = 0.001f;  // step
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
@@ -46,14 +46,12 @@ SimpleRandom::SimpleRandom() :
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
     *(float *)&_inletParams[1] = lastMinRange.get();
     *(float *)&_inletParams[2] = lastMaxRange.get();
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
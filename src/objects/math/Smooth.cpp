@@ -40,13 +40,12 @@ Smooth::Smooth() : PatchObject("smooth"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // input
-    _inletParams[1] = new float();  // smoothing
+    *(float *)&_inletParams[0] = 0.0f;  // input
+    *(float *)&_inletParams[1] = 0.0f;  // smoothing
     *(float *)&_inletParams[0] = 0.0f;
     *(float *)&_inletParams[1] = 1.0f;
 
-    _outletParams[0] = new float(); // output
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // output
 
     this->initInletsState();
 
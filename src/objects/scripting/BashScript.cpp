@@ -42,11 +42,11 @@ BashScript::BashScript() : PatchObject("bash script"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new string();         // control
-    *(string *)&_inletParams[0] = "";
+    this->newInletBuffer<string>(0);         // control
+    *static_cast<string *>(_inletParams[0]) = "";
 
-    _outletParams[0] = new string();        // output
-    *(string *)&_outletParams[0] = "";
+    this->newOutletBuffer<string>(0);        // output
+    *static_cast<string *>(_outletParams[0]) = "";
 
     this->initInletsState();
 
@@ -59,8 +59,12 @@ BashScript::BashScript() : PatchObject("bash script"){
 
     lastMessage         = "";
 
-    threadLoaded        = false;
+    job                 = nullptr;
+    jobReported         = true;
+    timeout             = 0;
+
     needToLoadScript    = true;
+    loaded              = false;
 
     loadScriptFlag      = false;
     saveScriptFlag      = false;
@@ -76,30 +80,16 @@ void BashScript::newObject(){
     this->addInlet(VP_LINK_STRING,"control");
 
     this->addOutlet(VP_LINK_STRING,"scriptSTDOutput");
+
+    this->setCustomVar(0.0f,"TIMEOUT");
 }
 
 //--------------------------------------------------------------
 void BashScript::autoloadFile(string _fp){
-    threadLoaded = false;
     filepath = copyFileToPatchFolder(this->patchFolderPath,_fp);
     reloadScript();
 }
 
-//--------------------------------------------------------------
-void BashScript::threadedFunction(){
-    while(isThreadRunning()){
-        std::unique_lock<std::mutex> lock(mutex);
-        if(needToLoadScript){
-            needToLoadScript = false;
-            loadScript(filepath);
-            threadLoaded = true;
-        }
-        condition.wait(lock);
-        sleep(10);
-    }
-
-}
-
 //--------------------------------------------------------------
 void BashScript::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     // GUI
@@ -115,10 +105,6 @@ void BashScript::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
         filepath = copyFileToPatchFolder(this->patchFolderPath,file.getAbsolutePath());
     }*/
 
-    if(!isThreadRunning()){
-        startThread();
-    }
-
 }
 
 //--------------------------------------------------------------
@@ -130,8 +116,11 @@ void BashScript::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
             lastMessage = *static_cast<string *>(_inletParams[0]);
         }
 
-        if(lastMessage == "bang"){
+        // a running script is not restarted, it runs again once finished
+        if(lastMessage == "bang" && (job == nullptr || job->isDone())){
             reloadScript();
+        }else if(lastMessage == "stop"){
+            stopScript();
         }
     }
 
@@ -140,7 +129,45 @@ void BashScript::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObje
         pathChanged(watcher.nextEvent());
     }
 
-    condition.notify_all();
+    if(!loaded){
+        loaded = true;
+        if(this->existsCustomVar("TIMEOUT")){
+            timeout = static_cast<int>(floor(this->getCustomVar("TIMEOUT")));
+        }
+    }
+
+    if(needToLoadScript){
+        needToLoadScript = false;
+        loadScript(filepath);
+    }
+
+    // streamed script stdout
+    if(job != nullptr){
+        string chunk = job->readOutput();
+        for(size_t i=0;i<chunk.size();i++){
+            static_cast<string *>(_outletParams[0])->push_back(chunk[i]);
+            if(chunk[i] == '\n'){
+                static_cast<string *>(_outletParams[0])->push_back(' ');
+            }
+        }
+        if(!jobReported && job->isDone()){
+            jobReported = true;
+            switch(job->getState()){
+                case PROCESS_JOB_FINISHED:
+                    ofLog(OF_LOG_NOTICE,"[verbose]bash script: %s EXECUTED! (exit status %i)",filepath.c_str(),job->getExitStatus());
+                    break;
+                case PROCESS_JOB_TIMEOUT:
+                    ofLog(OF_LOG_WARNING,"bash script: %s killed after %i seconds timeout",filepath.c_str(),timeout);
+                    break;
+                case PROCESS_JOB_CANCELLED:
+                    ofLog(OF_LOG_NOTICE,"[verbose]bash script: %s STOPPED!",filepath.c_str());
+                    break;
+                default:
+                    ofLog(OF_LOG_ERROR,"bash script: %s could not be executed",filepath.c_str());
+                    break;
+            }
+        }
+    }
 
 }
 
@@ -196,14 +223,12 @@ void BashScript::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
         ofFile newBashFile (fileDialog.selected_path);
         ofFile::copyFromTo(fileToRead.getAbsolutePath(),checkFileExtension(newBashFile.getAbsolutePath(), ofToUpper(newBashFile.getExtension()), "SH"),true,true);
         filepath = copyFileToPatchFolder(this->patchFolderPath,checkFileExtension(newBashFile.getAbsolutePath(), ofToUpper(newBashFile.getExtension()), "SH"));
-        threadLoaded = false;
         reloadScript();
     }*/
 
     if(ImGuiEx::getFileDialog(fileDialog, loadScriptFlag, "Select a bash script", imgui_addons::ImGuiFileBrowser::DialogMode::OPEN, ".sh", "", scaleFactor)){
         ofFile bashFile (fileDialog.selected_path);
         filepath = copyFileToPatchFolder(this->patchFolderPath,bashFile.getAbsolutePath());
-        threadLoaded = false;
         reloadScript();
     }
 
@@ -243,7 +268,6 @@ void BashScript::drawObjectNodeConfig(){
                 ofFile newBashFile (this->patchFolderPath+newScriptName);
                 ofFile::copyFromTo(fileToRead.getAbsolutePath(),checkFileExtension(newBashFile.getAbsolutePath(), ofToUpper(newBashFile.getExtension()), "SH"),true,true);
                 filepath = this->patchFolderPath+newScriptName;
-                threadLoaded = false;
                 reloadScript();
             }
             ImGui::CloseCurrentPopup();
@@ -260,7 +284,6 @@ void BashScript::drawObjectNodeConfig(){
                 ofFile newBashFile (this->patchFolderPath+newScriptName);
                 ofFile::copyFromTo(fileToRead.getAbsolutePath(),checkFileExtension(newBashFile.getAbsolutePath(), ofToUpper(newBashFile.getExtension()), "SH"),true,true);
                 filepath = this->patchFolderPath+newScriptName;
-                threadLoaded = false;
                 reloadScript();
             }
             ImGui::CloseCurrentPopup();
@@ -273,6 +296,39 @@ void BashScript::drawObjectNodeConfig(){
     if(ImGui::Button("Open",ImVec2(224*scaleFactor,26*scaleFactor))){
         loadScriptFlag = true;
     }
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Separator();
+    ImGui::Spacing();
+    if(ImGui::Button("Run",ImVec2(108*scaleFactor,26*scaleFactor))){
+        reloadScript();
+    }
+    ImGui::SameLine();
+    if(ImGui::Button("Stop",ImVec2(108*scaleFactor,26*scaleFactor))){
+        stopScript();
+    }
+    ImGui::Spacing();
+    if(ImGui::InputInt("Timeout (s)",&timeout)){
+        timeout = std::max(timeout,0);
+        this->setCustomVar(static_cast<float>(timeout),"TIMEOUT");
+    }
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("Kill the script if still running after this time, 0 = never");
+    ImGui::Spacing();
+    if(job == nullptr){
+        ImGui::Text("Status: idle");
+    }else if(job->getState() == PROCESS_JOB_QUEUED){
+        ImGui::Text("Status: queued");
+    }else if(job->getState() == PROCESS_JOB_RUNNING){
+        ImGui::Text("Status: running");
+    }else if(job->getState() == PROCESS_JOB_FINISHED){
+        ImGui::Text("Status: exit %i",job->getExitStatus());
+    }else if(job->getState() == PROCESS_JOB_TIMEOUT){
+        ImGui::Text("Status: timeout");
+    }else if(job->getState() == PROCESS_JOB_CANCELLED){
+        ImGui::Text("Status: stopped");
+    }else{
+        ImGui::Text("Status: failed");
+    }
 
 
     ImGuiEx::ObjectInfo(
@@ -283,16 +339,13 @@ void BashScript::drawObjectNodeConfig(){
     if(ImGuiEx::getFileDialog(fileDialog, loadScriptFlag, "Select a bash script", imgui_addons::ImGuiFileBrowser::DialogMode::OPEN, ".sh", "", scaleFactor)){
         ofFile bashFile (fileDialog.selected_path);
         filepath = copyFileToPatchFolder(this->patchFolderPath,bashFile.getAbsolutePath());
-        threadLoaded = false;
         reloadScript();
     }
 }
 
 //--------------------------------------------------------------
 void BashScript::removeObjectContent(bool removeFileFromData){
-    std::unique_lock<std::mutex> lck(mutex);
-    stopThread();
-    condition.notify_all();
+    stopScript();
 }
 
 
@@ -305,43 +358,33 @@ void BashScript::loadScript(string scriptFile){
         filepath = forceCheckMosaicDataPath(scriptFile);
         currentScriptFile.open(filepath);
 
-        string cmd = "";
-        FILE *execFile;
-
-        cmd = "sh "+filepath;
-        execFile = popen(cmd.c_str(), "r");
-
-        if (execFile){
-            scriptLoaded = true;
-            watcher.removeAllPaths();
-            watcher.addPath(filepath);
-
-            ofLog(OF_LOG_NOTICE,"[verbose] bash script: %s RUNNING!",filepath.c_str());
-            ofLog(OF_LOG_NOTICE," ");
-
-            char buffer[128];
-            _outletParams[0] = new string();
-            *static_cast<string *>(_outletParams[0]) = "";
-            while(!feof(execFile)){
-                if(fgets(buffer, sizeof(buffer), execFile) != nullptr){
-                    char *s = buffer;
-                    std::string tempstr(s);
-                    static_cast<string *>(_outletParams[0])->append(tempstr);
-                    static_cast<string *>(_outletParams[0])->append(" ");
-                }
-            }
-            //ofLog(OF_LOG_NOTICE,"%s",static_cast<string *>(_outletParams[0])->c_str());
-            ofLog(OF_LOG_NOTICE,"[verbose]bash script: %s EXECUTED!",filepath.c_str());
+        // restart it if still running
+        stopScript();
 
-            this->saveConfig(false);
+        watcher.removeAllPaths();
+        watcher.addPath(filepath);
 
-            pclose(execFile);
+        static_cast<string *>(_outletParams[0])->clear();
 
-        }
+        job = ProcessRunner::instance().run({"sh",filepath},static_cast<unsigned int>(std::max(timeout,0))*1000);
+        jobReported = false;
+        scriptLoaded = true;
+
+        ofLog(OF_LOG_NOTICE,"[verbose] bash script: %s RUNNING!",filepath.c_str());
+        ofLog(OF_LOG_NOTICE," ");
+
+        this->saveConfig(false);
     }
 
 }
 
+//--------------------------------------------------------------
+void BashScript::stopScript(){
+    if(job != nullptr && !job->isDone()){
+        job->cancel();
+    }
+}
+
 //--------------------------------------------------------------
 void BashScript::reloadScript(){
     scriptLoaded = false;
@@ -30,26 +30,25 @@
 
 ==============================================================================*/
 
-#ifndef OFXVP_BUILD_WITH_MINIMAL_OBJECTS
+#if defined(TARGET_WIN32)
+    // Unavailable on windows.
+#elif !defined(OFXVP_BUILD_WITH_MINIMAL_OBJECTS)
 
 #pragma once
 
 #include "PatchObject.h"
 #include "PathWatcher.h"
+#include "ProcessRunner.h"
 
 #include "ImGuiFileBrowser.h"
 #include "IconsFontAwesome5.h"
 
-#include <atomic>
-
-class BashScript : public ofThread, public PatchObject{
+class BashScript : public PatchObject{
 
 public:
 
     BashScript();
 
-    void            threadedFunction() override;
-
     void            autoloadFile(string _fp) override;
     void            newObject() override;
     void            setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow) override;
@@ -62,6 +61,7 @@ public:
 
     void            loadScript(string scriptFile);
     void            reloadScript();
+    void            stopScript();
 
     // Filepath watcher callback
     void            pathChanged(const PathWatcher::Event &event);
@@ -74,6 +74,10 @@ public:
 
     string              lastMessage;
 
+    shared_ptr<ProcessJob>  job;
+    bool                    jobReported;
+    int                     timeout;        // seconds, 0 = none
+
     imgui_addons::ImGuiFileBrowser          fileDialog;
     string                                  newScriptName;
 
@@ -85,9 +89,8 @@ public:
     float               canvasZoom;
 
 protected:
-    std::condition_variable condition;
     bool                    needToLoadScript;
-    bool                    threadLoaded;
+    bool                    loaded;
     bool                    loadScriptFlag;
     bool                    saveScriptFlag;
 
@@ -40,23 +40,27 @@ LuaScript::LuaScript() : PatchObject("lua script"){
     this->numInlets  = 2;
     this->numOutlets = 3;
 
-    _inletParams[0] = new vector<float>();      // data
+    this->newInletBuffer<vector<float>>(0);      // data
 
-    _inletParams[1] = new string();             // string
+    this->newInletBuffer<string>(1);             // string
     *static_cast<string *>(_inletParams[1]) = "";
 
-    _outletParams[0] = new ofTexture();         // output
-    _outletParams[1] = new LiveCoding();        // lua script reference (for keyboard and mouse events on external windows)
-    _outletParams[2] = new vector<float>();     // outlet vector from lua
+    this->newOutletBuffer<ofTexture>(0);         // output
+    this->newOutletBuffer<LiveCoding>(1);        // lua script reference (for keyboard and mouse events on external windows)
+    this->newOutletBuffer<vector<float>>(2);     // outlet vector from lua
 
     this->specialLinkTypeName = "LiveCoding";
 
     this->initInletsState();
 
+    // a running script or the live editor change the output on every frame
+    this->setTracksOutletChanges(true);
+
     scriptLoaded        = false;
+    drawnScriptRunning  = false;
     isNewObject         = false;
 
-    fbo = new ofFbo();
+    fbo = nullptr;
 
     kuro = new ofImage();
 
@@ -193,44 +197,55 @@ void LuaScript::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRende
     // LUA UPDATE
     if(scriptLoaded && !isError){
 
-        // receive external data
+        lua_State *L = static_cast<LiveCoding *>(_outletParams[1])->lua;
+
+        // receive external data, written straight into the lua table
         if(this->inletsConnected[0]){
-            for(int i=0;i<static_cast<int>(static_cast<vector<float> *>(_inletParams[0])->size());i++){
-                lua_getglobal(static_cast<LiveCoding *>(_outletParams[1])->lua, "_updateMosaicData");
-                lua_pushnumber(static_cast<LiveCoding *>(_outletParams[1])->lua,i+1);
-                lua_pushnumber(static_cast<LiveCoding *>(_outletParams[1])->lua,static_cast<vector<float> *>(_inletParams[0])->at(i));
-                lua_pcall(static_cast<LiveCoding *>(_outletParams[1])->lua,2,0,0);
+            const vector<float> *data = static_cast<vector<float> *>(_inletParams[0]);
+            int n = static_cast<int>(data->size());
+            lua_getglobal(L, mosaicTableName.c_str());
+            if(!lua_istable(L,-1)){
+                lua_pop(L,1);
+                lua_createtable(L,n,0);
+                lua_pushvalue(L,-1);
+                lua_setglobal(L, mosaicTableName.c_str());
             }
-            static_cast<LiveCoding *>(_outletParams[1])->lua.doString("USING_DATA_INLET = true");
-        }else{
-            static_cast<LiveCoding *>(_outletParams[1])->lua.doString("USING_DATA_INLET = false");
+            for(int i=0;i<n;i++){
+                lua_pushnumber(L,static_cast<lua_Number>(data->at(i)));
+                lua_rawseti(L,-2,i+1);
+            }
+            // drop stale values from a previously longer vector
+            for(int i=static_cast<int>(lua_rawlen(L,-1));i>n;i--){
+                lua_pushnil(L);
+                lua_rawseti(L,-2,i);
+            }
+            lua_pop(L,1);
         }
-
+        lua_pushboolean(L,this->inletsConnected[0]);
+        lua_setglobal(L,"USING_DATA_INLET");
 
         if(this->inletsConnected[1]){
-            string temp = mosaicStringName+" = '";
-            temp.append(*static_cast<string *>(_inletParams[1]));
-            temp.append("'");
-            static_cast<LiveCoding *>(_outletParams[1])->lua.doString(temp);
+            lua_pushstring(L,static_cast<string *>(_inletParams[1])->c_str());
         }else{
-            string temp = mosaicStringName+" = ''";
-            static_cast<LiveCoding *>(_outletParams[1])->lua.doString(temp);
+            lua_pushstring(L,"");
         }
-
-        // send internal data
-        size_t len = static_cast<LiveCoding *>(_outletParams[1])->lua.tableSize(luaTablename);
-        if(len > 0){
-            static_cast<vector<float> *>(_outletParams[2])->clear();
-            for(size_t s=0;s<len;s++){
-                lua_getglobal(static_cast<LiveCoding *>(_outletParams[1])->lua, "_getLUAOutletTableAt");
-                lua_pushnumber(static_cast<LiveCoding *>(_outletParams[1])->lua,s+1);
-                lua_pcall(static_cast<LiveCoding *>(_outletParams[1])->lua,1,1,0);
-                lua_Number tn = lua_tonumber(static_cast<LiveCoding *>(_outletParams[1])->lua, -2);
-                static_cast<vector<float> *>(_outletParams[2])->push_back(static_cast<float>(tn));
+        lua_setglobal(L, mosaicStringName.c_str());
+
+        // send internal data, read straight from the lua table
+        lua_getglobal(L, luaTablename.c_str());
+        if(lua_istable(L,-1)){
+            size_t len = lua_rawlen(L,-1);
+            if(len > 0){
+                vector<float> *out = static_cast<vector<float> *>(_outletParams[2]);
+                out->resize(len);
+                for(size_t s=0;s<len;s++){
+                    lua_rawgeti(L,-1,static_cast<lua_Integer>(s+1));
+                    out->at(s) = static_cast<float>(lua_tonumber(L,-1));
+                    lua_pop(L,1);
+                }
             }
-            std::rotate(static_cast<vector<float> *>(_outletParams[2])->begin(),static_cast<vector<float> *>(_outletParams[2])->begin()+1,static_cast<vector<float> *>(_outletParams[2])->end());
         }
-
+        lua_pop(L,1);
 
         // update lua state
         ofSoundUpdate();
@@ -264,6 +279,12 @@ void LuaScript::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRende
     fbo->end();
 
     *static_cast<ofTexture *>(_outletParams[0]) = fbo->getTexture();
+
+    bool running = scriptLoaded && !isError;
+    if(this->inputsChanged() || running || running != drawnScriptRunning || !static_cast<LiveCoding *>(_outletParams[1])->hide){
+        this->markOutletChanged(0);
+    }
+    drawnScriptRunning = running;
     ///////////////////////////////////////////
 
     ofSetColor(255);
@@ -433,6 +454,9 @@ void LuaScript::removeObjectContent(bool removeFileFromData){
     // LUA EXIT
     static_cast<LiveCoding *>(_outletParams[1])->lua.scriptExit();
     ///////////////////////////////////////////
+
+    ofxVPFboPool::get().release(fbo);
+    fbo = nullptr;
 }
 
 //--------------------------------------------------------------
@@ -440,8 +464,8 @@ void LuaScript::initResolution(){
     output_width = static_cast<int>(floor(this->getCustomVar("OUTPUT_WIDTH")));
     output_height = static_cast<int>(floor(this->getCustomVar("OUTPUT_HEIGHT")));
 
-    fbo = new ofFbo();
-    fbo->allocate(output_width,output_height,GL_RGBA32F_ARB,4);
+    ofxVPFboPool::get().release(fbo);
+    fbo = ofxVPFboPool::get().acquire(output_width,output_height,GL_RGBA32F_ARB,4,this->getId());
     fbo->begin();
     ofClear(0,0,0,255);
     fbo->end();
@@ -452,7 +476,7 @@ void LuaScript::initResolution(){
     texData.textureTarget = GL_TEXTURE_2D;
     texData.bFlipTexture = true;
 
-    _outletParams[0] = new ofTexture();
+    this->newOutletBuffer<ofTexture>(0);
     static_cast<ofTexture *>(_outletParams[0])->allocate(texData);
 
     static_cast<LiveCoding *>(_outletParams[1])->liveEditor.resize(output_width,output_height);
@@ -479,8 +503,8 @@ void LuaScript::resetResolution(int fromID, int newWidth, int newHeight){
         this->setCustomVar(static_cast<float>(output_height),"OUTPUT_HEIGHT");
         this->saveConfig(false);
 
-        fbo = new ofFbo();
-        fbo->allocate(output_width,output_height,GL_RGBA32F_ARB,4);
+        ofxVPFboPool::get().release(fbo);
+        fbo = ofxVPFboPool::get().acquire(output_width,output_height,GL_RGBA32F_ARB,4,this->getId());
         fbo->begin();
         ofClear(0,0,0,255);
         fbo->end();
@@ -491,7 +515,7 @@ void LuaScript::resetResolution(int fromID, int newWidth, int newHeight){
         texData.textureTarget = GL_TEXTURE_2D;
         texData.bFlipTexture = true;
 
-        _outletParams[0] = new ofTexture();
+        this->newOutletBuffer<ofTexture>(0);
         static_cast<ofTexture *>(_outletParams[0])->allocate(texData);
 
         static_cast<LiveCoding *>(_outletParams[1])->liveEditor.resize(output_width,output_height);
@@ -90,6 +90,7 @@ public:
     PathWatcher         watcher;
     ofFile              currentScriptFile;
     bool                scriptLoaded;
+    bool                drawnScriptRunning;
     bool                isNewObject;
     bool                isError;
     bool                setupTrigger;
@@ -34,18 +34,59 @@
     // Unavailable on windows.
 #elif !defined(OFXVP_BUILD_WITH_MINIMAL_OBJECTS)
 
+#include <Python.h>
 
 #include "PythonScript.h"
 
+//--------------------------------------------------------------
+// The interpreter is shared by every python script object, so it is guarded
+// by the GIL. As long as no object runs in async mode the main thread simply
+// keeps the GIL, as before; with async objects around it hands the GIL over
+// outside of its own python sections, so the object threads can run.
+static PyThreadState    *mainThreadState    = nullptr;  // saved while the main thread doesn't hold the GIL
+static int              mainThreadGILDepth  = 0;
+static int              asyncScriptsCount   = 0;
+
+static void acquireMainThreadGIL(){
+    if(mainThreadState != nullptr){
+        PyEval_RestoreThread(mainThreadState);
+        mainThreadState = nullptr;
+    }
+}
+
+static void releaseMainThreadGIL(){
+    if(asyncScriptsCount > 0 && mainThreadGILDepth == 0 && mainThreadState == nullptr && Py_IsInitialized()){
+        mainThreadState = PyEval_SaveThread();
+    }
+}
+
+// scoped main thread python section on one object: locks the object mutex
+// (its thread could be running the script), then takes the GIL
+struct MainThreadGIL {
+    MainThreadGIL(std::mutex &objectMutex){
+        // never wait for an object thread while holding the GIL it needs
+        releaseMainThreadGIL();
+        lck = std::unique_lock<std::mutex>(objectMutex);
+        if(mainThreadGILDepth++ == 0){
+            acquireMainThreadGIL();
+        }
+    }
+    ~MainThreadGIL(){
+        mainThreadGILDepth--;
+        releaseMainThreadGIL();
+    }
+    std::unique_lock<std::mutex> lck;
+};
+
 //--------------------------------------------------------------
 PythonScript::PythonScript() : PatchObject("python script"){
 
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();      // data input
+    this->newInletBuffer<vector<float>>(0);      // data input
 
-    _outletParams[0] = new vector<float>();         // data output
+    this->newOutletBuffer<vector<float>>(0);         // data output
 
     this->initInletsState();
 
@@ -63,10 +104,29 @@ PythonScript::PythonScript() : PatchObject("python script"){
     loadPythonScriptFlag   = false;
     savePythonScriptFlag   = false;
 
+    loaded              = false;
+
+    snapshotConnected   = false;
+    newOutlet           = false;
+    useAsync            = false;
+    tickRate            = PYTHON_SCRIPT_DEFAULT_TICK_RATE;
+
+    asyncTicks          = 0;
+    asyncOverruns       = 0;
+    lastTickTime        = 0.0f;
+    avgTickTime         = 0.0f;
+
     this->setIsTextureObj(true);
 
 }
 
+//--------------------------------------------------------------
+PythonScript::~PythonScript(){
+    stopAsync();
+    // the python members are released right after, with the GIL held
+    acquireMainThreadGIL();
+}
+
 //--------------------------------------------------------------
 void PythonScript::newObject(){
     PatchObject::setName( this->objectName );
@@ -74,6 +134,98 @@ void PythonScript::newObject(){
     this->addInlet(VP_LINK_ARRAY,"_mosaic_data_inlet");
 
     this->addOutlet(VP_LINK_ARRAY,"_mosaic_data_outlet");
+
+    this->setCustomVar(0.0f,"ASYNC_MODE");
+    this->setCustomVar(static_cast<float>(PYTHON_SCRIPT_DEFAULT_TICK_RATE),"TICK_RATE");
+}
+
+//--------------------------------------------------------------
+void PythonScript::threadedFunction(){
+    std::chrono::steady_clock::time_point nextTick = std::chrono::steady_clock::now();
+
+    while(isThreadRunning()){
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        {
+            bool connected;
+            {
+                std::lock_guard<std::mutex> blck(bufferMutex);
+                inletWork = inletSnapshot;
+                connected = snapshotConnected;
+            }
+
+            std::unique_lock<std::mutex> lck(mutex);
+            PyGILState_STATE gstate = PyGILState_Ensure();
+            if(script){
+                runPythonUpdate(inletWork,connected,outletBack);
+            }
+            PyGILState_Release(gstate);
+        }
+
+        float elapsed = std::chrono::duration<float,std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::unique_lock<std::mutex> blck(bufferMutex);
+        std::swap(outletBack,outletFront);
+        newOutlet = true;
+
+        // timing statistics
+        asyncTicks++;
+        lastTickTime = elapsed;
+        avgTickTime = avgTickTime + (elapsed - avgTickTime)*0.05f;
+
+        nextTick += std::chrono::microseconds(1000000/std::max(tickRate.load(),1));
+        if(nextTick < std::chrono::steady_clock::now()){
+            // the script took longer than a tick, skip the missed ones
+            asyncOverruns++;
+            nextTick = std::chrono::steady_clock::now();
+            continue;
+        }
+        asyncCondition.wait_until(blck,nextTick,[this]{ return !isThreadRunning(); });
+    }
+}
+
+//--------------------------------------------------------------
+void PythonScript::startAsync(){
+    if(isThreadRunning()){
+        return;
+    }
+
+    asyncTicks      = 0;
+    asyncOverruns   = 0;
+    lastTickTime    = 0.0f;
+    avgTickTime     = 0.0f;
+
+    #if PY_MAJOR_VERSION < 3 || (PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION < 7)
+    {
+        MainThreadGIL gil(mutex);
+        PyEval_InitThreads();
+    }
+    #endif
+
+    asyncScriptsCount++;
+    startThread();
+    releaseMainThreadGIL();
+}
+
+//--------------------------------------------------------------
+void PythonScript::stopAsync(){
+    if(!isThreadRunning()){
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> blck(bufferMutex);
+        stopThread();
+        asyncCondition.notify_all();
+    }
+    // the thread could be waiting for the GIL
+    releaseMainThreadGIL();
+    waitForThread(false);
+
+    asyncScriptsCount--;
+    if(asyncScriptsCount == 0){
+        acquireMainThreadGIL();
+    }
 }
 
 //--------------------------------------------------------------
@@ -90,7 +242,10 @@ void PythonScript::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     pythonIcon->load("images/python.png");
 
     // init python
-    python.init();
+    {
+        MainThreadGIL gil(mutex);
+        python.init();
+    }
     watcher.start();
 
     /*if(filepath == "none"){
@@ -113,6 +268,19 @@ void PythonScript::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
         loadScript(filepath);
     }
 
+    if(!loaded){
+        loaded = true;
+        if(this->existsCustomVar("TICK_RATE")){
+            tickRate = static_cast<int>(ofClamp(floor(this->getCustomVar("TICK_RATE")),1,PYTHON_SCRIPT_MAX_TICK_RATE));
+        }
+        if(this->existsCustomVar("ASYNC_MODE")){
+            useAsync = static_cast<int>(floor(this->getCustomVar("ASYNC_MODE"))) == 1;
+        }
+        if(useAsync){
+            startAsync();
+        }
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -120,29 +288,22 @@ void PythonScript::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRe
 
     ///////////////////////////////////////////
     // PYTHON UPDATE
-    if(script){
-        updatePython = script.attr("update");
-        if(updatePython && !script.isPythonError() && !updatePython.isPythonError()){
-            updateMosaicList = python.getObject("_updateMosaicData");
-            if(this->inletsConnected[0] && updateMosaicList && !updateMosaicList.isPythonError()){
-                for(int i=0;i<static_cast<int>(static_cast<vector<float> *>(_inletParams[0])->size());i++){
-                    updateMosaicList(ofxPythonObject::fromInt(static_cast<int>(i)),ofxPythonObject::fromFloat(static_cast<double>(static_cast<vector<float> *>(_inletParams[0])->at(i))));
-                }
-            }else{
-                for(int i=0;i<1000;i++){
-                    updateMosaicList(ofxPythonObject::fromInt(static_cast<int>(i)),ofxPythonObject::fromFloat(static_cast<double>(0.0)));
-                }
-            }
-            updatePythonList = python.getObject("_getPYOutletTableAt");
-            getPythonListSize = python.getObject("_getPYOutletSize");
-            if(updatePythonList && !updatePythonList.isPythonError() && getPythonListSize && !getPythonListSize.isPythonError()){
-                static_cast<vector<float> *>(_outletParams[0])->clear();
-                for(int i=0;i<static_cast<int>(getPythonListSize(ofxPythonObject::fromInt(static_cast<int>(0))).asInt());i++){
-                    static_cast<vector<float> *>(_outletParams[0])->push_back(updatePythonList(ofxPythonObject::fromInt(static_cast<int>(i))).asFloat());
-                }
-            }
-
-            updatePython();
+    if(useAsync){
+        // hand the latest inlet to the object thread, get its latest result
+        std::lock_guard<std::mutex> blck(bufferMutex);
+        snapshotConnected = this->inletsConnected[0];
+        if(snapshotConnected){
+            inletSnapshot = *static_cast<vector<float> *>(_inletParams[0]);
+        }
+        if(newOutlet){
+            newOutlet = false;
+            std::swap(outletFront,*static_cast<vector<float> *>(_outletParams[0]));
+        }
+        releaseMainThreadGIL();
+    }else{
+        MainThreadGIL gil(mutex);
+        if(script){
+            runPythonUpdate(*static_cast<vector<float> *>(_inletParams[0]),this->inletsConnected[0],*static_cast<vector<float> *>(_outletParams[0]));
         }
     }
     ///////////////////////////////////////////
@@ -155,6 +316,33 @@ void PythonScript::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRe
 
 }
 
+//--------------------------------------------------------------
+void PythonScript::runPythonUpdate(const vector<float> &inlet, bool inletConnected, vector<float> &outlet){
+    updatePython = script.attr("update");
+    if(updatePython && !script.isPythonError() && !updatePython.isPythonError()){
+        // bulk transfer: the python helpers wrap the vector memory in a ctypes
+        // float array (buffer protocol) and copy it in a single call
+        updateMosaicList = python.getObject("_updateMosaicData");
+        if(updateMosaicList && !updateMosaicList.isPythonError()){
+            if(inletConnected && !inlet.empty()){
+                updateMosaicList(ofxPythonObject::fromString(ofToString(reinterpret_cast<uintptr_t>(inlet.data()))),ofxPythonObject::fromInt(static_cast<long>(inlet.size())));
+            }else{
+                updateMosaicList(ofxPythonObject::fromString("0"),ofxPythonObject::fromInt(0));
+            }
+        }
+        getPythonListSize = python.getObject("_getPYOutletSize");
+        updatePythonList = python.getObject("_getPYOutletData");
+        if(updatePythonList && !updatePythonList.isPythonError() && getPythonListSize && !getPythonListSize.isPythonError()){
+            outlet.resize(static_cast<size_t>(getPythonListSize(ofxPythonObject::fromInt(0)).asInt()));
+            if(!outlet.empty()){
+                updatePythonList(ofxPythonObject::fromString(ofToString(reinterpret_cast<uintptr_t>(outlet.data()))),ofxPythonObject::fromInt(static_cast<long>(outlet.size())));
+            }
+        }
+
+        updatePython();
+    }
+}
+
 //--------------------------------------------------------------
 void PythonScript::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
     loadPythonScriptFlag = false;
@@ -185,6 +373,11 @@ void PythonScript::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
         scaledObjW = this->width - (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*this->scaleFactor/_nodeCanvas.GetCanvasScale());
         scaledObjH = this->height - ((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*this->scaleFactor/_nodeCanvas.GetCanvasScale());
 
+        // async timing
+        if(useAsync){
+            ImGui::Text("%i Hz  %.1f ms  overruns %llu",tickRate.load(),avgTickTime.load(),static_cast<unsigned long long>(asyncOverruns.load()));
+        }
+
         _nodeCanvas.EndNodeContent();
     }
 
@@ -286,6 +479,29 @@ void PythonScript::drawObjectNodeConfig(){
     if(ImGui::Button("Reload Script",ImVec2(224*scaleFactor,26*scaleFactor))){
         reloadScript();
     }
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Separator();
+    ImGui::Spacing();
+    if(ImGui::Checkbox("Async execution",&useAsync)){
+        this->setCustomVar(static_cast<float>(useAsync),"ASYNC_MODE");
+        if(useAsync){
+            startAsync();
+        }else{
+            stopAsync();
+        }
+    }
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("Run the script update() on its own thread, the outlet always sends the latest result");
+    int tempTickRate = tickRate;
+    if(ImGui::SliderInt("Tick rate",&tempTickRate,1,PYTHON_SCRIPT_MAX_TICK_RATE,"%d Hz")){
+        tickRate = tempTickRate;
+        this->setCustomVar(static_cast<float>(tickRate),"TICK_RATE");
+    }
+    if(useAsync){
+        ImGui::Spacing();
+        ImGui::Text("ticks: %llu  overruns: %llu",static_cast<unsigned long long>(asyncTicks.load()),static_cast<unsigned long long>(asyncOverruns.load()));
+        ImGui::Text("last: %.2f ms  avg: %.2f ms",lastTickTime.load(),avgTickTime.load());
+    }
 
 
     ImGuiEx::ObjectInfo(
@@ -304,6 +520,9 @@ void PythonScript::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void PythonScript::removeObjectContent(bool removeFileFromData){
+    stopAsync();
+
+    MainThreadGIL gil(mutex);
     script = ofxPythonObject::_None();
 }
 
@@ -313,6 +532,8 @@ void PythonScript::loadScript(string scriptFile){
     filepath = forceCheckMosaicDataPath(scriptFile);
     currentScriptFile.open(filepath);
 
+    MainThreadGIL gil(mutex);
+
     python.reset();
     python.addPath(currentScriptFile.getEnclosingDirectory());
     python.executeScript(filepath);
@@ -321,7 +542,9 @@ void PythonScript::loadScript(string scriptFile){
     string tempstring = mosaicTableName+" = [];\n"+mosaicTableName+".append(0)";
     python.executeString(tempstring);
     // tabs and newlines are really important in python!
-    tempstring = "def _updateMosaicData( i,data ):\n\t if len("+mosaicTableName+") < i:\n\t\t "+mosaicTableName+".append(0)\n\t elif 0 <= i < len("+mosaicTableName+"):\n\t\t "+mosaicTableName+"[i] = data\n";
+    // the vector memory is only valid during the call, so its values are copied
+    // into the list at once; disconnected inlet: 1000 zeros, as before
+    tempstring = "import ctypes\ndef _updateMosaicData( addr,size ):\n\t if size > 0:\n\t\t "+mosaicTableName+"[:] = (ctypes.c_float * size).from_address(int(addr))\n\t else:\n\t\t "+mosaicTableName+"[:] = [0.0] * 1000\n";
     python.executeString(tempstring);
 
     // inject outgoing data list to mosaic as vector<float>
@@ -331,6 +554,8 @@ void PythonScript::loadScript(string scriptFile){
     python.executeString(tempstring);
     tempstring = "def _getPYOutletSize( i ):\n\t return len("+pythonTableName+")\n";
     python.executeString(tempstring);
+    tempstring = "def _getPYOutletData( addr,size ):\n\t (ctypes.c_float * size).from_address(int(addr))[:] = "+pythonTableName+"[:size]\n";
+    python.executeString(tempstring);
 
     // set Mosaic scripting vars
     ofFile tempFileScript(filepath);
@@ -363,13 +588,17 @@ void PythonScript::loadScript(string scriptFile){
 
 //--------------------------------------------------------------
 void PythonScript::clearScript(){
+    MainThreadGIL gil(mutex);
     python.reset();
     script = ofxPythonObject::_None();
 }
 
 //--------------------------------------------------------------
 void PythonScript::reloadScript(){
-    script = ofxPythonObject::_None();
+    {
+        MainThreadGIL gil(mutex);
+        script = ofxPythonObject::_None();
+    }
     needToLoadScript = true;
 }
 
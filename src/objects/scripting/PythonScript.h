@@ -44,12 +44,20 @@
 #include "ImGuiFileBrowser.h"
 #include "IconsFontAwesome5.h"
 
+#include <atomic>
 
-class PythonScript : public PatchObject {
+#define PYTHON_SCRIPT_DEFAULT_TICK_RATE 30
+#define PYTHON_SCRIPT_MAX_TICK_RATE     240
+
+
+class PythonScript : public ofThread, public PatchObject {
 
 public:
 
     PythonScript();
+    ~PythonScript();
+
+    void            threadedFunction() override;
 
     void            autoloadFile(string _fp) override;
     void            newObject() override;
@@ -65,6 +73,14 @@ public:
     void            clearScript();
     void            reloadScript();
 
+    // run mosaicApp.update() exchanging data with the given vectors,
+    // called with the object mutex and the GIL held
+    void            runPythonUpdate(const vector<float> &inlet, bool inletConnected, vector<float> &outlet);
+
+    // async mode: the script runs on the object thread at tickRate
+    void            startAsync();
+    void            stopAsync();
+
     // Filepath watcher callback
     void            pathChanged(const PathWatcher::Event &event);
 
@@ -98,10 +114,29 @@ public:
     bool                loadPythonScriptFlag;
     bool                savePythonScriptFlag;
 
+    // async mode, inlet snapshot and outlet double buffer (bufferMutex)
+    std::mutex              bufferMutex;
+    std::condition_variable asyncCondition;
+    vector<float>           inletSnapshot;
+    vector<float>           inletWork;
+    vector<float>           outletBack;
+    vector<float>           outletFront;
+    bool                    snapshotConnected;
+    bool                    newOutlet;
+    bool                    useAsync;
+    std::atomic<int>        tickRate;
+
+    // async timing statistics
+    std::atomic<uint64_t>   asyncTicks;
+    std::atomic<uint64_t>   asyncOverruns;
+    std::atomic<float>      lastTickTime;
+    std::atomic<float>      avgTickTime;
+
 
 protected:
 
     bool                    needToLoadScript;
+    bool                    loaded;
 
 private:
 
@@ -40,16 +40,17 @@ ShaderObject::ShaderObject() : PatchObject("glsl shader"){
     this->numInlets  = 0;
     this->numOutlets = 1;
 
-    _outletParams[0] = new ofTexture();     // output
+    this->newOutletBuffer<ofTexture>(0);     // output
 
     scriptLoaded        = false;
+    drawnScriptLoaded   = false;
     isNewObject         = false;
     reloading           = false;
 
     isGUIObject         = true;
     this->isOverGUI     = true;
 
-    fbo                 = new ofFbo();
+    fbo                 = nullptr;
     pingPong            = new ofxPingPong();
     shader              = new ofShader();
     needReset           = false;
@@ -63,6 +64,16 @@ ShaderObject::ShaderObject() : PatchObject("glsl shader"){
 
     nTextures       = 0;
     internalFormat  = GL_RGBA;
+    directTextures  = 0;
+
+    program             = 0;
+    compileTicket       = 0;
+    compileInfo         = "";
+
+    uniformsCached      = false;
+    backbufferLocation  = -1;
+    resolutionLocation  = -1;
+    timeLocation        = -1;
 
     fragmentShader  = "";
     vertexShader    = "";
@@ -80,6 +91,10 @@ ShaderObject::ShaderObject() : PatchObject("glsl shader"){
     this->setIsResizable(true);
     this->setIsTextureObj(true);
 
+    // animated (time) and feedback (backbuffer) shaders change the output on every frame, the
+    // others only with their inputs, their parameters or a new program
+    this->setTracksOutletChanges(true);
+
     prevW                   = this->width;
     prevH                   = this->height;
 
@@ -125,6 +140,24 @@ void ShaderObject::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 //--------------------------------------------------------------
 void ShaderObject::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
 
+    // background build done: swap the new program in
+    ofxVPShaderResult result;
+    if(compileTicket != 0 && ofxVPShaderCache::get().poll(compileTicket,result)){
+        compileTicket = 0;
+        if(result.program != 0){
+            ofxVPShaderCache::get().deleteProgram(program);
+            program         = result.program;
+            uniformsCached  = false;
+            scriptLoaded    = true;
+            compileInfo     = (result.fromCache ? "linked from cache in " : "compiled in ")+ofToString(result.ms,1)+" ms";
+            ofLog(OF_LOG_NOTICE,"[verbose] SHADER: %s [%ix%i] loaded on GPU!",filepath.c_str(),output_width,output_height);
+        }else{
+            compileInfo     = "compile error, previous program kept";
+            ofLog(OF_LOG_ERROR,"SHADER: %s %s",filepath.c_str(),result.log.c_str());
+        }
+        this->setIsReady(true);
+    }
+
     // Recursive reset for shader objects chain
     if(needReset){
         needReset = false;
@@ -223,47 +256,85 @@ void ShaderObject::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
 //--------------------------------------------------------------
 void ShaderObject::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
 
+    bool changed = this->inputsChanged() || scriptLoaded != drawnScriptLoaded;
+    drawnScriptLoaded = scriptLoaded;
+
     ///////////////////////////////////////////
     // SHADER UPDATE
     if(scriptLoaded){
-        // receive external data
-        for(int i=0;i<this->numInlets;i++){
-            if(this->inletsConnected[i] && this->getInletType(i) == VP_LINK_TEXTURE && i < static_cast<int>(textures.size()) && static_cast<ofTexture *>(_inletParams[i])->isAllocated()){
-                textures[i]->begin();
+        // receive external data: the upstream texture itself when the shader can sample it as is,
+        // a copy into a scratch target (shared with every other object of the same size) otherwise
+        textures.assign(nTextures,nullptr);
+        boundTextures.assign(nTextures,nullptr);
+        directTextures = 0;
+        for(int i=0;i<nTextures;i++){
+            ofTexture *in = nullptr;
+            if(i < this->numInlets && this->inletsConnected[i] && this->getInletType(i) == VP_LINK_TEXTURE && static_cast<ofTexture *>(_inletParams[i])->isAllocated()){
+                in = static_cast<ofTexture *>(_inletParams[i]);
+            }
+            if(in != nullptr && canBindDirectly(*in)){
+                boundTextures[i] = in;
+                directTextures++;
+                continue;
+            }
+            textures[i] = ofxVPFboPool::get().acquireTransient(output_width,output_height,internalFormat);
+            textures[i]->begin();
+            ofClear(0,0,0,255);
+            if(in != nullptr){
+                // a plain copy, translucent texels are not composited over the black clear
+                ofPushStyle();
+                ofDisableBlendMode();
                 ofSetColor(255);
-                static_cast<ofTexture *>(_inletParams[i])->draw(0,0,output_width, output_height);
-                textures[i]->end();
+                in->draw(0,0,output_width, output_height);
+                ofPopStyle();
             }
+            textures[i]->end();
+            boundTextures[i] = &textures[i]->getTexture();
         }
         pingPong->dst->begin();
 
         ofClear(0);
-        shader->begin();
-        shader->setUniformTexture("backbuffer", pingPong->src->getTexture(),0);
-        for(int i=0;i<static_cast<int>(textures.size());i++){
-            string texName = "tex" + ofToString(i);
-            shader->setUniformTexture(texName.c_str(),textures[i]->getTexture(),i+1);
+        beginShader();
+        if(!uniformsCached){
+            cacheUniformLocations();
+            changed = true;
+        }
+        if(timeLocation != -1 || backbufferLocation != -1){
+            changed = true;
+        }
+
+        pingPong->src->getTexture().bind(0);
+        if(backbufferLocation != -1){
+            glUniform1i(backbufferLocation,0);
+        }
+        for(int i=0;i<nTextures;i++){
+            boundTextures[i]->bind(i+1);
+            if(i < static_cast<int>(textureLocations.size()) && textureLocations[i] != -1){
+                glUniform1i(textureLocations[i],i+1);
+            }
+        }
+        if(resolutionLocation != -1){
+            glUniform2f(resolutionLocation,static_cast<float>(output_width),static_cast<float>(output_height));
+        }
+        if(timeLocation != -1){
+            glUniform1f(timeLocation,static_cast<float>(ofGetElapsedTimef()));
         }
-        shader->setUniform2f("resolution",static_cast<float>(output_width),static_cast<float>(output_height));
-        shader->setUniform1f("time",static_cast<float>(ofGetElapsedTimef()));
 
         for(int i=0;i<this->numInlets;i++){
             if(this->inletsConnected[i] && this->getInletType(i) == VP_LINK_NUMERIC){
-                shaderSliders.at(i-static_cast<int>(textures.size())) = *(float *)&_inletParams[i];
+                shaderSliders.at(i-nTextures) = *(float *)&_inletParams[i];
             }
         }
 
         // set custom shader vars
-        string paramName, tempVarName;
-        for(size_t i=0;i<shaderSliders.size();i++){
+        for(size_t i=0;i<shaderSliders.size() && i<sliderLocations.size();i++){
+            if(sliderLocations[i] == -1){
+                continue;
+            }
             if(shaderSlidersType.at(i) == ShaderSliderType_FLOAT){
-                paramName = "param1f"+ofToString(shaderSlidersIndex[i]);
-                tempVarName = "GUI_FLOAT_"+shaderSlidersLabel.at(i);
-                shader->setUniform1f(paramName.c_str(), static_cast<float>(shaderSliders.at(i)));
+                glUniform1f(sliderLocations[i], static_cast<float>(shaderSliders.at(i)));
             }else if(shaderSlidersType.at(i) == ShaderSliderType_INT){
-                paramName = "param1i"+ofToString(shaderSlidersIndex[i]);
-                tempVarName = "GUI_INT_"+shaderSlidersLabel.at(i);
-                shader->setUniform1i(paramName.c_str(), static_cast<int>(floor(shaderSliders.at(i))));
+                glUniform1i(sliderLocations[i], static_cast<int>(floor(shaderSliders.at(i))));
             }
         }
 
@@ -287,10 +358,20 @@ void ShaderObject::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRe
             glEnd();
         }
 
-        shader->end();
+        endShader();
+
+        for(int i=nTextures-1;i>=0;i--){
+            boundTextures[i]->unbind(i+1);
+        }
+        pingPong->src->getTexture().unbind(0);
 
         pingPong->dst->end();
 
+        for(size_t i=0;i<textures.size();i++){
+            ofxVPFboPool::get().releaseTransient(textures[i]);
+        }
+        textures.clear();
+
         pingPong->swap();
 
     }
@@ -314,6 +395,9 @@ void ShaderObject::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRe
     }
     fbo->end();
     *static_cast<ofTexture *>(_outletParams[0]) = fbo->getTexture();
+    if(changed){
+        this->markOutletChanged(0);
+    }
     ///////////////////////////////////////////
 
     ofSetColor(255);
@@ -409,6 +493,10 @@ void ShaderObject::drawObjectNodeConfig(){
     }
     ImGui::Spacing();
     ImGui::Text("Rendering at: %.0fx%.0f",static_cast<ofTexture *>(_outletParams[0])->getWidth(),static_cast<ofTexture *>(_outletParams[0])->getHeight());
+    ImGui::Text("Direct texture inputs: %i/%i",directTextures,nTextures);
+    if(compileInfo != ""){
+        ImGui::Text("Program: %s",compileInfo.c_str());
+    }
     ImGui::Spacing();
     ImGui::Spacing();
     ImGui::Spacing();
@@ -494,7 +582,14 @@ void ShaderObject::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void ShaderObject::removeObjectContent(bool removeFileFromData){
-
+    ofxVPShaderCache::get().cancel(compileTicket);
+    compileTicket = 0;
+    ofxVPShaderCache::get().deleteProgram(program);
+    program = 0;
+
+    ofxVPFboPool::get().release(fbo);
+    fbo = nullptr;
+    pingPong->release();
 }
 
 //--------------------------------------------------------------
@@ -524,16 +619,8 @@ void ShaderObject::doFragmentShader(){
     this->inletsNames.clear();
     this->numInlets = num;
 
-    textures.clear();
     for( int i = 0; i < num; i++){
-        _inletParams[i] = new ofTexture();
-
-        ofFbo* tempFBO = new ofFbo();
-        tempFBO->allocate(output_width,output_height,internalFormat,4);
-        tempFBO->begin();
-        ofClear(0,0,0,255);
-        tempFBO->end();
-        textures.push_back(tempFBO);
+        this->newInletBuffer<ofTexture>(i);
     }
 
     reloading = false;
@@ -576,7 +663,6 @@ void ShaderObject::doFragmentShader(){
             shaderSlidersLabel.push_back(varName);
             shaderSlidersType.push_back(ShaderSliderType_FLOAT);
 
-            _inletParams[this->numInlets] = new float();
             *(float *)&_inletParams[this->numInlets] = 0.0f;
             this->numInlets++;
             this->addInlet(VP_LINK_NUMERIC,varName);
@@ -606,7 +692,6 @@ void ShaderObject::doFragmentShader(){
             shaderSlidersLabel.push_back(varName);
             shaderSlidersType.push_back(ShaderSliderType_INT);
 
-            _inletParams[this->numInlets] = new float();
             *(float *)&_inletParams[this->numInlets] = 0.0f;
             this->numInlets++;
             this->addInlet(VP_LINK_NUMERIC,varName);
@@ -635,22 +720,95 @@ void ShaderObject::doFragmentShader(){
 
     // Compile the shader and load it to the GPU
     quad.clear();
-    shader->unload();
+    // the inlets changed: uniforms looked up again, in the running program until the new one links
+    uniformsCached = false;
 
     if (!ofIsGLProgrammableRenderer()) {
-        if(vertexShader != ""){
-            shader->setupShaderFromSource(GL_VERTEX_SHADER, vertexShader);
-        }
-        shader->setupShaderFromSource(GL_FRAGMENT_SHADER, fragmentShader);
+        ofxVPShaderCache::get().cancel(compileTicket);
+        compileTicket = ofxVPShaderCache::get().compile(vertexShader,fragmentShader);
+        compileInfo = "compiling...";
+        this->setIsReady(false);
     }else{
+        shader->unload();
         size_t lastindex = filepath.find_last_of(".");
         string rawname = filepath.substr(0, lastindex);
         shader->load(rawname);
+        scriptLoaded = shader->isLoaded();
+
+        if(scriptLoaded){
+            ofLog(OF_LOG_NOTICE,"[verbose] SHADER: %s [%ix%i] loaded on GPU!",filepath.c_str(),output_width,output_height);
+        }
     }
-    scriptLoaded = shader->isLoaded();
+}
 
-    if(scriptLoaded){
-        ofLog(OF_LOG_NOTICE,"[verbose] SHADER: %s [%ix%i] loaded on GPU!",filepath.c_str(),output_width,output_height);
+//--------------------------------------------------------------
+void ShaderObject::cacheUniformLocations(){
+    backbufferLocation  = getUniformLocation("backbuffer");
+    resolutionLocation  = getUniformLocation("resolution");
+    timeLocation        = getUniformLocation("time");
+
+    textureLocations.clear();
+    for(int i=0;i<nTextures;i++){
+        textureLocations.push_back(getUniformLocation("tex"+ofToString(i)));
+    }
+
+    sliderLocations.clear();
+    for(size_t i=0;i<shaderSlidersIndex.size();i++){
+        string paramName = shaderSlidersType.at(i) == ShaderSliderType_INT ? "param1i" : "param1f";
+        sliderLocations.push_back(getUniformLocation(paramName+ofToString(shaderSlidersIndex[i])));
+    }
+
+    uniformsCached = true;
+}
+
+//--------------------------------------------------------------
+GLint ShaderObject::getUniformLocation(const string &name){
+    if(ofIsGLProgrammableRenderer()){
+        return shader->getUniformLocation(name);
+    }
+    return program != 0 ? glGetUniformLocation(program,name.c_str()) : -1;
+}
+
+//--------------------------------------------------------------
+void ShaderObject::beginShader(){
+    if(ofIsGLProgrammableRenderer()){
+        shader->begin();
+    }else{
+        glUseProgram(program);
+    }
+}
+
+//--------------------------------------------------------------
+void ShaderObject::endShader(){
+    if(ofIsGLProgrammableRenderer()){
+        shader->end();
+    }else{
+        glUseProgram(0);
+    }
+}
+
+//--------------------------------------------------------------
+bool ShaderObject::canBindDirectly(const ofTexture &tex){
+    // same sampling as the copy: same target and size, same orientation, same storage format (the
+    // copy converts to internalFormat, ex. clamping float inputs to 8 bit) and same filter/wrap
+    const ofTextureData &td = tex.getTextureData();
+    const ofTextureData &own = pingPong->src->getTexture().getTextureData();
+    if(td.textureTarget != own.textureTarget || td.bFlipTexture || static_cast<int>(td.tex_w) != output_width || static_cast<int>(td.tex_h) != output_height){
+        return false;
+    }
+    if(td.minFilter != own.minFilter || td.magFilter != own.magFilter || td.wrapModeHorizontal != own.wrapModeHorizontal || td.wrapModeVertical != own.wrapModeVertical){
+        return false;
+    }
+    return sizedFormat(td.glInternalFormat) == sizedFormat(internalFormat);
+}
+
+//--------------------------------------------------------------
+int ShaderObject::sizedFormat(int format){
+    // unsized color formats are stored as 8 bit
+    switch(format){
+        case GL_RGB:    return GL_RGB8;
+        case GL_RGBA:   return GL_RGBA8;
+        default:        return format;
     }
 }
 
@@ -659,15 +817,14 @@ void ShaderObject::initResolution(){
     output_width = static_cast<int>(floor(this->getCustomVar("OUTPUT_WIDTH")));
     output_height = static_cast<int>(floor(this->getCustomVar("OUTPUT_HEIGHT")));
 
-    fbo = new ofFbo();
-    fbo->allocate(output_width,output_height,GL_RGBA32F_ARB,4);
+    ofxVPFboPool::get().release(fbo);
+    fbo = ofxVPFboPool::get().acquire(output_width,output_height,GL_RGBA32F_ARB,4,this->getId());
     fbo->begin();
     ofClear(0,0,0,255);
     fbo->end();
 
     // init shader
-    pingPong = new ofxPingPong();
-    pingPong->allocate(output_width,output_height);
+    pingPong->allocate(output_width,output_height,GL_RGBA,this->getId());
 
 }
 
@@ -690,15 +847,7 @@ void ShaderObject::resetResolution(int fromID, int newWidth, int newHeight){
         this->setCustomVar(static_cast<float>(output_height),"OUTPUT_HEIGHT");
         this->saveConfig(false);
 
-        fbo = new ofFbo();
-        fbo->allocate(output_width,output_height,GL_RGBA32F_ARB,4);
-        fbo->begin();
-        ofClear(0,0,0,255);
-        fbo->end();
-
-        // init shader
-        pingPong = new ofxPingPong();
-        pingPong->allocate(output_width,output_height);
+        initResolution();
 
         if(filepath != "none"){
             loadScript(filepath);
@@ -37,19 +37,28 @@
 #include "PatchObject.h"
 
 #include "PathWatcher.h"
+#include "shaderCache.h"
 
 #include "ImGuiFileBrowser.h"
 #include "IconsFontAwesome5.h"
 
 class ofxPingPong {
 public:
-    void allocate( int _width, int _height, int _internalformat = GL_RGBA){
+    ofxPingPong(){
+        FBOs[0] = FBOs[1] = nullptr;
+        src = dst = nullptr;
+        flag = 0;
+    }
+
+    ~ofxPingPong(){ release(); }
+
+    // FBOs from the shared pool (acquired cleared), held by ownerID
+    void allocate( int _width, int _height, int _internalformat = GL_RGBA, int ownerID = -1){
+        release();
+
         // Allocate
         for(int i = 0; i < 2; i++)
-            FBOs[i].allocate(_width,_height, _internalformat );
-
-        // Clean
-        clear();
+            FBOs[i] = ofxVPFboPool::get().acquire(_width,_height, _internalformat, 0, ownerID);
 
         // Set everything to 0
         flag = 0;
@@ -57,26 +66,34 @@ public:
         flag = 0;
     }
 
+    void release(){
+        for(int i = 0; i < 2; i++){
+            ofxVPFboPool::get().release(FBOs[i]);
+            FBOs[i] = nullptr;
+        }
+        src = dst = nullptr;
+    }
+
     void swap(){
-        src = &(FBOs[(flag)%2]);
-        dst = &(FBOs[++(flag)%2]);
+        src = FBOs[(flag)%2];
+        dst = FBOs[++(flag)%2];
     }
 
     void clear(){
         for(int i = 0; i < 2; i++){
-            FBOs[i].begin();
+            FBOs[i]->begin();
             ofClear(0,0);
-            FBOs[i].end();
+            FBOs[i]->end();
         }
     }
 
-    ofFbo& operator[]( int n ){ return FBOs[n];}
+    ofFbo& operator[]( int n ){ return *FBOs[n];}
 
     ofFbo   *src;       // Source       ->  Ping
     ofFbo   *dst;       // Destination  ->  Pong
 
 private:
-    ofFbo   FBOs[2];    // Real addresses of ping/pong FBO´s
+    ofFbo   *FBOs[2];   // Real addresses of ping/pong FBO´s
     int     flag;       // Integer for making a quick swap
 };
 
@@ -103,6 +120,12 @@ public:
 
     void            initResolution();
     void            doFragmentShader();
+    void            cacheUniformLocations();
+    GLint           getUniformLocation(const string &name);
+    void            beginShader();
+    void            endShader();
+    bool            canBindDirectly(const ofTexture &tex);
+    static int      sizedFormat(int format);
 
     void            loadScript(string scriptFile);
 
@@ -110,8 +133,14 @@ public:
     void            pathChanged(const PathWatcher::Event &event);
 
     ofxPingPong         *pingPong;
-    vector<ofFbo*>      textures;
-    ofShader            *shader;
+    vector<ofFbo*>      textures;       // inlet copies, transient targets of the shared pool during the draw
+    vector<ofTexture*>  boundTextures;  // texture bound to each texN, an upstream texture or its copy
+    int                 directTextures; // inlets bound with no copy on the last draw
+    ofShader            *shader;        // programmable renderer
+    // fixed pipeline program, built in background by ofxVPShaderCache: the running one stays until the new one links
+    GLuint              program;
+    uint64_t            compileTicket;
+    string              compileInfo;
     ofVboMesh           quad;
     ofFile              currentScriptFile;
     string              fragmentShader;
@@ -123,9 +152,16 @@ public:
     vector<string>      shaderSlidersLabel;
     vector<int>         shaderSlidersIndex;
     vector<int>         shaderSlidersType;
+
+    // uniform locations, looked up once per linked program (-1: unused by the shader)
+    bool                uniformsCached;
+    GLint               backbufferLocation, resolutionLocation, timeLocation;
+    vector<GLint>       textureLocations;
+    vector<GLint>       sliderLocations;
     
     PathWatcher         watcher;
     bool                scriptLoaded;
+    bool                drawnScriptLoaded;
     bool                isNewObject;
     bool                reloading;
     bool                oneBang;
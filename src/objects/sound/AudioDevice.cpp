@@ -170,12 +170,16 @@ void AudioDevice::audioInObject(ofSoundBuffer &inputBuffer){
         if(in_channels == 1){
             inputBuffer.copyTo(IN_CH.at(0), inputBuffer.getNumFrames(), 1, 0);
             PN_IN_CH.at(0).copyInput(IN_CH.at(0).getBuffer().data(),IN_CH.at(0).getNumFrames());
-            static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(IN_SCOPE[0].getBuffer(),1,inputBuffer.getNumFrames());
+            if(this->getIsOutletConnectedDSP(0)){
+                static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(IN_SCOPE[0].getBuffer(),1,inputBuffer.getNumFrames());
+            }
         }else{
             for(size_t c=0;c<static_cast<size_t>(in_channels);c++){
                 inputBuffer.getChannel(IN_CH.at(c),c);
                 PN_IN_CH.at(c).copyInput(IN_CH.at(c).getBuffer().data(),IN_CH.at(c).getNumFrames());
-                static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(IN_SCOPE[c].getBuffer(),1,inputBuffer.getNumFrames());
+                if(this->getIsOutletConnectedDSP(c)){
+                    static_cast<ofSoundBuffer *>(_outletParams[c])->copyFrom(IN_SCOPE[c].getBuffer(),1,inputBuffer.getNumFrames());
+                }
             }
         }
     }
@@ -228,7 +232,7 @@ void AudioDevice::resetSystemObject(){
         }
 
         for( int i = 0; i < out_channels; i++){
-            _inletParams[i] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRateOUT));
+            this->newInletBuffer<ofSoundBuffer>(i,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRateOUT));
         }
 
         for( int i = 0; i < this->pdspOut.size(); i++){
@@ -237,7 +241,7 @@ void AudioDevice::resetSystemObject(){
         this->pdspOut.clear();
 
         for( int i = 0; i < in_channels; i++){
-            _outletParams[i] = new ofSoundBuffer();
+            this->newOutletBuffer<ofSoundBuffer>(i);
             ofSoundBuffer temp;
             IN_CH.push_back(temp);
 
@@ -368,7 +372,7 @@ void AudioDevice::loadDeviceInfo(){
         }
 
         for( int i = 0; i < out_channels; i++){
-            _inletParams[i] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRateOUT));
+            this->newInletBuffer<ofSoundBuffer>(i,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRateOUT));
         }
 
         for( int i = 0; i < this->pdspOut.size(); i++){
@@ -377,7 +381,7 @@ void AudioDevice::loadDeviceInfo(){
         this->pdspOut.clear();
 
         for( int i = 0; i < in_channels; i++){
-            _outletParams[i] = new ofSoundBuffer();
+            this->newOutletBuffer<ofSoundBuffer>(i);
             ofSoundBuffer temp;
             IN_CH.push_back(temp);
 
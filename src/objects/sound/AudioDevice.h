@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 class AudioDevice : public PatchObject {
 
 public:
@@ -67,8 +69,8 @@ public:
     vector<pdsp::Scope>         IN_SCOPE;
     vector<pdsp::ExternalInput> OUT_CH;
 
-    pdsp::ValueControl          LF_ctrl;
-    pdsp::ValueControl          HF_ctrl;
+    ofxVPControlSignal          LF_ctrl;
+    ofxVPControlSignal          HF_ctrl;
 
     short *                 shortBuffer;
     std::mutex              audioMutex;
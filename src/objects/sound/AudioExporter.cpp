@@ -40,10 +40,9 @@ AudioExporter::AudioExporter() : PatchObject("audio exporter"){
     this->numInlets  = 2;
     this->numOutlets = 0;
 
-    _inletParams[0] = new ofSoundBuffer(); // input
+    this->newInletBuffer<ofSoundBuffer>(0); // input
 
-    _inletParams[1] = new float();  // bang
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // bang
 
     this->initInletsState();
 
@@ -55,6 +54,7 @@ AudioExporter::AudioExporter() : PatchObject("audio exporter"){
     audioFPS            = 0.0f;
     audioCounter        = 0;
     lastAudioTimeReset  = ofGetElapsedTimeMillis();
+    plotVersion         = 0;
 
     recButtonLabel      = "REC";
 }
@@ -143,7 +143,7 @@ void AudioExporter::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
 
         if(this->inletsConnected[0]){
             // draw waveform
-            ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImGui::GetWindowSize(), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor);
+            ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImGui::GetWindowSize(), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor, plotVersion.load());
 
             // draw signal RMS amplitude
             _nodeCanvas.getNodeDrawList()->AddRectFilled(ImGui::GetWindowPos()+ImVec2(0,ImGui::GetWindowSize().y),ImGui::GetWindowPos()+ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y * (1.0f - ofClamp(static_cast<ofSoundBuffer *>(_inletParams[0])->getRMSAmplitude(),0.0,1.0))),IM_COL32(255,255,120,12));
@@ -310,6 +310,7 @@ void AudioExporter::audioInObject(ofSoundBuffer &inputBuffer){
             float sample = static_cast<ofSoundBuffer *>(_inletParams[0])->getSample(i,0);
             plot_data[i] = hardClip(sample);
         }
+        plotVersion++;
     }
 }
 
@@ -66,6 +66,7 @@ public:
 
     ofxFFmpegRecorder   recorder;
     float               plot_data[1024];
+    std::atomic<uint64_t> plotVersion;
 
     imgui_addons::ImGuiFileBrowser  fileDialog;
 
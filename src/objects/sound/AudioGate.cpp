@@ -40,17 +40,16 @@ AudioGate::AudioGate() : PatchObject("signal gate"){
     this->numInlets  = 7;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
-    _inletParams[1] = new ofSoundBuffer();  // sig1
-    _inletParams[2] = new ofSoundBuffer();  // sig2
-    _inletParams[3] = new ofSoundBuffer();  // sig3
-    _inletParams[4] = new ofSoundBuffer();  // sig4
-    _inletParams[5] = new ofSoundBuffer();  // sig5
-    _inletParams[6] = new ofSoundBuffer();  // sig6
+    this->newInletBuffer<ofSoundBuffer>(1);  // sig1
+    this->newInletBuffer<ofSoundBuffer>(2);  // sig2
+    this->newInletBuffer<ofSoundBuffer>(3);  // sig3
+    this->newInletBuffer<ofSoundBuffer>(4);  // sig4
+    this->newInletBuffer<ofSoundBuffer>(5);  // sig5
+    this->newInletBuffer<ofSoundBuffer>(6);  // sig6
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
@@ -228,6 +227,10 @@ void AudioGate::removeObjectContent(bool removeFileFromData){
 
 //--------------------------------------------------------------
 void AudioGate::audioOutObject(ofSoundBuffer &outputBuffer){
+    if(!this->getIsOutletConnectedDSP(0)){
+        return;
+    }
+
     if(openInlet >= 1 && openInlet < this->numInlets){
         *static_cast<ofSoundBuffer *>(_outletParams[0]) = *static_cast<ofSoundBuffer *>(_inletParams[openInlet]);
     }else if(openInlet == 0){
@@ -258,11 +261,10 @@ void AudioGate::resetInletsSettings(){
 
     this->numInlets = dataInlets+1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
     for(size_t i=1;i<this->numInlets;i++){
-        _inletParams[i] = new ofSoundBuffer();
+        this->newInletBuffer<ofSoundBuffer>(i);
         static_cast<ofSoundBuffer *>(_inletParams[i])->set(0.0f);
     }
 
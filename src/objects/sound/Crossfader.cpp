@@ -40,12 +40,11 @@ Crossfader::Crossfader() : PatchObject("crossfader"){
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio in 1
-    _inletParams[1] = new ofSoundBuffer();  // audio in 2
-    _inletParams[2] = new float();          // fade
-    *(float *)&_inletParams[2] = 0.0f;
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio in 1
+    this->newInletBuffer<ofSoundBuffer>(1);  // audio in 2
+    *(float *)&_inletParams[2] = 0.0f;          // fade
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output L
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output L
 
     this->initInletsState();
 
@@ -193,7 +192,9 @@ void Crossfader::audioInObject(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void Crossfader::audioOutObject(ofSoundBuffer &outputBuffer){
     // STEREO SIGNAL BUFFERS
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 OBJECT_REGISTER( Crossfader, "crossfader", OFXVP_OBJECT_CAT_SOUND)
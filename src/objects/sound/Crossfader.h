@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 class Crossfader : public PatchObject{
 
 public:
@@ -61,7 +63,7 @@ public:
 
     pdsp::LinearCrossfader  crossfader;
     pdsp::Scope             scope;
-    pdsp::ValueControl      fade_ctrl;
+    ofxVPControlSignal      fade_ctrl;
 
     float                   fade_value;
 
@@ -40,28 +40,30 @@ Mixer::Mixer() : PatchObject("mixer"){
     this->numInlets  = 7;
     this->numOutlets = 1;
 
-    _inletParams[0] = new vector<float>();
+    this->newInletBuffer<vector<float>>(0);
 
-    _inletParams[1] = new ofSoundBuffer();  // audio input 1
-    _inletParams[2] = new ofSoundBuffer();  // audio input 2
-    _inletParams[3] = new ofSoundBuffer();  // audio input 3
-    _inletParams[4] = new ofSoundBuffer();  // audio input 4
-    _inletParams[5] = new ofSoundBuffer();  // audio input 5
-    _inletParams[6] = new ofSoundBuffer();  // audio input 6
+    this->newInletBuffer<ofSoundBuffer>(1);  // audio input 1
+    this->newInletBuffer<ofSoundBuffer>(2);  // audio input 2
+    this->newInletBuffer<ofSoundBuffer>(3);  // audio input 3
+    this->newInletBuffer<ofSoundBuffer>(4);  // audio input 4
+    this->newInletBuffer<ofSoundBuffer>(5);  // audio input 5
+    this->newInletBuffer<ofSoundBuffer>(6);  // audio input 6
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
     signalInlets    = this->numInlets-1;
 
     levels          = new pdsp::Amp[signalInlets];
-    levels_ctrl     = new pdsp::ValueControl[signalInlets];
+    levels_ctrl     = new ofxVPControlSignal[signalInlets];
     levels_float    = new float[signalInlets];
 
     needReset       = false;
     loaded          = false;
 
+    rms             = 0.0f;
+
     isAudioINObject         = true;
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
@@ -196,7 +198,7 @@ void Mixer::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
         }
 
         ImGui::SameLine();ImGui::Dummy(ImVec2(sliderW/4.0f,1));ImGui::SameLine();
-        ImGuiEx::VUMeter(_nodeCanvas.getNodeDrawList(), sliderW/2.0f, this->height*_nodeCanvas.GetCanvasScale() - (26*scaleFactor + IMGUI_EX_NODE_CONTENT_PADDING*3*scaleFactor), static_cast<ofSoundBuffer *>(_outletParams[0])->getRMSAmplitude(), false);
+        ImGuiEx::VUMeter(_nodeCanvas.getNodeDrawList(), sliderW/2.0f, this->height*_nodeCanvas.GetCanvasScale() - (26*scaleFactor + IMGUI_EX_NODE_CONTENT_PADDING*3*scaleFactor), rms.load(), false);
 
         _nodeCanvas.EndNodeContent();
     }
@@ -279,10 +281,10 @@ void Mixer::resetInletsSettings(){
         this->height = OBJECT_HEIGHT*2;
     }
 
-    _inletParams[0] = new vector<float>();
+    this->newInletBuffer<vector<float>>(0);
 
     for(size_t i=0;i<signalInlets;i++){
-        _inletParams[i+1] = new ofSoundBuffer();
+        this->newInletBuffer<ofSoundBuffer>(i+1);
     }
 
     this->inletsType.clear();
@@ -304,7 +306,7 @@ void Mixer::resetInletsSettings(){
     }
 
     levels          = new pdsp::Amp[signalInlets];
-    levels_ctrl     = new pdsp::ValueControl[signalInlets];
+    levels_ctrl     = new ofxVPControlSignal[signalInlets];
     levels_float    = new float[signalInlets];
 
     for(int i=0;i<signalInlets;i++){
@@ -338,8 +340,14 @@ void Mixer::audioInObject(ofSoundBuffer &inputBuffer){
 
 //--------------------------------------------------------------
 void Mixer::audioOutObject(ofSoundBuffer &outputBuffer){
+    // VU meter, without going through the outlet buffer
+    const vector<float> &signal = scope.getBuffer();
+    rms = signal.empty() ? 0.0f : sqrt(ofxVPMath::dot(signal.data(),signal.data(),signal.size())/signal.size());
+
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 OBJECT_REGISTER( Mixer, "mixer", OFXVP_OBJECT_CAT_SOUND)
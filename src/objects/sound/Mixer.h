@@ -36,6 +36,9 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+#include "vectorMath.h"
+
 class Mixer : public PatchObject{
 
 public:
@@ -63,10 +66,11 @@ public:
 
     pdsp::PatchNode         mix;
     pdsp::Amp*              levels;
-    pdsp::ValueControl*     levels_ctrl;
+    ofxVPControlSignal*     levels_ctrl;
     float*                  levels_float;
 
     pdsp::Scope             scope;
+    std::atomic<float>      rms;
 
     int                     bufferSize;
     int                     sampleRate;
@@ -85,11 +85,9 @@ NoteToFrequency::NoteToFrequency() : PatchObject("note to frequency"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // midi [0 - 127]
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // midi [0 - 127]
 
-    _outletParams[0] = new float(); // frequency
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f; // frequency
 
     this->initInletsState();
 
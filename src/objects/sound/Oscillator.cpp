@@ -40,34 +40,27 @@ Oscillator::Oscillator() : PatchObject("oscillator"){
     this->numInlets  = 7;
     this->numOutlets = 7;
 
-    _inletParams[0] = new float();  // pitch
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // pitch
 
-    _inletParams[1] = new float();  // level
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // level
 
-    _inletParams[2] = new float();  // sine
-    *(float *)&_inletParams[2] = 0.0f;
+    *(float *)&_inletParams[2] = 0.0f;  // sine
 
-    _inletParams[3] = new float();  // triangle
-    *(float *)&_inletParams[3] = 0.0f;
+    *(float *)&_inletParams[3] = 0.0f;  // triangle
 
-    _inletParams[4] = new float();  // saw
-    *(float *)&_inletParams[4] = 0.0f;
+    *(float *)&_inletParams[4] = 0.0f;  // saw
 
-    _inletParams[5] = new float();  // pulse
-    *(float *)&_inletParams[5] = 0.0f;
+    *(float *)&_inletParams[5] = 0.0f;  // pulse
 
-    _inletParams[6] = new float();  // noise
-    *(float *)&_inletParams[6] = 0.0f;
+    *(float *)&_inletParams[6] = 0.0f;  // noise
 
-    _outletParams[0] = new ofSoundBuffer(); // osc output
-    _outletParams[1] = new ofSoundBuffer(); // sine output
-    _outletParams[2] = new ofSoundBuffer(); // triangle output
-    _outletParams[3] = new ofSoundBuffer(); // saw output
-    _outletParams[4] = new ofSoundBuffer(); // pulse output
-    _outletParams[5] = new ofSoundBuffer(); // noise output
-    _outletParams[6] = new vector<float>(); // audio buffer
+    this->newOutletBuffer<ofSoundBuffer>(0); // osc output
+    this->newOutletBuffer<ofSoundBuffer>(1); // sine output
+    this->newOutletBuffer<ofSoundBuffer>(2); // triangle output
+    this->newOutletBuffer<ofSoundBuffer>(3); // saw output
+    this->newOutletBuffer<ofSoundBuffer>(4); // pulse output
+    this->newOutletBuffer<ofSoundBuffer>(5); // noise output
+    this->newOutletBuffer<vector<float>>(6); // audio buffer
 
     this->initInletsState();
 
@@ -88,6 +81,8 @@ Oscillator::Oscillator() : PatchObject("oscillator"){
     pulse_float             = 0.0f;
     noise_float             = 0.0f;
 
+    plotVersion             = 0;
+
     this->width *= 2.0f;
     this->height *= 2.9f;
 
@@ -288,7 +283,7 @@ void Oscillator::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
 
         // draw waveform
-        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y*0.3f), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor);
+        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y*0.3f), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor, plotVersion.load());
 
         char temp[128];
         sprintf(temp,"%.2f Hz", pdsp::PitchToFreq::eval(pitch_float+detune_float+fine_float));
@@ -398,20 +393,34 @@ void Oscillator::loadAudioSettings(){
 //--------------------------------------------------------------
 void Oscillator::audioOutObject(ofSoundBuffer &outputBuffer){
 
-    for(size_t i = 0; i < scope.getBuffer().size(); i++) {
-        float sample = scope.getBuffer().at(i);
-        plot_data[i] = hardClip(sample);
-
-        // SIGNAL BUFFER DATA
-        static_cast<vector<float> *>(_outletParams[6])->at(i) = sample;
+    const vector<float> &signal = scope.getBuffer();
+    for(size_t i = 0; i < signal.size(); i++) {
+        plot_data[i] = hardClip(signal[i]);
+    }
+    plotVersion++;
+    // SIGNAL BUFFER DATA
+    if(this->getIsOutletConnectedDSP(6)){
+        ofxVPMath::copy(signal.data(), signal.size(), *static_cast<vector<float> *>(_outletParams[6]));
     }
     // SIGNALS BUFFERS
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(sine_scope.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[2])->copyFrom(triangle_scope.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[3])->copyFrom(saw_scope.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[4])->copyFrom(pulse_scope.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[5])->copyFrom(noise_scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(1)){
+        static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(sine_scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(2)){
+        static_cast<ofSoundBuffer *>(_outletParams[2])->copyFrom(triangle_scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(3)){
+        static_cast<ofSoundBuffer *>(_outletParams[3])->copyFrom(saw_scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(4)){
+        static_cast<ofSoundBuffer *>(_outletParams[4])->copyFrom(pulse_scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(5)){
+        static_cast<ofSoundBuffer *>(_outletParams[5])->copyFrom(noise_scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 OBJECT_REGISTER( Oscillator, "oscillator", OFXVP_OBJECT_CAT_SOUND)
@@ -36,6 +36,9 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+#include "vectorMath.h"
+
 #include "imgui_controls.h"
 
 class Oscillator : public PatchObject{
@@ -70,17 +73,17 @@ public:
     pdsp::Scope             pulse_scope;
     pdsp::Scope             noise_scope;
 
-    pdsp::ValueControl      level_ctrl;
-    pdsp::ValueControl      pitch_ctrl;
-    pdsp::ValueControl      detuneCoarse_ctrl;
-    pdsp::ValueControl      detuneFine_ctrl;
-    pdsp::ValueControl      pw_ctrl;
+    ofxVPControlSignal      level_ctrl;
+    ofxVPControlSignal      pitch_ctrl;
+    ofxVPControlSignal      detuneCoarse_ctrl;
+    ofxVPControlSignal      detuneFine_ctrl;
+    ofxVPControlSignal      pw_ctrl;
 
-    pdsp::ValueControl      sine_ctrl;
-    pdsp::ValueControl      triangle_ctrl;
-    pdsp::ValueControl      saw_ctrl;
-    pdsp::ValueControl      pulse_ctrl;
-    pdsp::ValueControl      noise_ctrl;
+    ofxVPControlSignal      sine_ctrl;
+    ofxVPControlSignal      triangle_ctrl;
+    ofxVPControlSignal      saw_ctrl;
+    ofxVPControlSignal      pulse_ctrl;
+    ofxVPControlSignal      noise_ctrl;
 
     pdsp::Amp               sineLevel;
     pdsp::Amp               triangleLevel;
@@ -101,6 +104,7 @@ public:
     float                   noise_float;
 
     float                   plot_data[1024];
+    std::atomic<uint64_t>   plotVersion;
     int                     bufferSize;
     int                     sampleRate;
 
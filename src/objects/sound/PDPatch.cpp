@@ -42,17 +42,17 @@ PDPatch::PDPatch() : PatchObject("pd patch"){
     this->numInlets  = 5;
     this->numOutlets = 5;
 
-    _inletParams[0] = new ofSoundBuffer(); // Audio stream IN 1
-    _inletParams[1] = new ofSoundBuffer(); // Audio stream IN 2
-    _inletParams[2] = new ofSoundBuffer(); // Audio stream IN 3
-    _inletParams[3] = new ofSoundBuffer(); // Audio stream IN 4
-    _inletParams[4] = new vector<float>(); // Data to PD
-
-    _outletParams[0] = new ofSoundBuffer();  // Audio stream OUT 1
-    _outletParams[1] = new ofSoundBuffer();  // Audio stream OUT 2
-    _outletParams[2] = new ofSoundBuffer();  // Audio stream OUT 3
-    _outletParams[3] = new ofSoundBuffer();  // Audio stream OUT 4
-    _outletParams[4] = new vector<float>();  // Data to Mosaic
+    this->newInletBuffer<ofSoundBuffer>(0); // Audio stream IN 1
+    this->newInletBuffer<ofSoundBuffer>(1); // Audio stream IN 2
+    this->newInletBuffer<ofSoundBuffer>(2); // Audio stream IN 3
+    this->newInletBuffer<ofSoundBuffer>(3); // Audio stream IN 4
+    this->newInletBuffer<vector<float>>(4); // Data to PD
+
+    this->newOutletBuffer<ofSoundBuffer>(0);  // Audio stream OUT 1
+    this->newOutletBuffer<ofSoundBuffer>(1);  // Audio stream OUT 2
+    this->newOutletBuffer<ofSoundBuffer>(2);  // Audio stream OUT 3
+    this->newOutletBuffer<ofSoundBuffer>(3);  // Audio stream OUT 4
+    this->newOutletBuffer<vector<float>>(4);  // Data to Mosaic
 
     this->initInletsState();
 
@@ -480,15 +480,15 @@ void PDPatch::loadAudioSettings(){
         shortBuffer[i] = 0;
     }
 
-    _inletParams[0] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
-    _inletParams[1] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
-    _inletParams[2] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
-    _inletParams[3] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newInletBuffer<ofSoundBuffer>(0,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newInletBuffer<ofSoundBuffer>(1,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newInletBuffer<ofSoundBuffer>(2,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newInletBuffer<ofSoundBuffer>(3,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
 
-    _outletParams[0] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
-    _outletParams[1] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
-    _outletParams[2] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
-    _outletParams[3] = new ofSoundBuffer(shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newOutletBuffer<ofSoundBuffer>(0,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newOutletBuffer<ofSoundBuffer>(1,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newOutletBuffer<ofSoundBuffer>(2,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
+    this->newOutletBuffer<ofSoundBuffer>(3,shortBuffer,static_cast<size_t>(bufferSize),1,static_cast<unsigned int>(sampleRate));
 
 }
 
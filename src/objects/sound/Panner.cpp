@@ -40,12 +40,11 @@ Panner::Panner() : PatchObject("panner"){
     this->numInlets  = 2;
     this->numOutlets = 2;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
-    _inletParams[1] = new float();          // gain
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
+    *(float *)&_inletParams[1] = 0.0f;          // gain
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output L
-    _outletParams[1] = new ofSoundBuffer(); // audio output R
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output L
+    this->newOutletBuffer<ofSoundBuffer>(1); // audio output R
 
     this->initInletsState();
 
@@ -194,8 +193,12 @@ void Panner::audioInObject(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void Panner::audioOutObject(ofSoundBuffer &outputBuffer){
     // STEREO SIGNAL BUFFERS
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scopeL.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scopeR.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scopeL.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(1)){
+        static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scopeR.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
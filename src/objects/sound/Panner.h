@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 class Panner : public PatchObject{
 
 public:
@@ -62,7 +64,7 @@ public:
 
     pdsp::Panner            panner;
     pdsp::Scope             scopeL, scopeR;
-    pdsp::ValueControl      pan_ctrl;
+    ofxVPControlSignal      pan_ctrl;
 
     float                   pan;
 
@@ -40,16 +40,16 @@ QuadPanner::QuadPanner() : PatchObject("quad panner"){
     this->numInlets  = 3;
     this->numOutlets = 4;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
-    _inletParams[1] = new float();          // pan X
-    _inletParams[2] = new float();          // pan Y
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
+    *(float *)&_inletParams[1] = 0.0f;          // pan X
+    *(float *)&_inletParams[2] = 0.0f;          // pan Y
     *(float *)&_inletParams[1] = 0.0f;
     *(float *)&_inletParams[2] = 0.0f;
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output 1
-    _outletParams[1] = new ofSoundBuffer(); // audio output 2
-    _outletParams[2] = new ofSoundBuffer(); // audio output 3
-    _outletParams[3] = new ofSoundBuffer(); // audio output 4
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output 1
+    this->newOutletBuffer<ofSoundBuffer>(1); // audio output 2
+    this->newOutletBuffer<ofSoundBuffer>(2); // audio output 3
+    this->newOutletBuffer<ofSoundBuffer>(3); // audio output 4
 
     this->initInletsState();
 
@@ -220,10 +220,18 @@ void QuadPanner::audioInObject(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void QuadPanner::audioOutObject(ofSoundBuffer &outputBuffer){
     // QUAD SIGNAL BUFFERS
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope1.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scope2.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[2])->copyFrom(scope3.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[3])->copyFrom(scope4.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope1.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(1)){
+        static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scope2.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(2)){
+        static_cast<ofSoundBuffer *>(_outletParams[2])->copyFrom(scope3.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(3)){
+        static_cast<ofSoundBuffer *>(_outletParams[3])->copyFrom(scope4.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
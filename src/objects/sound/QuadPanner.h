@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class QuadPanner : public PatchObject{
@@ -64,7 +66,7 @@ public:
 
     pdsp::Amp               gain1, gain2, gain3, gain4;
     pdsp::Scope             scope1, scope2, scope3, scope4;
-    pdsp::ValueControl      gain_ctrl1, gain_ctrl2, gain_ctrl3, gain_ctrl4;
+    ofxVPControlSignal      gain_ctrl1, gain_ctrl2, gain_ctrl3, gain_ctrl4;
 
     float                   padX, padY;
 
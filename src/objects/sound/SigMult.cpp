@@ -40,11 +40,10 @@ SigMult::SigMult() : PatchObject("amplifier"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
-    _inletParams[1] = new float();          // gain
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
+    *(float *)&_inletParams[1] = 0.0f;          // gain
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -188,7 +187,9 @@ void SigMult::audioInObject(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void SigMult::audioOutObject(ofSoundBuffer &outputBuffer){
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
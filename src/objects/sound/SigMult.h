@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 class SigMult : public PatchObject{
 
 public:
@@ -61,7 +63,7 @@ public:
 
     pdsp::Scope             scope;
     pdsp::Amp               gain;
-    pdsp::ValueControl      gain_ctrl;
+    ofxVPControlSignal      gain_ctrl;
 
     float                   gainValue;
 
@@ -40,10 +40,10 @@ SignalOperator::SignalOperator() : PatchObject("signal operator"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();
-    _inletParams[1] = new ofSoundBuffer();
+    this->newInletBuffer<ofSoundBuffer>(0);
+    this->newInletBuffer<ofSoundBuffer>(1);
 
-    _outletParams[0] = new ofSoundBuffer();
+    this->newOutletBuffer<ofSoundBuffer>(0);
 
     isAudioOUTObject        = true;
     isPDSPPatchableObject   = true;
@@ -40,12 +40,10 @@ SignalTrigger::SignalTrigger() : PatchObject("signal trigger"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio in
-    _inletParams[1] = new float();          // threshold
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio in
+    *(float *)&_inletParams[1] = 0.0f;          // threshold
 
-    _outletParams[0] = new float();         // signal trigger --> bang
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f;         // signal trigger --> bang
 
     this->initInletsState();
 
@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class SignalTrigger : public PatchObject{
@@ -64,7 +66,7 @@ public:
     pdsp::FullWavePeakDetector  peakDetector;
     pdsp::EnvelopeFollower      follower;
     pdsp::ToGateTrigger         toTrigger;
-    pdsp::ValueControl          thresh_ctrl;
+    ofxVPControlSignal          thresh_ctrl;
 
     ImVec4                      currentColor;
     ImVec4                      pressColor;
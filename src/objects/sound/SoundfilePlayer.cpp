@@ -40,21 +40,16 @@ SoundfilePlayer::SoundfilePlayer() : PatchObject("soundfile player"){
     this->numInlets  = 5;
     this->numOutlets = 3;
 
-    _inletParams[0] = new string();  // control
+    this->newInletBuffer<string>(0);  // control
     *static_cast<string *>(_inletParams[0]) = "";
-    _inletParams[1] = new float();  // playhead
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // speed
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();  // volume
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();  // trigger
-    *(float *)&_inletParams[4] = 0.0f;
-
-    _outletParams[0] = new ofSoundBuffer();  // signal
-    _outletParams[1] = new vector<float>(); // audio buffer
-    _outletParams[2] = new float();  // finish bang
-    *(float *)&_outletParams[2] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // playhead
+    *(float *)&_inletParams[2] = 0.0f;  // speed
+    *(float *)&_inletParams[3] = 0.0f;  // volume
+    *(float *)&_inletParams[4] = 0.0f;  // trigger
+
+    this->newOutletBuffer<ofSoundBuffer>(0);  // signal
+    this->newOutletBuffer<vector<float>>(1); // audio buffer
+    *(float *)&_outletParams[2] = 0.0f;  // finish bang
 
     this->initInletsState();
 
@@ -420,8 +415,12 @@ void SoundfilePlayer::audioOutObject(ofSoundBuffer &outputBuffer){
     }
 
     fileOUT.copyInput(lastBuffer.getBuffer().data(),lastBuffer.getNumFrames());
-    *static_cast<ofSoundBuffer *>(_outletParams[0]) = lastBuffer;
-    *static_cast<vector<float> *>(_outletParams[1]) = scope.getBuffer();
+    if(this->getIsOutletConnectedDSP(0)){
+        *static_cast<ofSoundBuffer *>(_outletParams[0]) = lastBuffer;
+    }
+    if(this->getIsOutletConnectedDSP(1)){
+        *static_cast<vector<float> *>(_outletParams[1]) = scope.getBuffer();
+    }
 
 }
 
@@ -40,20 +40,15 @@ pdspADSR::pdspADSR() : PatchObject("ADSR envelope"){
     this->numInlets  = 6;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer(); // audio input
+    this->newInletBuffer<ofSoundBuffer>(0); // audio input
 
-    _inletParams[1] = new float();          // bang
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // A
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // D
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();          // S
-    *(float *)&_inletParams[4] = 0.0f;
-    _inletParams[5] = new float();          // R
-    *(float *)&_inletParams[5] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;          // bang
+    *(float *)&_inletParams[2] = 0.0f;          // A
+    *(float *)&_inletParams[3] = 0.0f;          // D
+    *(float *)&_inletParams[4] = 0.0f;          // S
+    *(float *)&_inletParams[5] = 0.0f;          // R
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -261,7 +256,9 @@ void pdspADSR::loadAudioSettings(){
 //--------------------------------------------------------------
 void pdspADSR::audioOutObject(ofSoundBuffer &outputBuffer){
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 OBJECT_REGISTER( pdspADSR, "ADSR envelope", OFXVP_OBJECT_CAT_SOUND)
@@ -40,11 +40,10 @@ pdspBitCruncher::pdspBitCruncher() : PatchObject("bit cruncher"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio in
-    _inletParams[1] = new float();          // bits
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio in
+    *(float *)&_inletParams[1] = 0.0f;          // bits
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -189,7 +188,9 @@ void pdspBitCruncher::audioInObject(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void pdspBitCruncher::audioOutObject(ofSoundBuffer &outputBuffer){
     // STEREO SIGNAL BUFFERS
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
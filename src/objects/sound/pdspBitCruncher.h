@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 class pdspBitCruncher : public PatchObject{
 
 public:
@@ -62,7 +64,7 @@ public:
 
     pdsp::Bitcruncher       bitcruncher;
     pdsp::Scope             scope;
-    pdsp::ValueControl      bits_ctrl;
+    ofxVPControlSignal      bits_ctrl;
 
     float                   bits;
 
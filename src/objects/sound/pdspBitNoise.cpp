@@ -40,16 +40,13 @@ pdspBitNoise::pdspBitNoise() : PatchObject("bit noise"){
     this->numInlets  = 3;
     this->numOutlets = 3;
 
-    _inletParams[0] = new float();          // pitch
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();          // decimation
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // bits
-    *(float *)&_inletParams[2] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;          // pitch
+    *(float *)&_inletParams[1] = 0.0f;          // decimation
+    *(float *)&_inletParams[2] = 0.0f;          // bits
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output L
-    _outletParams[1] = new ofSoundBuffer(); // audio output R
-    _outletParams[2] = new vector<float>(); // audio buffer
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output L
+    this->newOutletBuffer<ofSoundBuffer>(1); // audio output R
+    this->newOutletBuffer<vector<float>>(2); // audio buffer
 
     this->initInletsState();
 
@@ -220,15 +217,20 @@ void pdspBitNoise::loadAudioSettings(){
 
 //--------------------------------------------------------------
 void pdspBitNoise::audioOutObject(ofSoundBuffer &outputBuffer){
-    for(size_t i = 0; i < scopeL.getBuffer().size(); i++) {
-        float sample = (scopeL.getBuffer().at(i) + scopeR.getBuffer().at(i))/2;
-
-        // SIGNAL BUFFER DATA
-        static_cast<vector<float> *>(_outletParams[2])->at(i) = sample;
+    // SIGNAL BUFFER DATA
+    if(this->getIsOutletConnectedDSP(2)){
+        vector<float> *data = static_cast<vector<float> *>(_outletParams[2]);
+        ofxVPMath::prepare(*data, scopeL.getBuffer().size());
+        ofxVPMath::add(scopeL.getBuffer().data(), scopeR.getBuffer().data(), data->data(), data->size());
+        ofxVPMath::mul(data->data(), 0.5f, data->data(), data->size());
     }
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scopeL.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scopeR.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scopeL.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(1)){
+        static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scopeR.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
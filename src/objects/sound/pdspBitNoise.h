@@ -36,6 +36,9 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+#include "vectorMath.h"
+
 #include "imgui_controls.h"
 
 class pdspBitNoise : public PatchObject{
@@ -64,9 +67,9 @@ public:
 
     pdsp::BitNoise          noise;
     pdsp::Scope             scopeL, scopeR;
-    pdsp::ValueControl      pitch_ctrl;
-    pdsp::ValueControl      decimation_ctrl;
-    pdsp::ValueControl      bits_ctrl;
+    ofxVPControlSignal      pitch_ctrl;
+    ofxVPControlSignal      decimation_ctrl;
+    ofxVPControlSignal      bits_ctrl;
     pdsp::PatchNode         trigger_in;
 
     float                   pitch;
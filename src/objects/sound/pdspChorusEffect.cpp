@@ -40,16 +40,13 @@ pdspChorusEffect::pdspChorusEffect() : PatchObject("dimension chorus"){
     this->numInlets  = 4;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
 
-    _inletParams[1] = new float();          // speed
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // depth
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // delay
-    *(float *)&_inletParams[3] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;          // speed
+    *(float *)&_inletParams[2] = 0.0f;          // depth
+    *(float *)&_inletParams[3] = 0.0f;          // delay
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -225,7 +222,9 @@ void pdspChorusEffect::audioInObject(ofSoundBuffer &inputBuffer){
 
 //--------------------------------------------------------------
 void pdspChorusEffect::audioOutObject(ofSoundBuffer &outputBuffer){
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
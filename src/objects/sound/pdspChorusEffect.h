@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class pdspChorusEffect : public PatchObject{
@@ -65,9 +67,9 @@ public:
 
     pdsp::DimensionChorus   chorus;
     pdsp::Scope             scope;
-    pdsp::ValueControl      speed_ctrl;
-    pdsp::ValueControl      depth_ctrl;
-    pdsp::ValueControl      delay_ctrl;
+    ofxVPControlSignal      speed_ctrl;
+    ofxVPControlSignal      depth_ctrl;
+    ofxVPControlSignal      delay_ctrl;
 
 
     float                   speed;
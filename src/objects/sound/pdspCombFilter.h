@@ -35,6 +35,8 @@
 #pragma once
 
 #include "PatchObject.h"
+
+#include "controlSignal.h"
 #include "imgui_controls.h"
 
 class pdspCombFilter : public PatchObject{
@@ -63,9 +65,9 @@ public:
 
     pdsp::CombFilter        filter;
     pdsp::Scope             scope;
-    pdsp::ValueControl      pitch_ctrl;
-    pdsp::ValueControl      damping_ctrl;
-    pdsp::ValueControl      feedback_ctrl;
+    ofxVPControlSignal      pitch_ctrl;
+    ofxVPControlSignal      damping_ctrl;
+    ofxVPControlSignal      feedback_ctrl;
 
     float                   pitch;
     float                   damping;
@@ -40,20 +40,15 @@ pdspCompressor::pdspCompressor() : PatchObject("compressor"){
     this->numInlets  = 6;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer(); // audio input
+    this->newInletBuffer<ofSoundBuffer>(0); // audio input
 
-    _inletParams[1] = new float();          // attack
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // release
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // thresh
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();          // ratio
-    *(float *)&_inletParams[4] = 0.0f;
-    _inletParams[5] = new float();          // knee
-    *(float *)&_inletParams[5] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;          // attack
+    *(float *)&_inletParams[2] = 0.0f;          // release
+    *(float *)&_inletParams[3] = 0.0f;          // thresh
+    *(float *)&_inletParams[4] = 0.0f;          // ratio
+    *(float *)&_inletParams[5] = 0.0f;          // knee
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -278,7 +273,9 @@ void pdspCompressor::loadAudioSettings(){
 //--------------------------------------------------------------
 void pdspCompressor::audioOutObject(ofSoundBuffer &outputBuffer){
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 OBJECT_REGISTER( pdspCompressor, "compressor", OFXVP_OBJECT_CAT_SOUND)
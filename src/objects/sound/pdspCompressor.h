@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class pdspCompressor : public PatchObject{
@@ -61,11 +63,11 @@ public:
 
 
     pdsp::Compressor        compressor;
-    pdsp::ValueControl      attack_ctrl;
-    pdsp::ValueControl      release_ctrl;
-    pdsp::ValueControl      thresh_ctrl;
-    pdsp::ValueControl      ratio_ctrl;
-    pdsp::ValueControl      knee_ctrl;
+    ofxVPControlSignal      attack_ctrl;
+    ofxVPControlSignal      release_ctrl;
+    ofxVPControlSignal      thresh_ctrl;
+    ofxVPControlSignal      ratio_ctrl;
+    ofxVPControlSignal      knee_ctrl;
     pdsp::Scope             scope;
 
     float                   attack;
@@ -40,13 +40,12 @@ pdspDataOscillator::pdspDataOscillator() : PatchObject("data oscillator"){
     this->numInlets  = 2;
     this->numOutlets = 2;
 
-    _inletParams[0] = new float();  // pitch
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // pitch
 
-    _inletParams[1] = new vector<float>(); // data
+    this->newInletBuffer<vector<float>>(1); // data
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
-    _outletParams[1] = new vector<float>(); // audio buffer
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
+    this->newOutletBuffer<vector<float>>(1); // audio buffer
 
     this->initInletsState();
 
@@ -58,6 +57,8 @@ pdspDataOscillator::pdspDataOscillator() : PatchObject("data oscillator"){
     loaded                  = false;
     reinitDataTable         = false;
 
+    plotVersion             = 0;
+
     this->height            *= 1.5f;
 
 }
@@ -177,7 +178,7 @@ void pdspDataOscillator::drawObjectNodeGui( ImGuiEx::NodeCanvas& _nodeCanvas ){
     if( _nodeCanvas.BeginNodeContent(ImGuiExNodeView_Visualise) ){
 
         // draw waveform
-        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y*0.5f), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor);
+        ImGuiEx::drawWaveform(_nodeCanvas.getNodeDrawList(), ImVec2(ImGui::GetWindowSize().x,ImGui::GetWindowSize().y*0.5f), plot_data, 1024, 1.3f, IM_COL32(255,255,120,255), this->scaleFactor, plotVersion.load());
 
         char temp[128];
         sprintf(temp,"%.2f Hz", pdsp::PitchToFreq::eval(ofClamp(pitch,0,127)));
@@ -233,15 +234,19 @@ void pdspDataOscillator::loadAudioSettings(){
 //--------------------------------------------------------------
 void pdspDataOscillator::audioOutObject(ofSoundBuffer &outputBuffer){
 
-    for(size_t i = 0; i < scope.getBuffer().size(); i++) {
-        float sample = scope.getBuffer().at(i);
-        plot_data[i] = hardClip(sample);
-
-        // SIGNAL BUFFER DATA
-        static_cast<vector<float> *>(_outletParams[1])->at(i) = sample;
+    const vector<float> &signal = scope.getBuffer();
+    for(size_t i = 0; i < signal.size(); i++) {
+        plot_data[i] = hardClip(signal[i]);
+    }
+    plotVersion++;
+    // SIGNAL BUFFER DATA
+    if(this->getIsOutletConnectedDSP(1)){
+        ofxVPMath::copy(signal.data(), signal.size(), *static_cast<vector<float> *>(_outletParams[1]));
     }
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
@@ -36,6 +36,9 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+#include "vectorMath.h"
+
 #include "imgui_controls.h"
 
 class pdspDataOscillator : public PatchObject{
@@ -64,11 +67,12 @@ public:
     pdsp::DataTable         datatable;
     pdsp::LowCut			leakDC;
     pdsp::Scope             scope;
-    pdsp::ValueControl      pitch_ctrl;
+    ofxVPControlSignal      pitch_ctrl;
 
     float                   pitch;
 
     float                   plot_data[1024];
+    std::atomic<uint64_t>   plotVersion;
     int                     bufferSize;
     int                     sampleRate;
 
@@ -40,11 +40,10 @@ pdspDecimator::pdspDecimator() : PatchObject("decimator"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
-    _inletParams[1] = new float();          // sample rate freq
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
+    *(float *)&_inletParams[1] = 0.0f;          // sample rate freq
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -186,7 +185,9 @@ void pdspDecimator::audioInObject(ofSoundBuffer &inputBuffer){
 //--------------------------------------------------------------
 void pdspDecimator::audioOutObject(ofSoundBuffer &outputBuffer){
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
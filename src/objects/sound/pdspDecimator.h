@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 class pdspDecimator : public PatchObject{
 
 public:
@@ -61,7 +63,7 @@ public:
 
     pdsp::Scope             scope;
     pdsp::Decimator         decimator;
-    pdsp::ValueControl      freq_ctrl;
+    ofxVPControlSignal      freq_ctrl;
 
     float                   freq;
 
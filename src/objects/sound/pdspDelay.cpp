@@ -42,16 +42,13 @@ pdspDelay::pdspDelay() : PatchObject("delay"){
     this->numInlets  = 4;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
 
-    _inletParams[1] = new float();          // time
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // damping
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // feedback
-    *(float *)&_inletParams[3] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;          // time
+    *(float *)&_inletParams[2] = 0.0f;          // damping
+    *(float *)&_inletParams[3] = 0.0f;          // feedback
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -221,7 +218,9 @@ void pdspDelay::audioInObject(ofSoundBuffer &inputBuffer){
 
 //--------------------------------------------------------------
 void pdspDelay::audioOutObject(ofSoundBuffer &outputBuffer){
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
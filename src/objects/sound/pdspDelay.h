@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class pdspDelay : public PatchObject{
@@ -63,9 +65,9 @@ public:
 
     pdsp::Delay             delay;
     pdsp::Scope             scope;
-    pdsp::ValueControl      time_ctrl;
-    pdsp::ValueControl      damping_ctrl;
-    pdsp::ValueControl      feedback_ctrl;
+    ofxVPControlSignal      time_ctrl;
+    ofxVPControlSignal      damping_ctrl;
+    ofxVPControlSignal      feedback_ctrl;
 
     float                   time;
     float                   damping;
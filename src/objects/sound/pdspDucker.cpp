@@ -40,20 +40,15 @@ pdspDucker::pdspDucker() : PatchObject("sidechain compressor"){
     this->numInlets  = 6;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer(); // audio input
+    this->newInletBuffer<ofSoundBuffer>(0); // audio input
 
-    _inletParams[1] = new float();          // bang
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // ducking
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // A
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();          // H
-    *(float *)&_inletParams[4] = 0.0f;
-    _inletParams[5] = new float();          // R
-    *(float *)&_inletParams[5] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;          // bang
+    *(float *)&_inletParams[2] = 0.0f;          // ducking
+    *(float *)&_inletParams[3] = 0.0f;          // A
+    *(float *)&_inletParams[4] = 0.0f;          // H
+    *(float *)&_inletParams[5] = 0.0f;          // R
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -280,7 +275,9 @@ void pdspDucker::loadAudioSettings(){
 //--------------------------------------------------------------
 void pdspDucker::audioOutObject(ofSoundBuffer &outputBuffer){
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
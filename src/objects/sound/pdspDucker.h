@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class pdspDucker : public PatchObject{
@@ -64,10 +66,10 @@ public:
     pdsp::Ducker            ducker;
     pdsp::Scope             scope;
     pdsp::TriggerControl    gate_ctrl;
-    pdsp::ValueControl      duck_ctrl;
-    pdsp::ValueControl      attack_ctrl;
-    pdsp::ValueControl      hold_ctrl;
-    pdsp::ValueControl      release_ctrl;
+    ofxVPControlSignal      duck_ctrl;
+    ofxVPControlSignal      attack_ctrl;
+    ofxVPControlSignal      hold_ctrl;
+    ofxVPControlSignal      release_ctrl;
 
     float                   ducking;
 
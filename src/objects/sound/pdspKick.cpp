@@ -40,16 +40,12 @@ pdspKick::pdspKick() : PatchObject("kick"){
     this->numInlets  = 4;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();          // bang
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();          // osc freq
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // filter freq
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // filter res
-    *(float *)&_inletParams[3] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;          // bang
+    *(float *)&_inletParams[1] = 0.0f;          // osc freq
+    *(float *)&_inletParams[2] = 0.0f;          // filter freq
+    *(float *)&_inletParams[3] = 0.0f;          // filter res
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -238,7 +234,9 @@ void pdspKick::loadAudioSettings(){
 //--------------------------------------------------------------
 void pdspKick::audioOutObject(ofSoundBuffer &outputBuffer){
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 
 }
 
@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class pdspKick : public PatchObject{
@@ -71,9 +73,9 @@ public:
     pdsp::ADSR              ampEnv;
     pdsp::ADSR              modEnv;
 
-    pdsp::ValueControl      osc_freq_ctrl;
-    pdsp::ValueControl      filter_freq_ctrl;
-    pdsp::ValueControl      filter_res_ctrl;
+    ofxVPControlSignal      osc_freq_ctrl;
+    ofxVPControlSignal      filter_freq_ctrl;
+    ofxVPControlSignal      filter_res_ctrl;
 
     pdsp::Scope             scope;
     pdsp::TriggerControl    gate_ctrl;
@@ -40,18 +40,15 @@ pdspLFO::pdspLFO() : PatchObject("lfo"){
     this->numInlets  = 3;
     this->numOutlets = 5;
 
-    _inletParams[0] = new float();  // retrig (bang)
-    *(float *)&_inletParams[0] = 0.0f;
-    _inletParams[1] = new float();  // frequency
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // phase
-    *(float *)&_inletParams[2] = 0.0f;
-
-    _outletParams[0] = new ofSoundBuffer(); // triangle LFO
-    _outletParams[1] = new ofSoundBuffer(); // sine     LFO
-    _outletParams[2] = new ofSoundBuffer(); // saw      LFO
-    _outletParams[3] = new ofSoundBuffer(); // square   LFO
-    _outletParams[4] = new ofSoundBuffer(); // random   LFO
+    *(float *)&_inletParams[0] = 0.0f;  // retrig (bang)
+    *(float *)&_inletParams[1] = 0.0f;  // frequency
+    *(float *)&_inletParams[2] = 0.0f;  // phase
+
+    this->newOutletBuffer<ofSoundBuffer>(0); // triangle LFO
+    this->newOutletBuffer<ofSoundBuffer>(1); // sine     LFO
+    this->newOutletBuffer<ofSoundBuffer>(2); // saw      LFO
+    this->newOutletBuffer<ofSoundBuffer>(3); // square   LFO
+    this->newOutletBuffer<ofSoundBuffer>(4); // random   LFO
 
     this->initInletsState();
 
@@ -228,11 +225,21 @@ void pdspLFO::loadAudioSettings(){
 //--------------------------------------------------------------
 void pdspLFO::audioOutObject(ofSoundBuffer &outputBuffer){
     // SIGNAL BUFFER
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope_tri.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scope_sine.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[2])->copyFrom(scope_saw.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[3])->copyFrom(scope_square.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[4])->copyFrom(scope_random.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope_tri.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(1)){
+        static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scope_sine.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(2)){
+        static_cast<ofSoundBuffer *>(_outletParams[2])->copyFrom(scope_saw.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(3)){
+        static_cast<ofSoundBuffer *>(_outletParams[3])->copyFrom(scope_square.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(4)){
+        static_cast<ofSoundBuffer *>(_outletParams[4])->copyFrom(scope_random.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
@@ -35,6 +35,8 @@
 #pragma once
 
 #include "PatchObject.h"
+
+#include "controlSignal.h"
 #include "imgui_controls.h"
 
 class pdspLFO : public PatchObject{
@@ -63,8 +65,8 @@ public:
     pdsp::LFO               lfo;
     pdsp::Scope             scope_tri, scope_sine, scope_saw, scope_square, scope_random;
     pdsp::TriggerControl    retrig_ctrl;
-    pdsp::ValueControl      pitch_ctrl;
-    pdsp::ValueControl      phase_ctrl;
+    ofxVPControlSignal      pitch_ctrl;
+    ofxVPControlSignal      phase_ctrl;
 
     float                   pitch;
     float                   phase;
@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 class pdspLowCut : public PatchObject{
 
 public:
@@ -61,7 +63,7 @@ public:
 
     pdsp::Scope             scope;
     pdsp::LowCut            filter;
-    pdsp::ValueControl      freq_ctrl;
+    ofxVPControlSignal      freq_ctrl;
 
     float                   freq;
 
@@ -40,16 +40,13 @@ pdspResonant2PoleFilter::pdspResonant2PoleFilter() : PatchObject("resonant filte
     this->numInlets  = 4;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
 
-    _inletParams[1] = new float();          // pitch
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // cutoff
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // resonance
-    *(float *)&_inletParams[3] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;          // pitch
+    *(float *)&_inletParams[2] = 0.0f;          // cutoff
+    *(float *)&_inletParams[3] = 0.0f;          // resonance
 
-    _outletParams[0] = new ofSoundBuffer(); // audio output
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output
 
     this->initInletsState();
 
@@ -248,7 +245,9 @@ void pdspResonant2PoleFilter::audioInObject(ofSoundBuffer &inputBuffer){
 
 //--------------------------------------------------------------
 void pdspResonant2PoleFilter::audioOutObject(ofSoundBuffer &outputBuffer){
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scope.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
@@ -35,6 +35,8 @@
 #pragma once
 
 #include "PatchObject.h"
+
+#include "controlSignal.h"
 #include "imgui_controls.h"
 
 enum Filter_Mode { Filter_Mode_LP, Filter_Mode_BP, Filter_Mode_HP, Filter_Mode_NOTCH, Filter_Mode_COUNT };
@@ -64,10 +66,10 @@ public:
 
     pdsp::SVFilter          filter;
     pdsp::Scope             scope;
-    pdsp::ValueControl      pitch_ctrl;
-    pdsp::ValueControl      cutoff_ctrl;
-    pdsp::ValueControl      resonance_ctrl;
-    pdsp::ValueControl      mode_ctrl;
+    ofxVPControlSignal      pitch_ctrl;
+    ofxVPControlSignal      cutoff_ctrl;
+    ofxVPControlSignal      resonance_ctrl;
+    ofxVPControlSignal      mode_ctrl;
 
     vector<string>          filterModesString;
     int                     filterMode;
@@ -40,21 +40,16 @@ pdspReverb::pdspReverb() : PatchObject("reverb"){
     this->numInlets  = 6;
     this->numOutlets = 2;
 
-    _inletParams[0] = new ofSoundBuffer();  // audio input
-
-    _inletParams[1] = new float();          // time
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();          // density
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();          // damping
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();          // modSpeed
-    *(float *)&_inletParams[4] = 0.0f;
-    _inletParams[5] = new float();          // mosAmount
-    *(float *)&_inletParams[5] = 0.0f;
-
-    _outletParams[0] = new ofSoundBuffer(); // audio output L
-    _outletParams[1] = new ofSoundBuffer(); // audio output R
+    this->newInletBuffer<ofSoundBuffer>(0);  // audio input
+
+    *(float *)&_inletParams[1] = 0.0f;          // time
+    *(float *)&_inletParams[2] = 0.0f;          // density
+    *(float *)&_inletParams[3] = 0.0f;          // damping
+    *(float *)&_inletParams[4] = 0.0f;          // modSpeed
+    *(float *)&_inletParams[5] = 0.0f;          // mosAmount
+
+    this->newOutletBuffer<ofSoundBuffer>(0); // audio output L
+    this->newOutletBuffer<ofSoundBuffer>(1); // audio output R
 
     this->initInletsState();
 
@@ -260,8 +255,12 @@ void pdspReverb::audioInObject(ofSoundBuffer &inputBuffer){
 
 //--------------------------------------------------------------
 void pdspReverb::audioOutObject(ofSoundBuffer &outputBuffer){
-    static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scopeL.getBuffer().data(), bufferSize, 1, sampleRate);
-    static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scopeR.getBuffer().data(), bufferSize, 1, sampleRate);
+    if(this->getIsOutletConnectedDSP(0)){
+        static_cast<ofSoundBuffer *>(_outletParams[0])->copyFrom(scopeL.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
+    if(this->getIsOutletConnectedDSP(1)){
+        static_cast<ofSoundBuffer *>(_outletParams[1])->copyFrom(scopeR.getBuffer().data(), bufferSize, 1, sampleRate);
+    }
 }
 
 
@@ -36,6 +36,8 @@
 
 #include "PatchObject.h"
 
+#include "controlSignal.h"
+
 #include "imgui_controls.h"
 
 class pdspReverb : public PatchObject{
@@ -63,11 +65,11 @@ public:
 
     pdsp::BasiVerb          reverb;
     pdsp::Scope             scopeL, scopeR;
-    pdsp::ValueControl      time_ctrl;
-    pdsp::ValueControl      density_ctrl;
-    pdsp::ValueControl      damping_ctrl;
-    pdsp::ValueControl      modSpeed_ctrl;
-    pdsp::ValueControl      modAmount_ctrl;
+    ofxVPControlSignal      time_ctrl;
+    ofxVPControlSignal      density_ctrl;
+    ofxVPControlSignal      damping_ctrl;
+    ofxVPControlSignal      modSpeed_ctrl;
+    ofxVPControlSignal      modAmount_ctrl;
 
     float                   time;
     float                   density;
@@ -40,74 +40,53 @@ pdspSequencer::pdspSequencer() : PatchObject("sequencer"){
     this->numInlets  = 5;
     this->numOutlets = 21;
 
-    _inletParams[0] = new vector<float>(); // S
-    _inletParams[1] = new vector<float>(); // A
-    _inletParams[2] = new vector<float>(); // B
-    _inletParams[3] = new vector<float>(); // C
-    _inletParams[4] = new vector<float>(); // D
+    this->newInletBuffer<vector<float>>(0); // S
+    this->newInletBuffer<vector<float>>(1); // A
+    this->newInletBuffer<vector<float>>(2); // B
+    this->newInletBuffer<vector<float>>(3); // C
+    this->newInletBuffer<vector<float>>(4); // D
 
-    _outletParams[0] = new float();          // step
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f;          // step
 
-    _outletParams[1] = new float();          // step
-    *(float *)&_outletParams[1] = 0.0f;
+    *(float *)&_outletParams[1] = 0.0f;          // step
 
-    _outletParams[2] = new float();          // step
-    *(float *)&_outletParams[2] = 0.0f;
+    *(float *)&_outletParams[2] = 0.0f;          // step
 
-    _outletParams[3] = new float();          // step
-    *(float *)&_outletParams[3] = 0.0f;
+    *(float *)&_outletParams[3] = 0.0f;          // step
 
-    _outletParams[4] = new float();          // step
-    *(float *)&_outletParams[4] = 0.0f;
+    *(float *)&_outletParams[4] = 0.0f;          // step
 
-    _outletParams[5] = new float();          // step
-    *(float *)&_outletParams[5] = 0.0f;
+    *(float *)&_outletParams[5] = 0.0f;          // step
 
-    _outletParams[6] = new float();          // step
-    *(float *)&_outletParams[6] = 0.0f;
+    *(float *)&_outletParams[6] = 0.0f;          // step
 
-    _outletParams[7] = new float();          // step
-    *(float *)&_outletParams[7] = 0.0f;
+    *(float *)&_outletParams[7] = 0.0f;          // step
 
-    _outletParams[8] = new float();          // step
-    *(float *)&_outletParams[8] = 0.0f;
+    *(float *)&_outletParams[8] = 0.0f;          // step
 
-    _outletParams[9] = new float();          // step
-    *(float *)&_outletParams[9] = 0.0f;
+    *(float *)&_outletParams[9] = 0.0f;          // step
 
-    _outletParams[10] = new float();          // step
-    *(float *)&_outletParams[10] = 0.0f;
+    *(float *)&_outletParams[10] = 0.0f;          // step
 
-    _outletParams[11] = new float();          // step
-    *(float *)&_outletParams[11] = 0.0f;
+    *(float *)&_outletParams[11] = 0.0f;          // step
 
-    _outletParams[12] = new float();          // step
-    *(float *)&_outletParams[12] = 0.0f;
+    *(float *)&_outletParams[12] = 0.0f;          // step
 
-    _outletParams[13] = new float();          // step
-    *(float *)&_outletParams[13] = 0.0f;
+    *(float *)&_outletParams[13] = 0.0f;          // step
 
-    _outletParams[14] = new float();          // step
-    *(float *)&_outletParams[14] = 0.0f;
+    *(float *)&_outletParams[14] = 0.0f;          // step
 
-    _outletParams[15] = new float();          // step
-    *(float *)&_outletParams[15] = 0.0f;
+    *(float *)&_outletParams[15] = 0.0f;          // step
 
-    _outletParams[16] = new float();          // S
-    *(float *)&_outletParams[16] = 0.0f;
+    *(float *)&_outletParams[16] = 0.0f;          // S
 
-    _outletParams[17] = new float();          // A
-    *(float *)&_outletParams[17] = 0.0f;
+    *(float *)&_outletParams[17] = 0.0f;          // A
 
-    _outletParams[18] = new float();          // B
-    *(float *)&_outletParams[18] = 0.0f;
+    *(float *)&_outletParams[18] = 0.0f;          // B
 
-    _outletParams[19] = new float();          // C
-    *(float *)&_outletParams[19] = 0.0f;
+    *(float *)&_outletParams[19] = 0.0f;          // C
 
-    _outletParams[20] = new float();          // D
-    *(float *)&_outletParams[20] = 0.0f;
+    *(float *)&_outletParams[20] = 0.0f;          // D
 
     this->initInletsState();
 
@@ -41,13 +41,11 @@ RandomString::RandomString() : PatchObject("random string")
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // bang
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // bang
 
-    _inletParams[1] = new float();  // length
-    *(float *)&_inletParams[1] = 1.0f;
+    *(float *)&_inletParams[1] = 1.0f;  // length
 
-    _outletParams[0] = new string();  // random string
+    this->newOutletBuffer<string>(0);  // random string
     *static_cast<string *>(_outletParams[0]) = "";
 
     this->initInletsState();
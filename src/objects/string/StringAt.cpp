@@ -40,12 +40,11 @@ StringAt::StringAt() : PatchObject("string at"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new string();             // input string
+    this->newInletBuffer<string>(0);             // input string
     *static_cast<string *>(_inletParams[0]) = "";
-    _inletParams[1] = new float();              // at
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;              // at
 
-    _outletParams[0] = new string();            // char
+    this->newOutletBuffer<string>(0);            // char
     *static_cast<string *>(_outletParams[0]) = "";
 
     this->initInletsState();
@@ -40,14 +40,14 @@ StringConcat::StringConcat() : PatchObject("string concat"){
     this->numInlets  = 6;
     this->numOutlets = 1;
 
-    _inletParams[0] = new string(); // string1
-    _inletParams[1] = new string(); // string2
-    _inletParams[2] = new string(); // string3
-    _inletParams[3] = new string(); // string4
-    _inletParams[4] = new string(); // string5
-    _inletParams[5] = new string(); // string6
+    this->newInletBuffer<string>(0); // string1
+    this->newInletBuffer<string>(1); // string2
+    this->newInletBuffer<string>(2); // string3
+    this->newInletBuffer<string>(3); // string4
+    this->newInletBuffer<string>(4); // string5
+    this->newInletBuffer<string>(5); // string6
 
-    _outletParams[0] = new string();  // final vector
+    this->newOutletBuffer<string>(0);  // final vector
 
     this->initInletsState();
 
@@ -225,7 +225,7 @@ void StringConcat::resetInletsSettings(){
     this->numInlets = dataInlets;
 
     for(size_t i=0;i<dataInlets;i++){
-        _inletParams[i] = new string();
+        this->newInletBuffer<string>(i);
     }
 
     this->inletsType.clear();
@@ -40,13 +40,11 @@ StringExtract::StringExtract() : PatchObject("string extract"){
     this->numInlets  = 3;
     this->numOutlets = 1;
 
-    _inletParams[0] = new string(); // data vector
-    _inletParams[1] = new float();  // start
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // end
-    *(float *)&_inletParams[2] = 0.0f;
+    this->newInletBuffer<string>(0); // data vector
+    *(float *)&_inletParams[1] = 0.0f;  // start
+    *(float *)&_inletParams[2] = 0.0f;  // end
 
-    _outletParams[0] = new string();  // final vector
+    this->newOutletBuffer<string>(0);  // final vector
 
     this->initInletsState();
 
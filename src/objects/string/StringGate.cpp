@@ -40,17 +40,16 @@ StringGate::StringGate() : PatchObject("string gate"){
     this->numInlets  = 7;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
-    _inletParams[1] = new string();  // string1
-    _inletParams[2] = new string();  // string2
-    _inletParams[3] = new string();  // string3
-    _inletParams[4] = new string();  // string4
-    _inletParams[5] = new string();  // string5
-    _inletParams[6] = new string();  // string6
+    this->newInletBuffer<string>(1);  // string1
+    this->newInletBuffer<string>(2);  // string2
+    this->newInletBuffer<string>(3);  // string3
+    this->newInletBuffer<string>(4);  // string4
+    this->newInletBuffer<string>(5);  // string5
+    this->newInletBuffer<string>(6);  // string6
 
-    _outletParams[0] = new string(); // output
+    this->newOutletBuffer<string>(0); // output
 
     dataInlets      = 6;
 
@@ -235,11 +234,10 @@ void StringGate::resetInletsSettings(){
 
     this->numInlets = dataInlets+1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
     for(size_t i=1;i<this->numInlets;i++){
-        _inletParams[i] = new string();
+        this->newInletBuffer<string>(i);
     }
 
     this->inletsType.clear();
@@ -38,11 +38,15 @@
 KinectGrabber::KinectGrabber() : PatchObject("kinect grabber"){
 
     this->numInlets  = 0;
-    this->numOutlets = 2;
+    this->numOutlets = 4;
 
-    _outletParams[0] = new ofTexture(); // video (IR or RGB)
-    _outletParams[1] = new ofTexture(); // depth
-    _outletParams[2] = new ofxKinect(); // kinect reference
+    this->newOutletBuffer<ofTexture>(0); // video (IR or RGB)
+    this->newOutletBuffer<ofTexture>(1); // depth
+    this->newOutletBuffer<ofPixels>(2); // video pixels, the kinect ones once running
+    this->newOutletBuffer<ofPixels>(3); // depth pixels, the kinect ones once running
+
+    // owned by the port buffer pool: destroyed only once no link can point to its pixels
+    kinect = ofxVPPortBufferPool::get().acquire<ofxKinect>();
 
     this->initInletsState();
 
@@ -62,6 +66,10 @@ KinectGrabber::KinectGrabber() : PatchObject("kinect grabber"){
     needReset           = false;
 
     weHaveKinect        = false;
+    textureDirty        = false;
+
+    // outlets change only with a new kinect frame
+    this->setTracksOutletChanges(true);
 
     loaded                  = false;
 
@@ -78,6 +86,8 @@ void KinectGrabber::newObject(){
 
     this->addOutlet(VP_LINK_TEXTURE,"kinectImage");
     this->addOutlet(VP_LINK_TEXTURE,"kinectDepth");
+    this->addOutlet(VP_LINK_PIXELS,"kinectPixels");
+    this->addOutlet(VP_LINK_PIXELS,"kinectDepthPixels");
 
     this->setCustomVar(static_cast<float>(deviceID),"DEVICE_ID");
     this->setCustomVar(static_cast<float>(isIR),"INFRARED");
@@ -124,10 +134,11 @@ void KinectGrabber::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
 
             loadKinectSettings();
 
-            static_cast<ofxKinect *>(_outletParams[2])->setRegistration(true);
-            static_cast<ofxKinect *>(_outletParams[2])->init(isIR,true,true);
-            static_cast<ofxKinect *>(_outletParams[2])->open(deviceID);
-            static_cast<ofxKinect *>(_outletParams[2])->setCameraTiltAngle(0);
+            // no kinect textures, the outlet ones are uploaded only when needed
+            kinect->setRegistration(true);
+            kinect->init(isIR,true,false);
+            kinect->open(deviceID);
+            kinect->setCameraTiltAngle(0);
 
         }
     }
@@ -138,30 +149,46 @@ void KinectGrabber::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchO
 void KinectGrabber::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
 
     // KINECT UPDATE
-    if(weHaveKinect && static_cast<ofxKinect *>(_outletParams[2])->isInitialized() && static_cast<ofxKinect *>(_outletParams[2])->isConnected()){
-        static_cast<ofxKinect *>(_outletParams[2])->update();
-        if(static_cast<ofxKinect *>(_outletParams[2])->isFrameNew()){
-            *static_cast<ofTexture *>(_outletParams[0]) = static_cast<ofxKinect *>(_outletParams[2])->getTexture();
-
-            cleanImage.setFromPixels(static_cast<ofxKinect *>(_outletParams[2])->getDepthPixels());
-            cleanImage.updateTexture();
-
-            grayThreshNear = cleanImage;
-            grayThreshFar = cleanImage;
-            grayThreshNear.threshold(nearThreshold, true);
-            grayThreshFar.threshold(farThreshold);
-
-            grayThreshNear.updateTexture();
-            grayThreshFar.updateTexture();
-
-            cvAnd(grayThreshNear.getCvImage(), grayThreshFar.getCvImage(), cleanImage.getCvImage(), nullptr);
-            cleanImage.flagImageChanged();
-            cleanImage.updateTexture();
-
-            colorCleanImage = cleanImage;
-            colorCleanImage.updateTexture();
+    if(weHaveKinect && kinect->isInitialized() && kinect->isConnected()){
+        kinect->update();
+        if(kinect->isFrameNew()){
+            // the kinect pixels are the pixels outlets themselves, no copy
+            this->shareOutletBuffer(2,&kinect->getPixels());
+            this->shareOutletBuffer(3,&kinect->getDepthPixels());
+            this->markOutletChanged(2);
+            this->markOutletChanged(3);
+            textureDirty = true;
+
+            // depth cleaning only for a connected depth outlet
+            if(this->getIsOutletConnected(1)){
+                cleanImage.setFromPixels(kinect->getDepthPixels());
+
+                grayThreshNear = cleanImage;
+                grayThreshFar = cleanImage;
+                grayThreshNear.threshold(nearThreshold, true);
+                grayThreshFar.threshold(farThreshold);
+
+                cvAnd(grayThreshNear.getCvImage(), grayThreshFar.getCvImage(), cleanImage.getCvImage(), nullptr);
+                cleanImage.flagImageChanged();
+
+                colorCleanImage = cleanImage;
+                colorCleanImage.updateTexture();
+
+                *static_cast<ofTexture *>(_outletParams[1]) = colorCleanImage.getTexture();
+                this->markOutletChanged(1);
+            }
+        }
 
-            *static_cast<ofTexture *>(_outletParams[1]) = colorCleanImage.getTexture();
+        // upload only for a texture consumer: a link or the node preview
+        if(textureDirty && (this->getIsOutletConnected(0) || scaledObjW*canvasZoom > 90.0f)){
+            textureDirty = false;
+            const ofPixels &frame = kinect->getPixels();
+            if(frame.getWidth() != static_cast<ofTexture *>(_outletParams[0])->getWidth() || frame.getHeight() != static_cast<ofTexture *>(_outletParams[0])->getHeight()){
+                this->newOutletBuffer<ofTexture>(0);
+                static_cast<ofTexture *>(_outletParams[0])->allocate(frame.getWidth(),frame.getHeight(),ofGetGLInternalFormat(frame));
+            }
+            static_cast<ofTexture *>(_outletParams[0])->loadData(frame);
+            this->markOutletChanged(0);
         }
     }
 
@@ -176,7 +203,7 @@ void KinectGrabber::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLR
     }
 
     // kinect image
-    if(weHaveKinect && static_cast<ofxKinect *>(_outletParams[2])->isInitialized() && static_cast<ofxKinect *>(_outletParams[2])->isConnected() && static_cast<ofTexture *>(_outletParams[0])->isAllocated()){
+    if(weHaveKinect && kinect->isInitialized() && kinect->isConnected() && static_cast<ofTexture *>(_outletParams[0])->isAllocated()){
         ofSetColor(255);
         drawNodeOFTexture(*static_cast<ofTexture *>(_outletParams[0]), posX, posY, drawW, drawH, objOriginX, objOriginY, scaledObjW, scaledObjH, canvasZoom, this->scaleFactor);
     }
@@ -273,8 +300,13 @@ void KinectGrabber::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void KinectGrabber::removeObjectContent(bool removeFileFromData){
-    static_cast<ofxKinect *>(_outletParams[2])->setCameraTiltAngle(0);
-    static_cast<ofxKinect *>(_outletParams[2])->close();
+    this->shareOutletBuffer(2,nullptr);
+    this->shareOutletBuffer(3,nullptr);
+    kinect->setCameraTiltAngle(0);
+    kinect->close();
+    ofxVPPortBufferPool::get().release(kinect);
+    kinect = nullptr;
+    weHaveKinect = false;
 }
 
 //--------------------------------------------------------------
@@ -309,14 +341,8 @@ void KinectGrabber::resetKinectSettings(int devID){
         this->setCustomVar(static_cast<float>(deviceID),"DEVICE_ID");
 
 
-        if(static_cast<ofxKinect *>(_outletParams[2])->isInitialized()){
-            static_cast<ofxKinect *>(_outletParams[2])->setCameraTiltAngle(0);
-            static_cast<ofxKinect *>(_outletParams[2])->close();
-
-            _outletParams[2] = new ofxKinect();
-            static_cast<ofxKinect *>(_outletParams[2])->setRegistration(true);
-            static_cast<ofxKinect *>(_outletParams[2])->init(isIR,true,true);
-            static_cast<ofxKinect *>(_outletParams[2])->open(deviceID);
+        if(kinect->isInitialized()){
+            openKinect(isIR);
         }
     }
 }
@@ -330,19 +356,29 @@ void KinectGrabber::resetKinectImage(bool ir){
 
         this->setCustomVar(static_cast<float>(ir),"INFRARED");
 
-        if(static_cast<ofxKinect *>(_outletParams[2])->isInitialized()){
-            static_cast<ofxKinect *>(_outletParams[2])->setCameraTiltAngle(0);
-            static_cast<ofxKinect *>(_outletParams[2])->close();
-
-            _outletParams[2] = new ofxKinect();
-            static_cast<ofxKinect *>(_outletParams[2])->setRegistration(true);
-            static_cast<ofxKinect *>(_outletParams[2])->init(ir,true,true);
-            static_cast<ofxKinect *>(_outletParams[2])->open(deviceID);
+        if(kinect->isInitialized()){
+            openKinect(ir);
         }
     }
 
 }
 
+//--------------------------------------------------------------
+void KinectGrabber::openKinect(bool ir){
+    this->shareOutletBuffer(2,nullptr);
+    this->shareOutletBuffer(3,nullptr);
+    textureDirty = false;
+
+    kinect->setCameraTiltAngle(0);
+    kinect->close();
+
+    // the old device is destroyed by the pool once no link can point to its pixels
+    ofxVPPortBufferPool::get().release(kinect);
+    kinect = ofxVPPortBufferPool::get().acquire<ofxKinect>();
+    kinect->setRegistration(true);
+    kinect->init(ir,true,false);
+    kinect->open(deviceID);
+}
 
 OBJECT_REGISTER( KinectGrabber, "kinect grabber", OFXVP_OBJECT_CAT_TEXTURE)
 
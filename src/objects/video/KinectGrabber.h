@@ -60,8 +60,10 @@ public:
     void            loadKinectSettings();
     void            resetKinectSettings(int devID);
     void            resetKinectImage(bool ir);
+    void            openKinect(bool ir);
 
 
+    ofxKinect*          kinect;
     ofxCvColorImage     colorCleanImage;
     ofxCvGrayscaleImage	cleanImage;
     ofxCvGrayscaleImage grayThreshNear;
@@ -76,6 +78,7 @@ public:
     float               farThreshold;
     bool                needReset;
     bool                weHaveKinect;
+    bool                textureDirty;
 
     float               posX, posY, drawW, drawH;
     bool                isNewObject;
@@ -40,12 +40,15 @@ PixelsToTexture::PixelsToTexture() : PatchObject("pixels to texture"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofPixels();  // pixels
+    this->newInletBuffer<ofPixels>(0);  // pixels
 
-    _outletParams[0] = new ofTexture(); // texture
+    this->newOutletBuffer<ofTexture>(0); // texture
 
     this->initInletsState();
 
+    // the output changes only with the input pixels
+    this->setTracksOutletChanges(true);
+
     this->height     /= 2;
 
 }
@@ -75,6 +78,9 @@ void PixelsToTexture::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseG
     if(this->inletsConnected[0]){
         if(static_cast<ofPixels *>(_inletParams[0])->getWidth() > 0 && static_cast<ofPixels *>(_inletParams[0])->getHeight() > 0){
             static_cast<ofTexture *>(_outletParams[0])->loadData(*static_cast<ofPixels *>(_inletParams[0]));
+            if(this->inputsChanged()){
+                this->markOutletChanged(0);
+            }
         }
     }
 
@@ -40,12 +40,15 @@ TextureToPixels::TextureToPixels() : PatchObject("texture to pixels"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // texture
+    this->newInletBuffer<ofTexture>(0);  // texture
 
-    _outletParams[0] = new ofPixels(); // pixels
+    this->newOutletBuffer<ofPixels>(0); // pixels
 
     this->initInletsState();
 
+    // the output changes only with the input texture
+    this->setTracksOutletChanges(true);
+
     this->height     /= 2;
 
 }
@@ -73,6 +76,9 @@ void TextureToPixels::updateObjectContent(map<int,shared_ptr<PatchObject>> &patc
 void TextureToPixels::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated()){
         static_cast<ofTexture *>(_inletParams[0])->readToPixels(*static_cast<ofPixels *>(_outletParams[0]));
+        if(this->inputsChanged()){
+            this->markOutletChanged(0);
+        }
     }
 }
 
@@ -43,12 +43,15 @@ ToGrayScaleTexture::ToGrayScaleTexture() : PatchObject("to grayscale texture"){
     this->numInlets  = 1;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
+    this->newInletBuffer<ofTexture>(0);  // input
 
-    _outletParams[0] = new ofTexture(); // output
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
+    // the output changes only with the input texture
+    this->setTracksOutletChanges(true);
+
     resetTextures(320,240);
 
     posX = posY = drawW = drawH = 0.0f;
@@ -104,6 +107,9 @@ void ToGrayScaleTexture::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBa
         grayImg->updateTexture();
 
         *static_cast<ofTexture *>(_outletParams[0]) = grayImg->getTexture();
+        if(this->inputsChanged()){
+            this->markOutletChanged(0);
+        }
 
     }else if(!this->inletsConnected[0]){
         newConnection = false;
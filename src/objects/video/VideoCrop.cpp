@@ -40,21 +40,20 @@ VideoCrop::VideoCrop() : PatchObject("texture crop"){
     this->numInlets  = 5;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
-    _inletParams[1] = new float();      // x
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();      // y
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();      // w
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();      // h
-    *(float *)&_inletParams[4] = 0.0f;
-
-    _outletParams[0] = new ofTexture(); // output
+    this->newInletBuffer<ofTexture>(0);  // input
+    *(float *)&_inletParams[1] = 0.0f;      // x
+    *(float *)&_inletParams[2] = 0.0f;      // y
+    *(float *)&_inletParams[3] = 0.0f;      // w
+    *(float *)&_inletParams[4] = 0.0f;      // h
+
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
-    croppedFbo  = new ofFbo();
+    // the output changes only with the input texture and the crop
+    this->setTracksOutletChanges(true);
+
+    croppedFbo  = nullptr;
     needToGrab  = false;
 
     posX = posY = drawW = drawH = 0.0f;
@@ -145,7 +144,8 @@ void VideoCrop::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRende
         if(static_cast<ofTexture *>(_inletParams[0])->isAllocated()){
             if(!needToGrab){
                 needToGrab = true;
-                croppedFbo->allocate(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), GL_RGBA );
+                ofxVPFboPool::get().release(croppedFbo);
+                croppedFbo = ofxVPFboPool::get().acquire(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), GL_RGBA, 0, this->getId());
                 _maxW = static_cast<ofTexture *>(_inletParams[0])->getWidth();
                 _maxH = static_cast<ofTexture *>(_inletParams[0])->getHeight();
             }
@@ -158,6 +158,9 @@ void VideoCrop::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRende
             croppedFbo->end();
 
             *static_cast<ofTexture *>(_outletParams[0]) = croppedFbo->getTexture();
+            if(this->inputsChanged()){
+                this->markOutletChanged(0);
+            }
         }
     }else{
         needToGrab = false;
@@ -247,7 +250,8 @@ void VideoCrop::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void VideoCrop::removeObjectContent(bool removeFileFromData){
-    
+    ofxVPFboPool::get().release(croppedFbo);
+    croppedFbo = nullptr;
 }
 
 //--------------------------------------------------------------
@@ -40,24 +40,23 @@ VideoDelay::VideoDelay() : PatchObject("video feedback"){
     this->numInlets  = 5;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
-    _inletParams[1] = new float();      // x
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();      // y
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();      // scale
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();      // alpha
-    *(float *)&_inletParams[4] = 0.0f;
-
-    _outletParams[0] = new ofTexture(); // output
+    this->newInletBuffer<ofTexture>(0);  // input
+    *(float *)&_inletParams[1] = 0.0f;      // x
+    *(float *)&_inletParams[2] = 0.0f;      // y
+    *(float *)&_inletParams[3] = 0.0f;      // scale
+    *(float *)&_inletParams[4] = 0.0f;      // alpha
+
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
+    // the feedback keeps changing the output on every drawn frame
+    this->setTracksOutletChanges(true);
+
     posX = posY = drawW = drawH = 0.0f;
 
     backBufferTex   = new ofTexture();
-    delayFbo        = new ofFbo();
+    delayFbo        = nullptr;
 
     _x              = 0.0f;
     _y              = 0.0f;
@@ -138,7 +137,8 @@ void VideoDelay::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRend
         if(!needToGrab){
             needToGrab = true;
             backBufferTex->allocate(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), GL_RGB);
-            delayFbo->allocate(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), GL_RGBA);
+            ofxVPFboPool::get().release(delayFbo);
+            delayFbo = ofxVPFboPool::get().acquire(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), GL_RGBA, 0, this->getId());
             delayFbo->begin();
             glColor4f(0.0f,0.0f,0.0f,1.0f);
             ofDrawRectangle(0,0,static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight());
@@ -161,6 +161,7 @@ void VideoDelay::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRend
         delayFbo->end();
 
         *static_cast<ofTexture *>(_outletParams[0]) = delayFbo->getTexture();
+        this->markOutletChanged(0);
     }else{
         needToGrab = false;
     }
@@ -241,7 +242,8 @@ void VideoDelay::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void VideoDelay::removeObjectContent(bool removeFileFromData){
-    
+    ofxVPFboPool::get().release(delayFbo);
+    delayFbo = nullptr;
 }
 
 OBJECT_REGISTER( VideoDelay, "video feedback", OFXVP_OBJECT_CAT_TEXTURE)
@@ -43,10 +43,9 @@ VideoExporter::VideoExporter() :
     this->numInlets  = 2;
     this->numOutlets = 0;
 
-    _inletParams[0] = new ofTexture(); // input
+    this->newInletBuffer<ofTexture>(0); // input
 
-    _inletParams[1] = new float();  // bang
-    *(float *)&_inletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // bang
 
     this->initInletsState();
 
@@ -40,20 +40,22 @@ VideoGate::VideoGate() : PatchObject("texture gate"){
     this->numInlets  = 7;
     this->numOutlets = 1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
-    _inletParams[1] = new ofTexture();  // tex1
-    _inletParams[2] = new ofTexture();  // tex2
-    _inletParams[3] = new ofTexture();  // tex3
-    _inletParams[4] = new ofTexture();  // tex4
-    _inletParams[5] = new ofTexture();  // tex5
-    _inletParams[6] = new ofTexture();  // tex6
+    this->newInletBuffer<ofTexture>(1);  // tex1
+    this->newInletBuffer<ofTexture>(2);  // tex2
+    this->newInletBuffer<ofTexture>(3);  // tex3
+    this->newInletBuffer<ofTexture>(4);  // tex4
+    this->newInletBuffer<ofTexture>(5);  // tex5
+    this->newInletBuffer<ofTexture>(6);  // tex6
 
-    _outletParams[0] = new ofTexture(); // texture output
+    this->newOutletBuffer<ofTexture>(0); // texture output
 
     this->initInletsState();
 
+    // the output changes only with the inputs and the open inlet
+    this->setTracksOutletChanges(true);
+
     dataInlets      = 6;
 
     needReset       = false;
@@ -118,6 +120,9 @@ void VideoGate::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjec
     }else if(openInlet == 0){
         *static_cast<ofTexture *>(_outletParams[0]) = *kuroTex;
     }
+    if(this->inputsChanged()){
+        this->markOutletChanged(0);
+    }
 
     if(needReset){
         needReset = false;
@@ -247,11 +252,10 @@ void VideoGate::resetInletsSettings(){
 
     this->numInlets = dataInlets+1;
 
-    _inletParams[0] = new float();  // open
-    *(float *)&_inletParams[0] = 0.0f;
+    *(float *)&_inletParams[0] = 0.0f;  // open
 
     for(size_t i=1;i<this->numInlets;i++){
-        _inletParams[i] = new ofTexture();
+        this->newInletBuffer<ofTexture>(i);
     }
 
     this->inletsType.clear();
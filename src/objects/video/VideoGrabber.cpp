@@ -41,14 +41,14 @@ VideoGrabber::VideoGrabber() :
 {
 
     this->numInlets  = 0;
-    this->numOutlets = 1;
+    this->numOutlets = 2;
 
-    _outletParams[0] = new ofTexture(); // output
+    this->newOutletBuffer<ofTexture>(0); // output
+    this->newOutletBuffer<ofPixels>(1); // output pixels, the captured frame itself once running
 
     this->initInletsState();
 
-    vidGrabber  = new ofVideoGrabber();
-    colorImage  = new ofxCvColorImage();
+    capture     = new ThreadedCapture();
 
     isNewObject         = false;
 
@@ -64,6 +64,11 @@ VideoGrabber::VideoGrabber() :
 
     hMirror             = false;
     vMirror             = false;
+    textureDirty        = false;
+    fakeDevice          = ThreadedCapture::getFakeDevice();
+
+    // outlets change only with a new captured frame
+    this->setTracksOutletChanges(true);
 
     needReset               = false;
     isOneDeviceAvailable    = false;
@@ -82,6 +87,7 @@ void VideoGrabber::newObject(){
     PatchObject::setName( this->objectName );
 
     this->addOutlet(VP_LINK_TEXTURE,"deviceImage");
+    this->addOutlet(VP_LINK_PIXELS,"devicePixels");
 
     this->setCustomVar(static_cast<float>(camWidth),"CAM_WIDTH");
     this->setCustomVar(static_cast<float>(camHeight),"CAM_HEIGHT");
@@ -96,7 +102,8 @@ void VideoGrabber::newObject(){
 //--------------------------------------------------------------
 void VideoGrabber::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
-    wdevices = vidGrabber->listDevices();
+    ofVideoGrabber lister;
+    wdevices = lister.listDevices();
     for(int i=0;i<static_cast<int>(wdevices.size());i++){
         if(wdevices[i].bAvailable){
             isOneDeviceAvailable = true;
@@ -110,6 +117,14 @@ void VideoGrabber::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
         }
     }
 
+    // fake device, always the last one
+    if(fakeDevice != ""){
+        ofFile tempFile(fakeDevice);
+        isOneDeviceAvailable = true;
+        devicesVector.push_back("file: "+tempFile.getFileName());
+        devicesID.push_back(-1);
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -134,27 +149,34 @@ void VideoGrabber::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
 
             loadCameraSettings();
 
-            vidGrabber->setDeviceID(deviceID);
-            vidGrabber->setup(camWidth, camHeight);
+            openDevice();
             resetCameraSettings(deviceID);
 
         }
     }
 
+    // the captured frame is the pixels outlet itself, no copy
+    if(capture->receiveFrame()){
+        this->shareOutletBuffer(1,capture->getFrameBuffer());
+        this->markOutletChanged(1);
+        textureDirty = true;
+    }
+
 }
 
 //--------------------------------------------------------------
 void VideoGrabber::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
 
-    if(vidGrabber->isInitialized()){
-        vidGrabber->update();
-        if(vidGrabber->isFrameNew()){
-            colorImage->setFromPixels(vidGrabber->getPixels());
-            colorImage->mirror(vMirror,hMirror);
-            colorImage->updateTexture();
-
-            *static_cast<ofTexture *>(_outletParams[0]) = colorImage->getTexture();
+    // upload only for a texture consumer: a link or the node preview
+    if(textureDirty && (this->getIsOutletConnected(0) || scaledObjW*canvasZoom > 90.0f)){
+        textureDirty = false;
+        const ofPixels &frame = capture->getFrame();
+        if(frame.getWidth() != static_cast<ofTexture *>(_outletParams[0])->getWidth() || frame.getHeight() != static_cast<ofTexture *>(_outletParams[0])->getHeight()){
+            this->newOutletBuffer<ofTexture>(0);
+            static_cast<ofTexture *>(_outletParams[0])->allocate(frame.getWidth(),frame.getHeight(),ofGetGLInternalFormat(frame));
         }
+        static_cast<ofTexture *>(_outletParams[0])->loadData(frame);
+        this->markOutletChanged(0);
     }
 
     // background
@@ -168,7 +190,7 @@ void VideoGrabber::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRe
     }
 
     if(isOneDeviceAvailable){
-        if(vidGrabber->isInitialized() && !needReset){
+        if(capture->isInitialized() && !needReset && static_cast<ofTexture *>(_outletParams[0])->isAllocated()){
             if(scaledObjW*canvasZoom > 90.0f){
                 // draw node texture preview with OF
                 ofSetColor(255);
@@ -230,6 +252,11 @@ void VideoGrabber::drawObjectNodeConfig(){
     ImGui::Spacing();
     ImGui::Text("%s",deviceName.c_str());
     ImGui::Text("Format: %ix%i",camWidth,camHeight);
+    if(capture->isInitialized()){
+        CaptureStats captureStats = capture->getStats();
+        ImGui::Text("Capture %.2f ms, %.1f fps",captureStats.captureMs,captureStats.fps);
+        ImGui::Text("Frames %llu, dropped %llu",static_cast<unsigned long long>(captureStats.framesCaptured),static_cast<unsigned long long>(captureStats.framesDropped));
+    }
 
     ImGui::Spacing();
     if(ImGui::BeginCombo("Device", devicesVector.at(deviceID).c_str() )){
@@ -246,10 +273,12 @@ void VideoGrabber::drawObjectNodeConfig(){
 
     ImGui::Spacing();
     if(ImGui::Checkbox("HORIZONTAL MIRROR",&hMirror)){
+        capture->setMirror(hMirror,vMirror);
         this->setCustomVar(static_cast<float>(hMirror),"MIRROR_H");
     }
     ImGui::Spacing();
     if(ImGui::Checkbox("VERTICAL MIRROR",&vMirror)){
+        capture->setMirror(hMirror,vMirror);
         this->setCustomVar(static_cast<float>(vMirror),"MIRROR_V");
     }
 
@@ -272,13 +301,14 @@ void VideoGrabber::drawObjectNodeConfig(){
     }
 
     ImGuiEx::ObjectInfo(
-                "Opens a compatible video input/webcam device",
+                "Opens a compatible video input/webcam device. Frames are grabbed on a separate thread, the pixels outlet sends them with no copy and no GPU readback. Set OFXVP_FAKE_CAMERA to a video file to list it as a fake device.",
                 "https://mosaic.d3cod3.org/reference.php?r=video-grabber", scaleFactor);
 }
 
 //--------------------------------------------------------------
 void VideoGrabber::removeObjectContent(bool removeFileFromData){
-    vidGrabber->close();
+    this->shareOutletBuffer(1,nullptr);
+    capture->close();
 }
 
 //--------------------------------------------------------------
@@ -290,10 +320,7 @@ void VideoGrabber::loadCameraSettings(){
         temp_width      = camWidth;
         temp_height     = camHeight;
 
-        colorImage    = new ofxCvColorImage();
-        colorImage->allocate(camWidth,camHeight);
-
-        _outletParams[0] = new ofTexture();
+        this->newOutletBuffer<ofTexture>(0);
         static_cast<ofTexture *>(_outletParams[0])->allocate(camWidth,camHeight,GL_RGB);
 
     }
@@ -334,20 +361,13 @@ void VideoGrabber::resetCameraSettings(int devID){
             this->setCustomVar(static_cast<float>(camWidth),"CAM_WIDTH");
             this->setCustomVar(static_cast<float>(camHeight),"CAM_HEIGHT");
 
-            colorImage    = new ofxCvColorImage();
-            colorImage->allocate(camWidth,camHeight);
-
-            _outletParams[0] = new ofTexture();
+            this->newOutletBuffer<ofTexture>(0);
             static_cast<ofTexture *>(_outletParams[0])->allocate(camWidth,camHeight,GL_RGB);
 
         }
 
-        if(vidGrabber->isInitialized()){
-            vidGrabber->close();
-
-            vidGrabber = new ofVideoGrabber();
-            vidGrabber->setDeviceID(deviceID);
-            vidGrabber->setup(camWidth, camHeight);
+        if(capture->isInitialized()){
+            openDevice();
         }
     }
 
@@ -356,6 +376,20 @@ void VideoGrabber::resetCameraSettings(int devID){
     needReset = false;
 }
 
+//--------------------------------------------------------------
+void VideoGrabber::openDevice(){
+    // the frames of the closing device can't be linked anymore
+    this->shareOutletBuffer(1,nullptr);
+    textureDirty = false;
+
+    capture->setMirror(hMirror,vMirror);
+    if(devicesID[deviceID] == -1){
+        capture->setupFile(fakeDevice);
+    }else{
+        capture->setup(deviceID,camWidth,camHeight);
+    }
+}
+
 OBJECT_REGISTER( VideoGrabber, "video grabber", OFXVP_OBJECT_CAT_TEXTURE)
 
 #endif
@@ -36,7 +36,7 @@
 
 #include "PatchObject.h"
 
-#include "ofxOpenCv.h"
+#include "ThreadedCapture.h"
 
 #define CAM_MAX_WIDTH        1920
 #define CAM_MAX_HEIGHT       1080
@@ -58,9 +58,9 @@ public:
 
     void            loadCameraSettings();
     void            resetCameraSettings(int devID);
+    void            openDevice();
 
-    ofVideoGrabber*         vidGrabber;
-    ofxCvColorImage*        colorImage;
+    ThreadedCapture*        capture;
     vector<ofVideoDevice>   wdevices;
     vector<string>          devicesVector;
     vector<int>             devicesID;
@@ -74,6 +74,8 @@ public:
     bool                    isOneDeviceAvailable;
 
     bool                    hMirror, vMirror;
+    bool                    textureDirty;
+    string                  fakeDevice;
 
     float                   posX, posY, drawW, drawH;
     bool                    isNewObject;
@@ -40,24 +40,26 @@ VideoPlayer::VideoPlayer() : PatchObject("video player"){
     this->numInlets  = 5;
     this->numOutlets = 2;
 
-    _inletParams[0] = new string();  // control
+    this->newInletBuffer<string>(0);  // control
     *static_cast<string *>(_inletParams[0]) = "";
-    _inletParams[1] = new float();  // playhead
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();  // speed
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();  // volume
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();  // trigger
-    *(float *)&_inletParams[4] = 0.0f;
-
-    _outletParams[0] = new ofTexture(); // output
-    _outletParams[1] = new float();  // finish bang
-    *(float *)&_outletParams[1] = 0.0f;
+    *(float *)&_inletParams[1] = 0.0f;  // playhead
+    *(float *)&_inletParams[2] = 0.0f;  // speed
+    *(float *)&_inletParams[3] = 0.0f;  // volume
+    *(float *)&_inletParams[4] = 0.0f;  // trigger
+
+    this->newOutletBuffer<ofTexture>(0); // output
+    *(float *)&_outletParams[1] = 0.0f;  // finish bang
 
     this->initInletsState();
 
-    video = new ofVideoPlayer();
+    video = new ThreadedVideoDecoder();
+    video->setup();
+
+    // the texture outlet changes only with a new decoded frame
+    this->setTracksOutletChanges(true);
+
+    uploadPBOIndex      = 0;
+    uploadMs            = 0.0f;
 
     lastMessage         = "";
     isNewObject         = false;
@@ -84,6 +86,9 @@ VideoPlayer::VideoPlayer() : PatchObject("video player"){
 
     preloadFirstFrame   = false;
 
+    loaded              = false;
+    syncGroup           = 0;
+
     this->setIsResizable(true);
     this->setIsTextureObj(true);
 
@@ -101,6 +106,8 @@ void VideoPlayer::newObject(){
 
     this->addOutlet(VP_LINK_TEXTURE,"output");
     this->addOutlet(VP_LINK_NUMERIC,"finish");
+
+    this->setCustomVar(static_cast<float>(syncGroup),"SYNC_GROUP");
 }
 
 //--------------------------------------------------------------
@@ -125,6 +132,12 @@ void VideoPlayer::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 //--------------------------------------------------------------
 void VideoPlayer::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchObjects){
 
+    if(!loaded){
+        loaded = true;
+        syncGroup = ofClamp(static_cast<int>(floor(this->getCustomVar("SYNC_GROUP"))),0,VIDEO_SYNC_MAX_GROUPS);
+        video->setSyncGroup(syncGroup);
+    }
+
     if(needToLoadVideo){
         needToLoadVideo = false;
         loadVideoFile();
@@ -137,25 +150,32 @@ void VideoPlayer::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRen
     ofSetColor(255);
 
     if(!isFileLoaded && video->isLoaded()){
-        video->setLoopState(OF_LOOP_NONE);
         video->setVolume(0);
-        video->play();
-        preloadFirstFrame = true;
+        // a synced clip shows the frame of its group position
+        if(syncGroup == 0){
+            video->setLoopState(OF_LOOP_NONE);
+            video->play();
+            preloadFirstFrame = true;
+        }
 
         ofLog(OF_LOG_NOTICE,"[verbose] video file loaded: %s",filepath.c_str());
         //ofLog(OF_LOG_NOTICE,"Internal texture data type: %i",video->getTexture().getTextureData().glInternalFormat);
 
         isFileLoaded = true;
+        this->setIsReady(true);
     }
 
     if(isFileLoaded && video->isLoaded()){
 
-        if(video->getWidth() != static_cast<ofTexture *>(_outletParams[0])->getWidth() || video->getHeight() != static_cast<ofTexture *>(_outletParams[0])->getHeight()){
-            _outletParams[0] = new ofTexture();
-            static_cast<ofTexture *>(_outletParams[0])->allocate(video->getWidth(),video->getHeight(),GL_RGB);
-            static_cast<ofTexture *>(_outletParams[0])->clear();
-        }else{
-            static_cast<ofTexture *>(_outletParams[0])->loadData(video->getPixels());
+        // upload only real new frames, decoded ahead by the player thread
+        if(video->receiveFrame()){
+            const ofPixels &frame = video->getFrame();
+            if(frame.getWidth() != static_cast<ofTexture *>(_outletParams[0])->getWidth() || frame.getHeight() != static_cast<ofTexture *>(_outletParams[0])->getHeight()){
+                this->newOutletBuffer<ofTexture>(0);
+                static_cast<ofTexture *>(_outletParams[0])->allocate(frame.getWidth(),frame.getHeight(),ofGetGLInternalFormat(frame));
+            }
+            uploadFrame(frame);
+            this->markOutletChanged(0);
         }
 
         // listen to message control (_inletParams[0])
@@ -215,8 +235,6 @@ void VideoPlayer::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRen
 
         if(static_cast<ofTexture *>(_outletParams[0])->isAllocated()){
             if(video->isPlaying()){ // play
-               video->update();
-
                // preload first video frame into outlet texture
                if(preloadFirstFrame && video->getCurrentFrame() > 0){
                    preloadFirstFrame = false;
@@ -341,6 +359,24 @@ void VideoPlayer::drawObjectNodeConfig(){
         if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s",tempFilename.getAbsolutePath().c_str());
         ImGuiEx::drawTimecode(ImGui::GetForegroundDrawList(),static_cast<int>(ceil(video->getDuration())),"Duration: ");
         ImGui::Text("Resolution %.0fx%.0f",video->getWidth(),video->getHeight());
+        VideoDecodeStats decodeStats = video->getStats();
+        ImGui::Text("Decode %.2f ms (max %.2f)",decodeStats.decodeMs,decodeStats.decodeMaxMs);
+        ImGui::Text("Upload %.2f ms",uploadMs);
+        ImGui::Text("Frames %llu, dropped %llu",static_cast<unsigned long long>(decodeStats.framesDecoded),static_cast<unsigned long long>(decodeStats.framesDropped));
+    }
+
+    ImGui::Spacing();
+    ImGui::PushItemWidth(130*this->scaleFactor);
+    if(ImGui::SliderInt("SYNC GROUP",&syncGroup,0,VIDEO_SYNC_MAX_GROUPS)){
+        video->setSyncGroup(syncGroup);
+        this->setCustomVar(static_cast<float>(syncGroup),"SYNC_GROUP");
+    }
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("0 plays alone, players of the same group follow one clock: transport controls drive the whole group");
+    if(syncGroup > 0){
+        ofxVPVideoSyncStats syncStats = ofxVPVideoSync::get().getStats(syncGroup);
+        ImGui::Text("%i clips, drift %.1f ms (max %.1f)",syncStats.clips,syncStats.errorMs,syncStats.maxErrorMs);
+        ImGui::Text("Resyncs %llu, nudges %llu",static_cast<unsigned long long>(syncStats.resyncs),static_cast<unsigned long long>(syncStats.nudges));
+        ImGui::Text("Preroll %.1f ms",syncStats.prerollMs);
     }
 
     ImGui::Spacing();
@@ -424,11 +460,9 @@ void VideoPlayer::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void VideoPlayer::removeObjectContent(bool removeFileFromData){
-    if(video->isLoaded()){
-        video->stop();
-        video->setVolume(0);
-        video->close();
-    }
+    video->stopDecoding();
+    video->setSyncGroup(0);
+    video->close();
     if(removeFileFromData){
         //removeFile(filepath);
     }
@@ -439,8 +473,11 @@ void VideoPlayer::loadVideoFile(){
     if(filepath != "none"){
         filepath = forceCheckMosaicDataPath(filepath);
         isNewObject = false;
-        //video->setUseTexture(false);
-        video->load(filepath);
+        // some players open the file asynchronously, ready on the first loaded frame
+        this->setIsReady(false);
+        if(!video->load(filepath)){
+            this->setIsReady(true);
+        }
 
         ofFile tempFile(filepath);
         videoName = tempFile.getFileName();
@@ -451,6 +488,29 @@ void VideoPlayer::loadVideoFile(){
     }
 }
 
+//--------------------------------------------------------------
+void VideoPlayer::uploadFrame(const ofPixels &frame){
+    uint64_t start = ofGetElapsedTimeMicros();
+
+    // copy into the next pixel buffer of the ring and let the driver transfer it to the
+    // texture asynchronously; reallocating orphans the storage a previous transfer may still read
+    ofBufferObject &pbo = uploadPBO[uploadPBOIndex];
+    uploadPBOIndex = (uploadPBOIndex+1)%VIDEO_UPLOAD_PBO_RING;
+    pbo.allocate(frame.getTotalBytes(),GL_STREAM_DRAW);
+
+    unsigned char *dst = pbo.map<unsigned char>(GL_WRITE_ONLY);
+    if(dst != nullptr){
+        memcpy(dst,frame.getData(),frame.getTotalBytes());
+        pbo.unmap();
+        static_cast<ofTexture *>(_outletParams[0])->loadData(pbo,ofGetGLFormat(frame),ofGetGLType(frame));
+    }else{
+        static_cast<ofTexture *>(_outletParams[0])->loadData(frame);
+    }
+
+    float ms = static_cast<float>(ofGetElapsedTimeMicros()-start)/1000.0f;
+    uploadMs = uploadMs*0.9f + ms*0.1f;
+}
+
 OBJECT_REGISTER( VideoPlayer, "video player", OFXVP_OBJECT_CAT_TEXTURE)
 
 #endif
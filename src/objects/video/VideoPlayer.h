@@ -36,9 +36,14 @@
 
 #include "PatchObject.h"
 
+#include "ThreadedVideoDecoder.h"
+
 #include "ImGuiFileBrowser.h"
 #include "IconsFontAwesome5.h"
 
+// pixel unpack buffers cycled by the texture uploads
+#define VIDEO_UPLOAD_PBO_RING   2
+
 class VideoPlayer : public PatchObject {
 
 public:
@@ -57,9 +62,13 @@ public:
     void            removeObjectContent(bool removeFileFromData=false) override;
 
     void            loadVideoFile();
+    void            uploadFrame(const ofPixels &frame);
 
 
-    ofVideoPlayer*      video;
+    ThreadedVideoDecoder*   video;
+    ofBufferObject      uploadPBO[VIDEO_UPLOAD_PBO_RING];
+    int                 uploadPBOIndex;
+    float               uploadMs;
     float               posX, posY, drawW, drawH;
     bool                isNewObject;
     bool                isFileLoaded;
@@ -68,6 +77,8 @@ public:
     bool                isPaused;
     bool                finishBang;
     bool                preloadFirstFrame;
+    bool                loaded;
+    int                 syncGroup;
 
     float               volume;
     float               speed;
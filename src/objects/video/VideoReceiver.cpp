@@ -42,7 +42,7 @@ VideoReceiver::VideoReceiver() : PatchObject("video receiver"){
     this->numInlets  = 0;
     this->numOutlets = 1;
 
-    _outletParams[0] = new ofTexture(); // input
+    this->newOutletBuffer<ofTexture>(0); // input
 
     this->initInletsState();
 
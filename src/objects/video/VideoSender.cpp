@@ -42,9 +42,8 @@ VideoSender::VideoSender() : PatchObject("video sender"){
     this->numInlets  = 2;
     this->numOutlets = 0;
 
-    _inletParams[0] = new ofTexture(); // input
-    _inletParams[1] = new float();      // bang
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofTexture>(0); // input
+    *(float *)&_inletParams[1] = 0.0f;      // bang
 
     this->initInletsState();
 
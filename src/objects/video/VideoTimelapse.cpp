@@ -40,15 +40,17 @@ VideoTimelapse::VideoTimelapse() : PatchObject("video timedelay"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
+    this->newInletBuffer<ofTexture>(0);  // input
 
-    _inletParams[1] = new float();  // delay frames
-    *(float *)&_inletParams[1] = 25.0f;
+    *(float *)&_inletParams[1] = 25.0f;  // delay frames
 
-    _outletParams[0] = new ofTexture(); // output
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
+    // the output changes with a captured frame, or a changed input
+    this->setTracksOutletChanges(true);
+
     videoBuffer = new circularTextureBuffer();
     pix         = new ofPixels();
     kuro        = new ofImage();
@@ -115,9 +117,11 @@ void VideoTimelapse::updateObjectContent(map<int,shared_ptr<PatchObject>> &patch
 void VideoTimelapse::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRenderer>& glRenderer){
 
     // UPDATE
+    bool changed = this->inputsChanged();
     if(this->inletsConnected[0]){
         if(ofGetElapsedTimeMillis()-resetTime > wait){
             resetTime       = ofGetElapsedTimeMillis();
+            changed         = true;
 
             ofImage rgbaImage;
             rgbaImage.allocate(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(),OF_IMAGE_COLOR_ALPHA);
@@ -143,6 +147,9 @@ void VideoTimelapse::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGL
     }else{
         *static_cast<ofTexture *>(_outletParams[0]) = kuro->getTexture();
     }
+    if(changed){
+        this->markOutletChanged(0);
+    }
 
     // DRAW
     ofSetColor(255);
@@ -154,8 +161,7 @@ void VideoTimelapse::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGL
     }else{
         // background
         if(scaledObjW*canvasZoom > 90.0f){
-            ofSetColor(34,34,34);
-            ofDrawRectangle(objOriginX - (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*this->scaleFactor/canvasZoom), objOriginY-(IMGUI_EX_NODE_HEADER_HEIGHT*this->scaleFactor/canvasZoom),scaledObjW + (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*this->scaleFactor/canvasZoom),scaledObjH + (((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*this->scaleFactor)/canvasZoom) );
+            drawNodeOFBackground(objOriginX, objOriginY, scaledObjW, scaledObjH, canvasZoom, this->scaleFactor);
         }
     }
 }
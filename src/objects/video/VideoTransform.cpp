@@ -40,30 +40,26 @@ VideoTransform::VideoTransform() : PatchObject("texture transform"){
     this->numInlets  = 8;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // input
-    _inletParams[1] = new float();      // x
-    *(float *)&_inletParams[1] = 0.0f;
-    _inletParams[2] = new float();      // y
-    *(float *)&_inletParams[2] = 0.0f;
-    _inletParams[3] = new float();      // w
-    *(float *)&_inletParams[3] = 0.0f;
-    _inletParams[4] = new float();      // h
-    *(float *)&_inletParams[4] = 0.0f;
-    _inletParams[5] = new float();      // angleX
-    *(float *)&_inletParams[5] = 0.0f;
-    _inletParams[6] = new float();      // angleY
-    *(float *)&_inletParams[6] = 0.0f;
-    _inletParams[7] = new float();      // angleZ
-    *(float *)&_inletParams[7] = 0.0f;
-
-    _outletParams[0] = new ofTexture(); // output
+    this->newInletBuffer<ofTexture>(0);  // input
+    *(float *)&_inletParams[1] = 0.0f;      // x
+    *(float *)&_inletParams[2] = 0.0f;      // y
+    *(float *)&_inletParams[3] = 0.0f;      // w
+    *(float *)&_inletParams[4] = 0.0f;      // h
+    *(float *)&_inletParams[5] = 0.0f;      // angleX
+    *(float *)&_inletParams[6] = 0.0f;      // angleY
+    *(float *)&_inletParams[7] = 0.0f;      // angleZ
+
+    this->newOutletBuffer<ofTexture>(0); // output
 
     this->initInletsState();
 
+    // the output changes only with the input texture and the transform
+    this->setTracksOutletChanges(true);
+
     this->width             *= 2;
     this->height            *= 2;
 
-    scaledFbo  = new ofFbo();
+    scaledFbo  = nullptr;
     needToGrab  = false;
 
     posX = posY = drawW = drawH = 0.0f;
@@ -179,7 +175,8 @@ void VideoTransform::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGL
         if(static_cast<ofTexture *>(_inletParams[0])->isAllocated()){
             if(!needToGrab){
                 needToGrab = true;
-                scaledFbo->allocate(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), GL_RGBA );
+                ofxVPFboPool::get().release(scaledFbo);
+                scaledFbo = ofxVPFboPool::get().acquire(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), GL_RGBA, 0, this->getId());
                 _maxW = static_cast<ofTexture *>(_inletParams[0])->getWidth();
                 _maxH = static_cast<ofTexture *>(_inletParams[0])->getHeight();
             }
@@ -199,6 +196,9 @@ void VideoTransform::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGL
             scaledFbo->end();
 
             *static_cast<ofTexture *>(_outletParams[0]) = scaledFbo->getTexture();
+            if(this->inputsChanged()){
+                this->markOutletChanged(0);
+            }
         }
     }else{
         needToGrab = false;
@@ -299,7 +299,8 @@ void VideoTransform::drawObjectNodeConfig(){
 
 //--------------------------------------------------------------
 void VideoTransform::removeObjectContent(bool removeFileFromData){
-
+    ofxVPFboPool::get().release(scaledFbo);
+    scaledFbo = nullptr;
 }
 
 
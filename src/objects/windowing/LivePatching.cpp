@@ -40,12 +40,10 @@ LivePatching::LivePatching() : PatchObject("live patching"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // texture
-    _inletParams[1] = new float();  // alpha
-    *(float *)&_inletParams[1] = 0.0f;
+    this->newInletBuffer<ofTexture>(0);  // texture
+    *(float *)&_inletParams[1] = 0.0f;  // alpha
 
-    _outletParams[0] = new float();  // alpha
-    *(float *)&_outletParams[0] = 0.0f;
+    *(float *)&_outletParams[0] = 0.0f;  // alpha
 
     this->initInletsState();
 
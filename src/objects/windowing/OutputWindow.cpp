@@ -43,10 +43,10 @@ OutputWindow::OutputWindow() : PatchObject("output window"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // projector
-    _inletParams[1] = new LiveCoding(); // script reference
+    this->newInletBuffer<ofTexture>(0);  // projector
+    this->newInletBuffer<LiveCoding>(1); // script reference
 
-    _outletParams[0] = new vector<float>(); // mouse
+    this->newOutletBuffer<vector<float>>(0); // mouse
 
     this->specialLinkTypeName = "LiveCoding";
 
@@ -72,8 +72,14 @@ OutputWindow::OutputWindow() : PatchObject("output window"){
     edgeL = edgeR = edgeT = edgeB = 0.5f;
 
     needReset           = false;
+    reconnectFromID     = -1;
+    reconnectOutletID   = -1;
+    reconnectSpecialLink = false;
     hideMouse           = false;
 
+    presentedVersion    = 0;
+    needsRedraw         = true;
+
     loadWarpingFlag     = false;
     saveWarpingFlag     = false;
 
@@ -122,6 +128,8 @@ void OutputWindow::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
     settings.decorated = true;
     settings.resizable = true;
     settings.stencilBits = 0;
+    // headless render: keep the GL context and the warping, never map the window
+    settings.visible = !PatchObject::isHeadless();
     // RETINA FIX
     if(mainWindow->getPixelScreenCoordScale() > 1){
         if(ofGetScreenWidth() > 3360 && ofGetScreenHeight() > 2100){
@@ -136,6 +144,8 @@ void OutputWindow::setupObjectContent(shared_ptr<ofAppGLFWWindow> &mainWindow){
 
     window = dynamic_pointer_cast<ofAppGLFWWindow>(ofCreateWindow(settings));
     window->setVerticalSync(false);
+    // drawInWindow clears by itself
+    window->renderer()->setBackgroundAuto(false);
     window->setWindowPosition(this->getCustomVar("OUTPUT_POSX"),this->getCustomVar("OUTPUT_POSY"));
 
     glfwSetWindowCloseCallback(window->getGLFWWindow(),GL_FALSE);
@@ -190,10 +200,21 @@ void OutputWindow::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
         resetOutputResolution();
         if(this->inletsConnected[0] && fromObjID != -1 && fromOutletID != -1){
             this->disconnectFrom(patchObjects,0);
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
-            this->connectTo(patchObjects,fromObjID,fromOutletID,0,VP_LINK_TEXTURE);
+            reconnectFromID         = fromObjID;
+            reconnectOutletID       = fromOutletID;
+            reconnectSpecialLink    = isSpecialLink;
+        }
+    }
 
-            if(isSpecialLink){
+    // reconnect the source once it rebuilt its texture at the new resolution (same frame if it did it synchronously)
+    if(reconnectFromID != -1){
+        if(patchObjects.find(reconnectFromID) == patchObjects.end() || patchObjects[reconnectFromID]->getWillErase()){
+            reconnectFromID = -1;
+        }else if(patchObjects[reconnectFromID]->getIsReady()){
+            this->connectTo(patchObjects,reconnectFromID,reconnectOutletID,0,VP_LINK_TEXTURE);
+            reconnectFromID = -1;
+
+            if(reconnectSpecialLink){
                 if(!isFullscreen){
                     scaleTextureToWindow(this->output_width,this->output_height, window_actual_width, window_actual_height);
                 }else{
@@ -210,7 +231,7 @@ void OutputWindow::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
                 for(int o=0;o<static_cast<int>(it->second->outPut.size());o++){
                     if(!it->second->outPut[o]->isDisabled && it->second->outPut[o]->toObjectID == this->getId()){
                         if(it->second->getName() == "lua script"){
-                            _inletParams[1] = new LiveCoding();
+                            this->newInletBuffer<LiveCoding>(1);
                         }else{
                             _inletParams[1] = nullptr;
                         }
@@ -259,7 +280,7 @@ void OutputWindow::updateObjectContent(map<int,shared_ptr<PatchObject>> &patchOb
         warpController->getWarp(0)->setGamma(edgesGamma);
         warpController->getWarp(0)->setExponent(edgesExponent);
 
-        if(static_cast<bool>(floor(this->getCustomVar("FULLSCREEN"))) != isFullscreen){
+        if(!PatchObject::isHeadless() && static_cast<bool>(floor(this->getCustomVar("FULLSCREEN"))) != isFullscreen){
             window->setWindowPosition(this->getCustomVar("OUTPUT_POSX"),this->getCustomVar("OUTPUT_POSY"));
             toggleWindowFullscreen();
         }
@@ -284,8 +305,7 @@ void OutputWindow::drawObjectContent(ofTrueTypeFont *font, shared_ptr<ofBaseGLRe
         }
     }else{
         if(scaledObjW*canvasZoom > 90.0f){
-            ofSetColor(34,34,34);
-            ofDrawRectangle(objOriginX - (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*this->scaleFactor/canvasZoom), objOriginY-(IMGUI_EX_NODE_HEADER_HEIGHT*this->scaleFactor/canvasZoom),scaledObjW + (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*this->scaleFactor/canvasZoom),scaledObjH + (((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*this->scaleFactor)/canvasZoom) );
+            drawNodeOFBackground(objOriginX, objOriginY, scaledObjW, scaledObjH, canvasZoom, this->scaleFactor);
         }
     }
 }
@@ -527,14 +547,56 @@ void OutputWindow::toggleWindowFullscreen(){
 
 //--------------------------------------------------------------
 void OutputWindow::drawInWindow(ofEventArgs &e){
-    ofBackground(0);
-
     if(hideMouse){
         window->hideCursor();
     }else{
         window->showCursor();
     }
 
+    if(!PatchObject::isRenderOnDemand()){
+        drawOutput();
+        return;
+    }
+
+    // the window swaps on every frame and the back buffer is undefined after a swap, so the output
+    // is redrawn into a persistent fbo only on change, and the fbo is presented on every frame
+    uint64_t version = this->inletsConnected[0] ? this->_inletVersions[0]+1 : 0;
+    if(version != presentedVersion){
+        presentedVersion    = version;
+        needsRedraw         = true;
+    }
+    // framebuffer pixels, more than the window size on HiDPI screens
+    int fbWidth, fbHeight;
+    glfwGetFramebufferSize(window->getGLFWWindow(),&fbWidth,&fbHeight);
+    if(fbWidth <= 0 || fbHeight <= 0){
+        return;
+    }
+    if(!presentFbo.isAllocated() || static_cast<int>(presentFbo.getWidth()) != fbWidth || static_cast<int>(presentFbo.getHeight()) != fbHeight){
+        presentFbo.allocate(fbWidth,fbHeight,GL_RGB);
+        needsRedraw         = true;
+    }
+    if(needsRedraw){
+        needsRedraw         = false;
+        presentFbo.begin();
+        // drawOutput() works in window coordinates
+        ofPushMatrix();
+        ofScale(static_cast<float>(fbWidth)/window->getWidth(),static_cast<float>(fbHeight)/window->getHeight());
+        drawOutput();
+        ofPopMatrix();
+        presentFbo.end();
+    }
+
+    ofPushStyle();
+    ofDisableBlendMode();
+    ofSetColor(255);
+    presentFbo.draw(0,0,window->getWidth(),window->getHeight());
+    ofPopStyle();
+}
+
+//--------------------------------------------------------------
+void OutputWindow::drawOutput(){
+    ofBackground(0);
+
     ofPushStyle();
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated()){
 
@@ -584,6 +646,7 @@ void OutputWindow::resetOutputResolution(){
 
 //--------------------------------------------------------------
 void OutputWindow::keyPressed(ofKeyEventArgs &e){
+    needsRedraw = true;
 
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated() && isFullscreen){
         warpController->onKeyPressed(e.key);
@@ -600,6 +663,7 @@ void OutputWindow::keyPressed(ofKeyEventArgs &e){
 
 //--------------------------------------------------------------
 void OutputWindow::keyReleased(ofKeyEventArgs &e){
+    needsRedraw = true;
     // OSX: CMD-F, WIN/LINUX: CTRL-F    (FULLSCREEN)
     if(e.hasModifier(MOD_KEY) && e.keycode == 70){
         toggleWindowFullscreen();
@@ -633,6 +697,7 @@ void OutputWindow::keyReleased(ofKeyEventArgs &e){
 
 //--------------------------------------------------------------
 void OutputWindow::mouseMoved(ofMouseEventArgs &e){
+    needsRedraw = true;
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated() && isFullscreen){
         warpController->onMouseMoved(window->events().getMouseX(),window->events().getMouseY());
     }
@@ -652,6 +717,7 @@ void OutputWindow::mouseMoved(ofMouseEventArgs &e){
 
 //--------------------------------------------------------------
 void OutputWindow::mouseDragged(ofMouseEventArgs &e){
+    needsRedraw = true;
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated() && isFullscreen){
         warpController->onMouseDragged(window->events().getMouseX(),window->events().getMouseY());
     }
@@ -670,6 +736,7 @@ void OutputWindow::mouseDragged(ofMouseEventArgs &e){
 
 //--------------------------------------------------------------
 void OutputWindow::mousePressed(ofMouseEventArgs &e){
+    needsRedraw = true;
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated() && isFullscreen){
         warpController->onMousePressed(window->events().getMouseX(),window->events().getMouseY());
     }
@@ -688,6 +755,7 @@ void OutputWindow::mousePressed(ofMouseEventArgs &e){
 
 //--------------------------------------------------------------
 void OutputWindow::mouseReleased(ofMouseEventArgs &e){
+    needsRedraw = true;
     if(this->inletsConnected[0] && static_cast<ofTexture *>(_inletParams[0])->isAllocated() && isFullscreen){
         warpController->onMouseReleased(window->events().getMouseX(),window->events().getMouseY());
     }
@@ -708,6 +776,7 @@ void OutputWindow::mouseReleased(ofMouseEventArgs &e){
 
 //--------------------------------------------------------------
 void OutputWindow::mouseScrolled(ofMouseEventArgs &e){
+    needsRedraw = true;
     ofVec2f tm = ofVec2f(((window->events().getMouseX()-thposX)/thdrawW * this->output_width),((window->events().getMouseY()-thposY)/thdrawH * this->output_height));
     if(this->inletsConnected[0] && this->inletsConnected[1] && _inletParams[1] != nullptr && static_cast<ofTexture *>(_inletParams[0])->isAllocated()){
         if(static_cast<LiveCoding *>(_inletParams[1])->lua.isValid()){
@@ -722,6 +791,7 @@ void OutputWindow::mouseScrolled(ofMouseEventArgs &e){
 
 //--------------------------------------------------------------
 void OutputWindow::windowResized(ofResizeEventArgs &e){
+    needsRedraw = true;
     if(static_cast<ofTexture *>(_inletParams[0])->isAllocated()){
         scaleTextureToWindow(static_cast<ofTexture *>(_inletParams[0])->getWidth(), static_cast<ofTexture *>(_inletParams[0])->getHeight(), e.width,e.height);
     }
@@ -65,6 +65,7 @@ public:
     void            toggleWindowFullscreen();
 
     void            drawInWindow(ofEventArgs &e);
+    void            drawOutput();
 
     void            loadWindowSettings();
     void            resetOutputResolution();
@@ -88,6 +89,9 @@ public:
     float                                   posX, posY, drawW, drawH;
     float                                   thposX, thposY, thdrawW, thdrawH;
     bool                                    needReset;
+    // texture source to reconnect after a resolution reset, as soon as it is ready
+    int                                     reconnectFromID, reconnectOutletID;
+    bool                                    reconnectSpecialLink;
 
     ofxWarpController                       *warpController;
 
@@ -98,6 +102,13 @@ public:
     bool                                    useMapping;
     bool                                    hideMouse;
 
+    // render on demand: output drawn only on change into presentFbo (created in this window context,
+    // sized in framebuffer pixels),
+    // which is presented on every frame
+    ofFbo                                   presentFbo;
+    uint64_t                                presentedVersion;
+    bool                                    needsRedraw;
+
     float                                   edgesLuminance;
     float                                   edgesGamma;
     float                                   edgesExponent;
@@ -42,10 +42,10 @@ ProjectionMapping::ProjectionMapping() : PatchObject("projection mapping"){
     this->numInlets  = 2;
     this->numOutlets = 1;
 
-    _inletParams[0] = new ofTexture();  // source
-    _inletParams[1] = new ofTexture();  // background
+    this->newInletBuffer<ofTexture>(0);  // source
+    this->newInletBuffer<ofTexture>(1);  // background
 
-    _outletParams[0] = new ofTexture();  // mapping
+    this->newOutletBuffer<ofTexture>(0);  // mapping
 
     this->initInletsState();
 
@@ -32,6 +32,8 @@
 
 #include "ofxVisualProgramming.h"
 #include "imgui_internal.h"
+#include "vectorMath.h"
+#include "shaderCache.h"
 
 #ifdef MOSAIC_ENABLE_PROFILING
 #include "Tracy.hpp"
@@ -89,6 +91,14 @@ ofxVisualProgramming::ofxVisualProgramming(){
     audioGUIOUTIndex        = -1;
     bpm                     = 120;
     dspON                   = false;
+    headless                = false;
+
+    renderOnDemand          = false;
+    renderIdle              = false;
+    backgroundAuto          = true;
+    lastContentVersion      = 0;
+    lastActivityTime        = 0;
+
     audioINDev              = 0;
     audioOUTDev             = 0;
 
@@ -119,6 +129,12 @@ void ofxVisualProgramming::setRetina(bool retina){
     }
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::setHeadless(bool _headless){
+    headless = _headless;
+    PatchObject::setHeadless(headless);
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::setup(ofxImGui::Gui* _guiRef, string release){
 
@@ -153,6 +169,11 @@ void ofxVisualProgramming::setup(ofxImGui::Gui* _guiRef, string release){
     // RESET TEMP FOLDER
     resetTempFolder();
 
+    ofLog(OF_LOG_NOTICE,"Vector math kernels: %s",ofxVPMath::getSIMDLevelName(ofxVPMath::getSIMDLevel()));
+
+    // background shader compiler, before any shader object
+    ofxVPShaderCache::get().setup(mainWindow);
+
     // Load external plugins objects
     plugins_kernel.add_server(PatchObject::server_name(), PatchObject::version);
     // list plugin directory
@@ -206,7 +227,9 @@ void ofxVisualProgramming::update(){
         // sort the vector by it's pair first value (object X position)
         sort(leftToRightIndexOrder.begin(),leftToRightIndexOrder.end());
 
-        ImGuiEx::ProfilerTask *pt = new ImGuiEx::ProfilerTask[leftToRightIndexOrder.size()];
+        // reused every frame (LoadFrameData copies the tasks)
+        profilerTasks.assign(leftToRightIndexOrder.size(),ImGuiEx::ProfilerTask());
+        ImGuiEx::ProfilerTask *pt = profilerTasks.data();
 
         for(unsigned int i=0;i<leftToRightIndexOrder.size();i++){ 
             if(patchObjects[leftToRightIndexOrder[i].second]->subpatchName == currentSubpatch){
@@ -220,34 +243,76 @@ void ofxVisualProgramming::update(){
                 patchObjects[leftToRightIndexOrder[i].second]->update(patchObjects,*engine);
 
                 pt[i].endTime = ofGetElapsedTimef();
-
-                // update scripts objects files map
-                ofFile tempsofp(patchObjects[leftToRightIndexOrder[i].second]->getFilepath());
-                string fileExt = ofToUpper(tempsofp.getExtension());
-                if(fileExt == "LUA" || fileExt == "PY" || fileExt == "SH"){
-                    map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
-                    if (sofpIT == scriptsObjectsFilesPaths.end()){
-                        // not found, insert it
-                        scriptsObjectsFilesPaths.insert( pair<string,string>(tempsofp.getFileName(),tempsofp.getAbsolutePath()) );
-                    }
-                }else if(fileExt == "FRAG"){
-                    map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
-                    if (sofpIT == scriptsObjectsFilesPaths.end()){
-                        // not found, insert FRAG
-                        scriptsObjectsFilesPaths.insert( pair<string,string>(tempsofp.getFileName(),tempsofp.getAbsolutePath()) );
-                        // insert VERT
-                        string fsName = tempsofp.getFileName();
-                        string vsName = tempsofp.getEnclosingDirectory()+tempsofp.getFileName().substr(0,fsName.find_last_of('.'))+".vert";
-                        ofFile newVertGLSLFile (vsName);
-                        scriptsObjectsFilesPaths.insert( pair<string,string>(newVertGLSLFile.getFileName(),newVertGLSLFile.getAbsolutePath()) );
-                    }
-                }
             }
+
+            // keep scripts objects files map in sync (string compare only, no filesystem access)
+            updateScriptFile(leftToRightIndexOrder[i].second,patchObjects[leftToRightIndexOrder[i].second]->getFilepath());
         }
 
         profiler.cpuGraph.LoadFrameData(pt,leftToRightIndexOrder.size());
     }
 
+    // links are refreshed, buffers released before this frame can be reused
+    ofxVPPortBufferPool::get().update();
+    ofxVPFboPool::get().update();
+
+    if(renderOnDemand){
+        updateRenderOnDemand();
+    }
+
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::setRenderOnDemand(bool onDemand){
+    // headless render runs at its own pace
+    if(headless || onDemand == renderOnDemand) return;
+
+    if(onDemand){
+        backgroundAuto = ofGetBackgroundAuto();
+    }else if(renderIdle){
+        ofSetBackgroundAuto(backgroundAuto);
+    }
+
+    renderOnDemand      = onDemand;
+    renderIdle          = false;
+    lastContentVersion  = 0;
+    PatchObject::setRenderOnDemand(renderOnDemand);
+    wakeUp();
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::wakeUp(){
+    lastActivityTime = ofGetElapsedTimeMillis();
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::updateRenderOnDemand(){
+
+    // content of the visible subpatch, plus everything that moves the canvas
+    uint64_t version = patchObjects.size();
+    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
+        if(it->second->subpatchName == currentSubpatch){
+            version = version*31 + it->second->getContentVersion();
+        }
+    }
+    version = version*31 + static_cast<uint64_t>(ofGetWindowWidth());
+    version = version*31 + static_cast<uint64_t>(ofGetWindowHeight());
+    version = version*31 + static_cast<uint64_t>(static_cast<int64_t>(canvas.getTranslation().x*100.0f));
+    version = version*31 + static_cast<uint64_t>(static_cast<int64_t>(canvas.getTranslation().y*100.0f));
+    version = version*31 + static_cast<uint64_t>(canvas.getScale()*1000.0f);
+
+    if(version != lastContentVersion || bLoadingNewPatch || bLoadingNewObject || ImGui::IsAnyItemActive()){
+        lastContentVersion = version;
+        wakeUp();
+    }
+
+    bool idle = ofGetElapsedTimeMillis() - lastActivityTime > VP_RENDER_ON_DEMAND_HOLD;
+    if(idle != renderIdle){
+        renderIdle = idle;
+        // idle frames draw nothing, the last one stays in the window without the background clear
+        ofSetBackgroundAuto(renderIdle ? false : backgroundAuto);
+    }
+
 }
 
 //--------------------------------------------------------------
@@ -264,6 +329,9 @@ void ofxVisualProgramming::draw(){
 
     if(bLoadingNewPatch) return;
 
+    // render on demand, nothing changed: no canvas nor ImGui redraw (objects still update)
+    if(renderIdle) return;
+
     // LIVE PATCHING SESSION
     drawLivePatchingSession();
 
@@ -286,6 +354,9 @@ void ofxVisualProgramming::draw(){
 
     canvas.begin(canvasViewport);
 
+    // visible canvas area, node previews outside of it are skipped
+    getNodePreviewBatch().setVisibleArea(ofRectangle((canvasViewport.x - canvas.getTranslation().x)/canvas.getScale(),(canvasViewport.y - canvas.getTranslation().y)/canvas.getScale(),canvasViewport.width/canvas.getScale(),canvasViewport.height/canvas.getScale()));
+
     ofEnableAlphaBlending();
     ofSetCurveResolution(50);
     ofSetColor(255);
@@ -324,7 +395,11 @@ void ofxVisualProgramming::draw(){
 
     // Render objects.
     if(!bLoadingNewPatch && !patchObjects.empty()){
-        ImGuiEx::ProfilerTask *pt = new ImGuiEx::ProfilerTask[leftToRightIndexOrder.size()];
+        // reused every frame (LoadFrameData copies the tasks)
+        profilerTasks.assign(leftToRightIndexOrder.size(),ImGuiEx::ProfilerTask());
+        ImGuiEx::ProfilerTask *pt = profilerTasks.data();
+        // the selected node previews follow every change, the others are throttled
+        getNodePreviewBatch().setSelectedObject(nodeCanvas.getActiveNode());
         for(unsigned int i=0;i<leftToRightIndexOrder.size();i++){
 
             if(patchObjects[leftToRightIndexOrder[i].second]->subpatchName == currentSubpatch){
@@ -353,6 +428,9 @@ void ofxVisualProgramming::draw(){
 
         profiler.gpuGraph.LoadFrameData(pt,leftToRightIndexOrder.size());
 
+        // node previews are drawn at the end of each object draw, thumbnails bookkeeping
+        getNodePreviewBatch().flush();
+
         // INSPECTOR
         if(inspectorActive){
             if(isCanvasVisible){
@@ -408,6 +486,34 @@ void ofxVisualProgramming::drawInspector(){
 
         patchObjects[nodeCanvas.getActiveNode()]->drawImGuiNodeConfig();
 
+        ImGui::Spacing();
+        ImGui::Text("port buffers: %.1f KB",patchObjects[nodeCanvas.getActiveNode()]->getPortBuffersMemory()/1024.0f);
+        ImGui::Text("render targets: %.1f MB",ofxVPFboPool::get().getOwnerBytes(nodeCanvas.getActiveNode())/1048576.0f);
+
+    }
+
+    // live inlet/outlet buffers memory, by link type
+    ImGui::Spacing();
+    if(ImGui::CollapsingHeader("Port buffers")){
+        const int linkTypes[] = {VP_LINK_STRING,VP_LINK_ARRAY,VP_LINK_PIXELS,VP_LINK_TEXTURE,VP_LINK_AUDIO,VP_LINK_SPECIAL};
+        const char *linkNames[] = {"string","array","pixels","texture","audio","special"};
+        for(int i=0;i<6;i++){
+            ofxVPPortBufferStats stats = ofxVPPortBufferPool::get().getStats(linkTypes[i]);
+            ImGui::Text("%-8s %4zu live %9.1f KB | %4zu pooled %9.1f KB",linkNames[i],stats.buffers,stats.bytes/1024.0f,stats.pooled,stats.pooledBytes/1024.0f);
+        }
+    }
+
+    // shared FBOs VRAM, and what the transient ones save by being reused across the graph
+    if(ImGui::CollapsingHeader("Render targets")){
+        ofxVPFboPoolStats stats = ofxVPFboPool::get().getStats();
+        ImGui::Text("%zu targets %.1f MB (held %.1f MB | scratch %.1f MB | free %.1f MB)",stats.targets,stats.bytes/1048576.0f,stats.heldBytes/1048576.0f,stats.transientBytes/1048576.0f,stats.freeBytes/1048576.0f);
+        ImGui::Text("without pool %.1f MB | %zu allocations, %zu reuses",stats.unpooledBytes/1048576.0f,stats.allocations,stats.reuses);
+        ImGui::Text("node thumbnails %zu | %zu refreshed last frame",getNodePreviewBatch().getNumThumbnails(),getNodePreviewBatch().getNumRefreshed());
+        ImGui::Spacing();
+        vector<ofxVPFboKeyStats> keyStats = ofxVPFboPool::get().getKeyStats();
+        for(size_t i=0;i<keyStats.size();i++){
+            ImGui::Text("%5ix%-5i 0x%04X x%i %7.1f MB | %3zu held %3zu free | scratch %3zu requests, %3zu used",keyStats[i].key.width,keyStats[i].key.height,keyStats[i].key.internalFormat,keyStats[i].key.numSamples,keyStats[i].bytes/1048576.0f,keyStats[i].held,keyStats[i].free,keyStats[i].transientRequests,keyStats[i].transientPeak);
+        }
     }
 
     ImGui::End();
@@ -505,6 +611,8 @@ void ofxVisualProgramming::exit(){
         deactivateDSP();
     }
 
+    ofxVPShaderCache::get().exit();
+
     cleanPatchDataFolder();
 
     resetTempFolder();
@@ -512,12 +620,15 @@ void ofxVisualProgramming::exit(){
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::mouseMoved(ofMouseEventArgs &e){
+    wakeUp();
 
 }
 
 //--------------------------------------------------------------
 void ofxVisualProgramming::mouseDragged(ofMouseEventArgs &e){
 
+    wakeUp();
+
     if(ImGui::IsAnyItemActive() || nodeCanvas.isAnyNodeHovered() || ImGui::IsAnyItemHovered() )// || ImGui::IsAnyWindowHovered())
         return;
 
@@ -528,6 +639,8 @@ void ofxVisualProgramming::mouseDragged(ofMouseEventArgs &e){
 //--------------------------------------------------------------
 void ofxVisualProgramming::mousePressed(ofMouseEventArgs &e){
 
+    wakeUp();
+
     if(ImGui::IsAnyItemActive() || nodeCanvas.isAnyNodeHovered() || ImGui::IsAnyItemHovered() )
         return;
 
@@ -538,6 +651,8 @@ void ofxVisualProgramming::mousePressed(ofMouseEventArgs &e){
 //--------------------------------------------------------------
 void ofxVisualProgramming::mouseReleased(ofMouseEventArgs &e){
 
+    wakeUp();
+
     if(ImGui::IsAnyItemActive() || nodeCanvas.isAnyNodeHovered() || ImGui::IsAnyItemHovered() )
         return;
 
@@ -548,6 +663,8 @@ void ofxVisualProgramming::mouseReleased(ofMouseEventArgs &e){
 //--------------------------------------------------------------
 void ofxVisualProgramming::mouseScrolled(ofMouseEventArgs &e){
 
+    wakeUp();
+
     if(ImGui::IsAnyItemActive() || nodeCanvas.isAnyNodeHovered() || ImGui::IsAnyItemHovered())// | ImGui::IsAnyWindowHovered() )
         return;
 
@@ -557,6 +674,8 @@ void ofxVisualProgramming::mouseScrolled(ofMouseEventArgs &e){
 //--------------------------------------------------------------
 void ofxVisualProgramming::keyPressed(ofKeyEventArgs &e){
 
+    wakeUp();
+
     if(ImGui::IsAnyItemActive())
         return;
 
@@ -568,6 +687,8 @@ void ofxVisualProgramming::keyPressed(ofKeyEventArgs &e){
 //--------------------------------------------------------------
 void ofxVisualProgramming::keyReleased(ofKeyEventArgs &e){
 
+    wakeUp();
+
     if(ImGui::IsAnyItemActive())
         return;
 
@@ -579,6 +700,11 @@ void ofxVisualProgramming::keyReleased(ofKeyEventArgs &e){
 //--------------------------------------------------------------
 void ofxVisualProgramming::audioProcess(float *input, int bufferSize, int nChannels){
 
+    // the audio clock keeps running while patches/objects are loading
+    if(audioSampleRate != 0){
+        ofxVPAudioClock::get().advance(bufferSize,audioSampleRate);
+    }
+
     if(bLoadingNewPatch) return;
     if(bLoadingNewObject) return;
 
@@ -586,7 +712,11 @@ void ofxVisualProgramming::audioProcess(float *input, int bufferSize, int nChann
 
         std::lock_guard<std::mutex> lck(vp_mutex);
 
-        if(audioDevices[audioINDev].inputChannels > 0){
+        // checked again under the lock: a load may have started between the test above and the
+        // lock, its handshake (set the flag, take and drop the lock) is then already over
+        if(bLoadingNewPatch || bLoadingNewObject) return;
+
+        if(!headless && audioDevices[audioINDev].inputChannels > 0){
             inputBuffer.copyFrom(input, bufferSize, nChannels, audioSampleRate);
 
             // compute audio input
@@ -596,7 +726,7 @@ void ofxVisualProgramming::audioProcess(float *input, int bufferSize, int nChann
 
             lastInputBuffer = inputBuffer;
         }
-        if(audioDevices[audioOUTDev].outputChannels > 0){
+        if(headless || audioDevices[audioOUTDev].outputChannels > 0){
             // compute audio output
             for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
                 it->second->audioOut(emptyBuffer);
@@ -628,7 +758,11 @@ void ofxVisualProgramming::addObject(string name,ofVec2f pos){
         return;
     }
 
+    // same handshake as loadPatch(): the audio callback skips the objects from here on
     bLoadingNewObject       = true;
+    {
+        std::lock_guard<std::mutex> lck(vp_mutex);
+    }
 
     shared_ptr<PatchObject> tempObj = selectObject(name);
 
@@ -743,6 +877,7 @@ void ofxVisualProgramming::resetObject(int id){
                 }else{
                     it->second->outPut[j]->isDisabled = true;
                     patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                    patchObjects[it->second->outPut[j]->toObjectID]->resetInlet(it->second->outPut[j]->toInletID);
                 }
             }
             it->second->outPut = tempBuffer;
@@ -866,6 +1001,7 @@ void ofxVisualProgramming::deleteObject(int id){
                 }else{
                     it->second->outPut[j]->isDisabled = true;
                     patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                    patchObjects[it->second->outPut[j]->toObjectID]->resetInlet(it->second->outPut[j]->toInletID);
                 }
             }
             it->second->outPut = tempBuffer;
@@ -884,44 +1020,32 @@ void ofxVisualProgramming::clearObjectsMap(){
                 eraseIndexes.push_back(it->first);
             }
         }
+        vector<shared_ptr<PatchObject>> erased;
         for(int x=0;x<static_cast<int>(eraseIndexes.size());x++){
 
             if(!clearingObjectsMap){
                 for(int p=0;p<static_cast<int>(patchObjects.at(eraseIndexes.at(x))->outPut.size());p++){
                     patchObjects[patchObjects.at(eraseIndexes.at(x))->outPut.at(p)->toObjectID]->inletsConnected.at(patchObjects.at(eraseIndexes.at(x))->outPut.at(p)->toInletID) = false;
+                    patchObjects[patchObjects.at(eraseIndexes.at(x))->outPut.at(p)->toObjectID]->resetInlet(patchObjects.at(eraseIndexes.at(x))->outPut.at(p)->toInletID);
                 }
             }
 
             // remove scripts objects filepath reference from scripts objects files map
-            ofFile tempsofp(patchObjects.at(eraseIndexes.at(x))->getFilepath());
-            string fileExt = ofToUpper(tempsofp.getExtension());
-            if(fileExt == "LUA" || fileExt == "PY" || fileExt == "SH"){
-                map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
-                if (sofpIT != scriptsObjectsFilesPaths.end()){
-                    // found it, remove it
-                    scriptsObjectsFilesPaths.erase(sofpIT);
-                }
-            }else if(fileExt == "FRAG"){
-                // remove .frag
-                map<string,string>::iterator sofpIT = scriptsObjectsFilesPaths.find(tempsofp.getFileName());
-                if (sofpIT != scriptsObjectsFilesPaths.end()){
-                    // found it, remove it
-                    scriptsObjectsFilesPaths.erase(sofpIT);
-                }
-                // remove .vert
-                string pf_fsName = tempsofp.getFileName();
-                string pf_vsName = tempsofp.getEnclosingDirectory()+tempsofp.getFileName().substr(0,pf_fsName.find_last_of('.'))+".vert";
-                ofFile tempVert(pf_vsName);
-                map<string,string>::iterator sofpITV = scriptsObjectsFilesPaths.find(tempVert.getFileName());
-                if (sofpITV != scriptsObjectsFilesPaths.end()){
-                    // found it, remove it
-                    scriptsObjectsFilesPaths.erase(sofpITV);
-                }
-            }
+            releaseScriptFile(eraseIndexes.at(x));
+
+            erased.push_back(patchObjects.at(eraseIndexes.at(x)));
+        }
 
-            patchObjects.at(eraseIndexes.at(x))->removeObjectContent(true);
-            patchObjects.erase(eraseIndexes.at(x));
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // detach from the map while the audio callback is out of it, then release the
+        // objects resources: once erased, audioIn/audioOut can't reach them anymore
+        if(!eraseIndexes.empty()){
+            std::lock_guard<std::mutex> lck(vp_mutex);
+            for(int x=0;x<static_cast<int>(eraseIndexes.size());x++){
+                patchObjects.erase(eraseIndexes.at(x));
+            }
+        }
+        for(size_t x=0;x<erased.size();x++){
+            erased.at(x)->removeObjectContent(true);
         }
 
         if(clearingObjectsMap){
@@ -932,6 +1056,56 @@ void ofxVisualProgramming::clearObjectsMap(){
     }
 }
 
+//--------------------------------------------------------------
+void ofxVisualProgramming::updateScriptFile(int id, const string &filepath){
+    map<int,ScriptFileEntry>::iterator entry = scriptsObjectsFiles.find(id);
+    if(entry != scriptsObjectsFiles.end() && entry->second.filepath == filepath){
+        return;
+    }
+
+    // object added or retargeted
+    releaseScriptFile(id);
+
+    ScriptFileEntry &sfe = scriptsObjectsFiles[id];
+    sfe.filepath = filepath;
+
+    string fileExt = ofToUpper(ofFilePath::getFileExt(filepath));
+    if(fileExt == "LUA" || fileExt == "PY" || fileExt == "SH" || fileExt == "FRAG"){
+        string fileName = ofFilePath::getFileName(filepath);
+        sfe.names.push_back(fileName);
+        scriptsObjectsFilesPaths.insert( pair<string,string>(fileName,ofFilePath::getAbsolutePath(filepath)) );
+        if(fileExt == "FRAG"){
+            // related VERT
+            string vsPath = ofFilePath::getEnclosingDirectory(filepath)+fileName.substr(0,fileName.find_last_of('.'))+".vert";
+            string vsName = ofFilePath::getFileName(vsPath);
+            sfe.names.push_back(vsName);
+            scriptsObjectsFilesPaths.insert( pair<string,string>(vsName,ofFilePath::getAbsolutePath(vsPath)) );
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void ofxVisualProgramming::releaseScriptFile(int id){
+    map<int,ScriptFileEntry>::iterator entry = scriptsObjectsFiles.find(id);
+    if(entry == scriptsObjectsFiles.end()){
+        return;
+    }
+    for(size_t n=0;n<entry->second.names.size();n++){
+        // keep the file if another object still uses it
+        bool shared = false;
+        for(map<int,ScriptFileEntry>::iterator it = scriptsObjectsFiles.begin(); it != scriptsObjectsFiles.end(); it++ ){
+            if(it != entry && std::find(it->second.names.begin(),it->second.names.end(),entry->second.names.at(n)) != it->second.names.end()){
+                shared = true;
+                break;
+            }
+        }
+        if(!shared){
+            scriptsObjectsFilesPaths.erase(entry->second.names.at(n));
+        }
+    }
+    scriptsObjectsFiles.erase(entry);
+}
+
 //--------------------------------------------------------------
 string ofxVisualProgramming::getSubpatchParent(string subpatchName){
     for(map<string,vector<string>>::iterator it = subpatchesTree.begin(); it != subpatchesTree.end(); it++ ){
@@ -1014,6 +1188,7 @@ void ofxVisualProgramming::removeObject(int &id){
                 }else{
                     it->second->outPut[j]->isDisabled = true;
                     patchObjects[it->second->outPut[j]->toObjectID]->inletsConnected[it->second->outPut[j]->toInletID] = false;
+                    patchObjects[it->second->outPut[j]->toObjectID]->resetInlet(it->second->outPut[j]->toInletID);
                 }
             }
             it->second->outPut = tempBuffer;
@@ -1059,17 +1234,17 @@ bool ofxVisualProgramming::connect(int fromID, int fromOutlet, int toID,int toIn
         patchObjects[toID]->inletsConnected[toInlet] = true;
 
         if(tempLink->type == VP_LINK_NUMERIC){
-            patchObjects[toID]->_inletParams[toInlet] = new float();
+            patchObjects[toID]->_inletParams[toInlet] = nullptr;
         }else if(tempLink->type == VP_LINK_STRING){
-            patchObjects[toID]->_inletParams[toInlet] = new string();
+            patchObjects[toID]->resetInletBuffer<string>(toInlet);
         }else if(tempLink->type == VP_LINK_ARRAY){
-            patchObjects[toID]->_inletParams[toInlet] = new vector<float>();
+            patchObjects[toID]->resetInletBuffer<vector<float>>(toInlet);
         }else if(tempLink->type == VP_LINK_PIXELS){
-            patchObjects[toID]->_inletParams[toInlet] = new ofPixels();
+            patchObjects[toID]->resetInletBuffer<ofPixels>(toInlet);
         }else if(tempLink->type == VP_LINK_TEXTURE){
-            patchObjects[toID]->_inletParams[toInlet] = new ofTexture();
+            patchObjects[toID]->resetInletBuffer<ofTexture>(toInlet);
         }else if(tempLink->type == VP_LINK_AUDIO){
-            patchObjects[toID]->_inletParams[toInlet] = new ofSoundBuffer();
+            patchObjects[toID]->resetInletBuffer<ofSoundBuffer>(toInlet);
             if(patchObjects[fromID]->getIsPDSPPatchableObject() && patchObjects[toID]->getIsPDSPPatchableObject()){
                 patchObjects[fromID]->pdspOut[fromOutlet] >> patchObjects[toID]->pdspIn[toInlet];
             }else if(patchObjects[fromID]->getName() == "audio device" && patchObjects[toID]->getIsPDSPPatchableObject()){
@@ -1204,6 +1379,7 @@ void ofxVisualProgramming::preloadPatch(string patchFile){
         }else{
             for(int in=0;in<it->second->getNumInlets();in++){
                 it->second->inletsConnected[in] = false;
+                it->second->resetInlet(in);
                 it->second->pdspIn[in].disconnectIn();
             }
 
@@ -1244,6 +1420,13 @@ void ofxVisualProgramming::openPatch(string patchFile){
 //--------------------------------------------------------------
 void ofxVisualProgramming::loadPatch(string patchFile){
 
+    // handshake with the audio callback: once bLoadingNewPatch is set it skips the objects,
+    // taking the lock once waits for a block that was already iterating them
+    bLoadingNewPatch = true;
+    {
+        std::lock_guard<std::mutex> lck(vp_mutex);
+    }
+
     ofxXmlSettings XML;
 
     if (XML.loadFile(patchFile)){
@@ -1266,96 +1449,125 @@ void ofxVisualProgramming::loadPatch(string patchFile){
                 XML.setValue("bpm",bpm);
             }
 
-            audioDevices = soundStreamIN.getDeviceList();
-            audioDevicesStringIN.clear();
-            audioDevicesID_IN.clear();
-            audioDevicesStringOUT.clear();
-            audioDevicesID_OUT.clear();
-            ofLog(OF_LOG_NOTICE,"------------------- AUDIO DEVICES");
-            for(size_t i=0;i<audioDevices.size();i++){
-                if(audioDevices[i].inputChannels > 0){
-                    audioDevicesStringIN.push_back("  "+audioDevices[i].name);
-                    audioDevicesID_IN.push_back(i);
-                    //ofLog(OF_LOG_NOTICE,"INPUT Device[%zu]: %s (IN:%i - OUT:%i)",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels);
-
+            if(headless){
+                // no sound card: channels and rates come from the patch, the engine is pulled block by block by OfflineRenderer
+                audioSampleRate = XML.getValue("sample_rate_out",0);
+                if(audioSampleRate <= 0){
+                    audioSampleRate = 44100;
                 }
-                if(audioDevices[i].outputChannels > 0){
-                    audioDevicesStringOUT.push_back("  "+audioDevices[i].name);
-                    audioDevicesID_OUT.push_back(i);
-                    //ofLog(OF_LOG_NOTICE,"OUTPUT Device[%zu]: %s (IN:%i - OUT:%i)",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels);
+                if(audioBufferSize <= 0){
+                    audioBufferSize = 256;
                 }
-                string tempSR = "";
-                for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
-                    if(sr < audioDevices[i].sampleRates.size()-1){
-                        tempSR += ofToString(audioDevices[i].sampleRates.at(sr))+", ";
-                    }else{
-                        tempSR += ofToString(audioDevices[i].sampleRates.at(sr));
+
+                delete engine;
+                engine = nullptr;
+                engine = new pdsp::Engine();
+
+                engine->setChannels(XML.getValue("input_channels",0), XML.getValue("output_channels",2));
+                this->setChannels(0,0);
+                this->out_silent() >> engine->blackhole();
+                engine->sequencer.setTempo(bpm);
+                pdsp::prepareAllToPlay(audioBufferSize, audioSampleRate);
+
+                dspON = true;
+
+                ofLog(OF_LOG_NOTICE,"[verbose]------------------- Headless audio: %i Hz, %i samples per block",audioSampleRate,audioBufferSize);
+            }else{
+                audioDevices = soundStreamIN.getDeviceList();
+                audioDevicesStringIN.clear();
+                audioDevicesID_IN.clear();
+                audioDevicesStringOUT.clear();
+                audioDevicesID_OUT.clear();
+                ofLog(OF_LOG_NOTICE,"------------------- AUDIO DEVICES");
+                for(size_t i=0;i<audioDevices.size();i++){
+                    if(audioDevices[i].inputChannels > 0){
+                        audioDevicesStringIN.push_back("  "+audioDevices[i].name);
+                        audioDevicesID_IN.push_back(i);
+                        //ofLog(OF_LOG_NOTICE,"INPUT Device[%zu]: %s (IN:%i - OUT:%i)",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels);
+
+                    }
+                    if(audioDevices[i].outputChannels > 0){
+                        audioDevicesStringOUT.push_back("  "+audioDevices[i].name);
+                        audioDevicesID_OUT.push_back(i);
+                        //ofLog(OF_LOG_NOTICE,"OUTPUT Device[%zu]: %s (IN:%i - OUT:%i)",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels);
+                    }
+                    string tempSR = "";
+                    for(size_t sr=0;sr<audioDevices[i].sampleRates.size();sr++){
+                        if(sr < audioDevices[i].sampleRates.size()-1){
+                            tempSR += ofToString(audioDevices[i].sampleRates.at(sr))+", ";
+                        }else{
+                            tempSR += ofToString(audioDevices[i].sampleRates.at(sr));
+                        }
                     }
+                    ofLog(OF_LOG_NOTICE,"Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
                 }
-                ofLog(OF_LOG_NOTICE,"Device[%zu]: %s (IN:%i - OUT:%i), Sample Rates: %s",i,audioDevices[i].name.c_str(),audioDevices[i].inputChannels,audioDevices[i].outputChannels,tempSR.c_str());
-            }
 
-            // check audio devices index
-            audioGUIINIndex         = -1;
-            audioGUIOUTIndex        = -1;
+                // check audio devices index
+                audioGUIINIndex         = -1;
+                audioGUIOUTIndex        = -1;
 
-            for(size_t i=0;i<audioDevicesID_IN.size();i++){
-                if(audioDevicesID_IN.at(i) == audioINDev){
-                    audioGUIINIndex = i;
-                    break;
+                for(size_t i=0;i<audioDevicesID_IN.size();i++){
+                    if(audioDevicesID_IN.at(i) == audioINDev){
+                        audioGUIINIndex = i;
+                        break;
+                    }
                 }
-            }
-            if(audioGUIINIndex == -1){
-                audioGUIINIndex = 0;
-                audioINDev = audioDevicesID_IN.at(audioGUIINIndex);
-            }
-            for(size_t i=0;i<audioDevicesID_OUT.size();i++){
-                if(audioDevicesID_OUT.at(i) == audioOUTDev){
-                    audioGUIOUTIndex = i;
-                    break;
+                if(audioGUIINIndex == -1){
+                    audioGUIINIndex = 0;
+                    audioINDev = audioDevicesID_IN.at(audioGUIINIndex);
+                }
+                for(size_t i=0;i<audioDevicesID_OUT.size();i++){
+                    if(audioDevicesID_OUT.at(i) == audioOUTDev){
+                        audioGUIOUTIndex = i;
+                        break;
+                    }
+                }
+                if(audioGUIOUTIndex == -1){
+                    audioGUIOUTIndex = 0;
+                    audioOUTDev = audioDevicesID_OUT.at(audioGUIOUTIndex);
                 }
-            }
-            if(audioGUIOUTIndex == -1){
-                audioGUIOUTIndex = 0;
-                audioOUTDev = audioDevicesID_OUT.at(audioGUIOUTIndex);
-            }
 
-            audioSampleRate = audioDevices[audioOUTDev].sampleRates[0];
+                audioSampleRate = audioDevices[audioOUTDev].sampleRates[0];
 
-            if(audioSampleRate < 44100){
-                audioSampleRate = 44100;
-            }
+                if(audioSampleRate < 44100){
+                    audioSampleRate = 44100;
+                }
 
-            XML.setValue("sample_rate_in",audioSampleRate);
-            XML.setValue("sample_rate_out",audioSampleRate);
-            XML.setValue("input_channels",static_cast<int>(audioDevices[audioINDev].inputChannels));
-            XML.setValue("output_channels",static_cast<int>(audioDevices[audioOUTDev].outputChannels));
-            XML.saveFile();
+                XML.setValue("sample_rate_in",audioSampleRate);
+                XML.setValue("sample_rate_out",audioSampleRate);
+                XML.setValue("input_channels",static_cast<int>(audioDevices[audioINDev].inputChannels));
+                XML.setValue("output_channels",static_cast<int>(audioDevices[audioOUTDev].outputChannels));
+                XML.saveFile();
 
-            delete engine;
-            engine = nullptr;
-            engine = new pdsp::Engine();
+                delete engine;
+                engine = nullptr;
+                engine = new pdsp::Engine();
 
-            if(dspON){
-                engine->setChannels(audioDevices[audioINDev].inputChannels, audioDevices[audioOUTDev].outputChannels);
-                this->setChannels(audioDevices[audioINDev].inputChannels,0);
+                if(dspON){
+                    engine->setChannels(audioDevices[audioINDev].inputChannels, audioDevices[audioOUTDev].outputChannels);
+                    this->setChannels(audioDevices[audioINDev].inputChannels,0);
 
-                for(int in=0;in<audioDevices[audioINDev].inputChannels;in++){
-                    engine->audio_in(in) >> this->in(in);
+                    for(int in=0;in<audioDevices[audioINDev].inputChannels;in++){
+                        engine->audio_in(in) >> this->in(in);
+                    }
+                    this->out_silent() >> engine->blackhole();
+
+                    engine->setOutputDeviceID(audioDevices[audioOUTDev].deviceID);
+                    engine->setInputDeviceID(audioDevices[audioINDev].deviceID);
+                    uint64_t streamStart = ofxVPAudioClock::get().getSampleCount();
+                    engine->setup(audioSampleRate, audioBufferSize, 3);
+                    engine->sequencer.setTempo(bpm);
+
+                    ofLog(OF_LOG_NOTICE,"[verbose]------------------- Soundstream INPUT Started on");
+                    ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioINDev].name.c_str());
+                    ofLog(OF_LOG_NOTICE,"[verbose]------------------- Soundstream OUTPUT Started on");
+                    ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioOUTDev].name.c_str());
+
+                    // go on as soon as the stream delivers its first block
+                    if(!ofxVPAudioClock::get().waitForAudio(streamStart,0.5)){
+                        ofLog(OF_LOG_WARNING,"Soundstream not running yet, loading the patch anyway");
+                    }
                 }
-                this->out_silent() >> engine->blackhole();
-
-                engine->setOutputDeviceID(audioDevices[audioOUTDev].deviceID);
-                engine->setInputDeviceID(audioDevices[audioINDev].deviceID);
-                engine->setup(audioSampleRate, audioBufferSize, 3);
-                engine->sequencer.setTempo(bpm);
-
-                ofLog(OF_LOG_NOTICE,"[verbose]------------------- Soundstream INPUT Started on");
-                ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioINDev].name.c_str());
-                ofLog(OF_LOG_NOTICE,"[verbose]------------------- Soundstream OUTPUT Started on");
-                ofLog(OF_LOG_NOTICE,"Audio device: %s",audioDevices[audioOUTDev].name.c_str());
-
-                std::this_thread::sleep_for(std::chrono::milliseconds(200));
             }
 
             XML.popTag();
@@ -1384,8 +1596,6 @@ void ofxVisualProgramming::loadPatch(string patchFile){
                             patchObjects[tempObj->getId()] = tempObj;
                             actualObjectID = tempObj->getId();
                             lastAddedObjectID = tempObj->getId();
-
-                            std::this_thread::sleep_for(std::chrono::milliseconds(10));
                         }
                     }
                     XML.popTag();
@@ -1409,7 +1619,6 @@ void ofxVisualProgramming::loadPatch(string patchFile){
 
                                         if(connect(fromID,j,toObjectID,toInletID,linkType)){
                                             //ofLog(OF_LOG_NOTICE,"Connected object %s, outlet %i TO object %s, inlet %i",patchObjects[fromID]->getName().c_str(),z,patchObjects[toObjectID]->getName().c_str(),toInletID);
-                                            std::this_thread::sleep_for(std::chrono::milliseconds(10));
                                         }
 
                                         XML.popTag();
@@ -1427,7 +1636,9 @@ void ofxVisualProgramming::loadPatch(string patchFile){
         }
 
         #if !defined(TARGET_WIN32)
+        if(!headless){
             activateDSP();
+        }
         #endif
 
     }
@@ -1439,6 +1650,9 @@ void ofxVisualProgramming::loadPatch(string patchFile){
 //--------------------------------------------------------------
 void ofxVisualProgramming::reloadPatch(){
     bLoadingNewPatch = true;
+    {
+        std::lock_guard<std::mutex> lck(vp_mutex);
+    }
 
     // clear previous patch
     for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
@@ -1446,11 +1660,27 @@ void ofxVisualProgramming::reloadPatch(){
     }
 
     patchObjects.clear();
+    scriptsObjectsFiles.clear();
+    scriptsObjectsFilesPaths.clear();
 
     // load new patch
     loadPatch(currentPatchFile);
 }
 
+//--------------------------------------------------------------
+bool ofxVisualProgramming::isPatchReady(){
+    if(bLoadingNewPatch || clearingObjectsMap){
+        return false;
+    }
+    for(map<int,shared_ptr<PatchObject>>::iterator it = patchObjects.begin(); it != patchObjects.end(); it++ ){
+        // objects of the other subpatches are not running
+        if(!it->second->getWillErase() && it->second->subpatchName == currentSubpatch && !it->second->getIsReady()){
+            return false;
+        }
+    }
+    return true;
+}
+
 //--------------------------------------------------------------
 void ofxVisualProgramming::savePatchAs(string patchFile){
 
@@ -35,6 +35,7 @@
 #include "ofMain.h"
 
 #include "config.h"
+#include "audioClock.h"
 
 #include "ofxInfiniteCanvas.h"
 #include "ofxPDSP.h"
@@ -50,6 +51,15 @@
 
 #define OFXVP_DEBUG 0
 
+// render on demand: how long (ms) after the last change or input the editor keeps redrawing
+#define VP_RENDER_ON_DEMAND_HOLD    500
+
+// script files (lua, python, bash, glsl) used by a patch object,
+// refreshed only when the object filepath changes
+struct ScriptFileEntry {
+    string          filepath;
+    vector<string>  names;
+};
 
 class ofxVisualProgramming : public pdsp::Wrapper {
     
@@ -59,6 +69,15 @@ public:
     ~ofxVisualProgramming();
 
     void            setRetina(bool retina);
+    // call before setup(): no sound card, no visible windows, audio pulled by OfflineRenderer
+    void            setHeadless(bool _headless);
+    // redraw only on input, canvas moves or node content changes: while idle draw() keeps the last
+    // frame on screen (no background clear) and update() runs at the normal rate, hosts drawing
+    // over the patch should skip their own draw when isRenderIdle()
+    void            setRenderOnDemand(bool onDemand);
+    bool            isRenderOnDemand() const { return renderOnDemand; }
+    bool            isRenderIdle() const { return renderIdle; }
+    void            wakeUp();
     void            setup(ofxImGui::Gui* guiRef = nullptr, string release="");
     void            update();
     void            updateCanvasViewport();
@@ -98,6 +117,8 @@ public:
     bool            weAlreadyHaveObject(string name);
     void            deleteObject(int id);
     void            clearObjectsMap();
+    void            updateScriptFile(int id, const string &filepath);
+    void            releaseScriptFile(int id);
 
     string          getSubpatchParent(string subpatchName);
 
@@ -107,6 +128,8 @@ public:
     void            openPatch(string patchFile);
     void            loadPatch(string patchFile);
     void            reloadPatch();
+    // patch loaded and every running object ready (PatchObject::getIsReady())
+    bool            isPatchReady();
     void            savePatchAs(string patchFile);
     void            setPatchVariable(string var, int value);
 
@@ -122,6 +145,7 @@ public:
     ofxImGui::Gui*                  ofxVPGui;
     ImGuiEx::NodeCanvas             nodeCanvas;
     ImGuiEx::ProfilersWindow        profiler;
+    vector<ImGuiEx::ProfilerTask>   profilerTasks;
 
 
     // PATCH DRAWING RESOURCES
@@ -135,7 +159,8 @@ public:
 
     // PATCH OBJECTS
     map<int,shared_ptr<PatchObject>>    patchObjects;
-    map<string,string>                  scriptsObjectsFilesPaths;
+    map<string,string>                  scriptsObjectsFilesPaths;   // script file name -> absolute path, for the code editor
+    map<int,ScriptFileEntry>            scriptsObjectsFiles;        // object id -> registered script files
     vector<pair<int,int>>               leftToRightIndexOrder;
     vector<int>                         eraseIndexes;
 
@@ -145,8 +170,8 @@ public:
     int                                 selectedObjectID;
     int                                 actualObjectID;
     int                                 lastAddedObjectID;
-    bool                                bLoadingNewObject;
-    bool                                bLoadingNewPatch;
+    std::atomic<bool>                   bLoadingNewObject;
+    std::atomic<bool>                   bLoadingNewPatch;
     bool                                clearingObjectsMap;
 
     // LOAD/SAVE
@@ -188,12 +213,21 @@ public:
     int                                 audioBufferSize;
     int                                 bpm;
     bool                                dspON;
+    bool                                headless;
+
+    // RENDER ON DEMAND
+    bool                                renderOnDemand;
+    bool                                renderIdle;
+    bool                                backgroundAuto;
+    uint64_t                            lastContentVersion;
+    uint64_t                            lastActivityTime;
 
     // MEMORY
     uint64_t                resetTime;
     uint64_t                wait;
 
 private:
+    void updateRenderOnDemand();
     void audioProcess(float *input, int bufferSize, int nChannels);
 
     mutable ofMutex         vp_mutex;
@@ -45,6 +45,7 @@
 #include <fstream>
 
 #include "imgui_node_canvas.h"
+#include "fboPool.h"
 
 //--------------------------------------------------------------
 inline std::string random_string( size_t length ){
@@ -348,9 +349,256 @@ inline std::string forceCheckMosaicDataPath(std::string filepath){
     }
 }
 
+//--------------------------------------------------------------
+// Node texture previews are queued during an object draw and drawn when it ends, so nodes
+// stacked over others keep covering them: previews outside the visible canvas area are
+// dropped, the backgrounds of the object go in one mesh.
+// A preview smaller than its source is drawn from a thumbnail, at the power of two size tier
+// covering its size on screen, downscaled again only when its source changes: the version of
+// the texture port it comes from (set with setPortVersion()), or for textures not on a port the
+// content version of the object drawing it (PatchObject::getContentVersion()). Unselected
+// objects refresh it at most every NODE_PREVIEW_UNSELECTED_FRAMES frames.
+
+#define NODE_PREVIEW_MIN_TIER           64
+#define NODE_PREVIEW_MAX_TIER           512
+#define NODE_PREVIEW_UNSELECTED_FRAMES  6
+// frames an unused thumbnail is kept (node off-screen, removed, zoomed in)
+#define NODE_PREVIEW_KEEP_FRAMES        120
+
+class NodePreviewBatch {
+public:
+    NodePreviewBatch() : numPreviews(0), numBackgrounds(0), currentObject(-1), currentVersion(0), objectPreviews(0), selectedObject(-1), frame(0), refreshed(0), lastRefreshed(0) {
+        backgrounds.setMode(OF_PRIMITIVE_TRIANGLES);
+    }
+
+    // visible canvas area, in canvas coordinates
+    void setVisibleArea(const ofRectangle &area){ visibleArea = area; }
+    bool isVisible(const ofRectangle &r) const { return visibleArea.intersects(r); }
+
+    // object drawing previews (PatchObject::draw()), -1 outside of an object draw
+    void setSelectedObject(int id){ selectedObject = id; }
+    void beginObject(int id, uint64_t version){ currentObject = id; currentVersion = version; objectPreviews = 0; portVersions.clear(); }
+    // version of a texture on a port of the current object, by GL texture id
+    void setPortVersion(GLuint textureID, uint64_t version){ if(textureID != 0) portVersions.push_back(std::make_pair(textureID,version)); }
+    void endObject(){ currentObject = -1; drawQueued(); }
+
+    size_t getNumThumbnails() const { return thumbnails.size(); }
+    size_t getNumRefreshed() const { return lastRefreshed; }
+
+    void addBackground(const ofRectangle &r){
+        if(!isVisible(r)) return;
+        const size_t v = numBackgrounds*6;
+        if(backgrounds.getNumVertices() < v+6){
+            backgrounds.getVertices().resize(v+6);
+        }
+        glm::vec3 *verts = backgrounds.getVerticesPointer() + v;
+        verts[0] = glm::vec3(r.getLeft(),r.getTop(),0);
+        verts[1] = glm::vec3(r.getRight(),r.getTop(),0);
+        verts[2] = glm::vec3(r.getRight(),r.getBottom(),0);
+        verts[3] = glm::vec3(r.getLeft(),r.getTop(),0);
+        verts[4] = glm::vec3(r.getRight(),r.getBottom(),0);
+        verts[5] = glm::vec3(r.getLeft(),r.getBottom(),0);
+        numBackgrounds++;
+    }
+
+    // zoom: canvas scale, to get the preview size on screen
+    void addTexture(const ofTexture &tex, const ofRectangle &r, float zoom=1.0f){
+        if(!isVisible(r)) return;
+        if(previews.size() <= numPreviews){
+            previews.resize(numPreviews+1);
+        }
+        previews[numPreviews].tex = getThumbnail(tex,r.width*zoom,r.height*zoom);
+        previews[numPreviews].rect = r;
+        numPreviews++;
+    }
+
+    // once per frame, after all objects draw
+    void flush(){
+        drawQueued();
+
+        // thumbnails not drawn for a while go back to the pool
+        for(auto it = thumbnails.begin(); it != thumbnails.end();){
+            if(frame - it->second.lastUse > NODE_PREVIEW_KEEP_FRAMES){
+                ofxVPFboPool::get().release(it->second.fbo);
+                it = thumbnails.erase(it);
+            }else{
+                it++;
+            }
+        }
+        lastRefreshed   = refreshed;
+        refreshed       = 0;
+        frame++;
+    }
+
+private:
+    void drawQueued(){
+        if(numBackgrounds > 0){
+            // drop the unused tail, the vertices vector keeps its capacity
+            backgrounds.getVertices().resize(numBackgrounds*6);
+            ofSetColor(34,34,34);
+            backgrounds.draw();
+        }
+        ofSetColor(255);
+        for(size_t i=0;i<numPreviews;i++){
+            previews[i].tex.draw(previews[i].rect);
+        }
+        numPreviews     = 0;
+        numBackgrounds  = 0;
+    }
+
+    struct Preview {
+        ofTexture   tex; // shallow copy, shares the GL texture
+        ofRectangle rect;
+    };
+
+    struct Thumbnail {
+        ofFbo       *fbo;
+        GLuint      sourceID;
+        uint64_t    version;
+        uint64_t    lastRefresh;
+        uint64_t    lastUse;
+    };
+
+    const ofTexture& getThumbnail(const ofTexture &tex, float screenW, float screenH){
+        if(currentObject < 0){
+            return tex;
+        }
+        const std::pair<int,int> key(currentObject,objectPreviews++);
+
+        int tier = NODE_PREVIEW_MIN_TIER;
+        while(tier < std::max(screenW,screenH) && tier < NODE_PREVIEW_MAX_TIER){
+            tier *= 2;
+        }
+        // zoomed in past the source resolution: the source itself
+        if(tier >= std::max(tex.getWidth(),tex.getHeight())){
+            return tex;
+        }
+        int tw = tex.getWidth() >= tex.getHeight() ? tier : std::max(1,static_cast<int>(tier*tex.getWidth()/tex.getHeight()));
+        int th = tex.getWidth() >= tex.getHeight() ? std::max(1,static_cast<int>(tier*tex.getHeight()/tex.getWidth())) : tier;
+
+        auto it = thumbnails.find(key);
+        bool refresh = false;
+        if(it == thumbnails.end() || static_cast<int>(it->second.fbo->getWidth()) != tw || static_cast<int>(it->second.fbo->getHeight()) != th){
+            if(it != thumbnails.end()){
+                ofxVPFboPool::get().release(it->second.fbo);
+            }
+            Thumbnail t = { ofxVPFboPool::get().acquire(tw,th,GL_RGBA,0,currentObject), 0, 0, 0, frame };
+            thumbnails[key] = t;
+            it = thumbnails.find(key);
+            refresh = true;
+        }
+        Thumbnail &t = it->second;
+        t.lastUse = frame;
+
+        GLuint sourceID = tex.getTextureData().textureID;
+        uint64_t version = currentVersion;
+        for(size_t i=0;i<portVersions.size();i++){
+            if(portVersions[i].first == sourceID){
+                version = portVersions[i].second;
+                break;
+            }
+        }
+        if(t.sourceID != sourceID){
+            refresh = true;
+        }else if(t.version != version){
+            refresh = currentObject == selectedObject || frame - t.lastRefresh >= NODE_PREVIEW_UNSELECTED_FRAMES;
+        }
+
+        if(refresh){
+            t.sourceID      = sourceID;
+            t.version       = version;
+            t.lastRefresh   = frame;
+            downscale(tex,*t.fbo);
+            refreshed++;
+        }
+        return t.fbo->getTexture();
+    }
+
+    // halving passes down to twice the thumbnail size, then the last one: every source texel is read
+    void downscale(const ofTexture &tex, ofFbo &thumb){
+        ofPushStyle();
+        ofDisableAlphaBlending();
+        ofSetColor(255);
+
+        const ofTexture *level = &tex;
+        ofFbo *prev = nullptr;
+        float lw = tex.getWidth();
+        float lh = tex.getHeight();
+        while(lw > thumb.getWidth()*2 && lh > thumb.getHeight()*2){
+            lw = ceilf(lw/2.0f);
+            lh = ceilf(lh/2.0f);
+            ofFbo *next = ofxVPFboPool::get().acquireTransient(static_cast<int>(lw),static_cast<int>(lh),GL_RGBA);
+            next->begin();
+            level->draw(0,0,lw,lh);
+            next->end();
+            ofxVPFboPool::get().releaseTransient(prev);
+            prev = next;
+            level = &next->getTexture();
+        }
+
+        thumb.begin();
+        ofClear(0,0,0,0);
+        level->draw(0,0,thumb.getWidth(),thumb.getHeight());
+        thumb.end();
+        ofxVPFboPool::get().releaseTransient(prev);
+
+        ofPopStyle();
+    }
+
+    ofRectangle         visibleArea;
+    vector<Preview>     previews;
+    size_t              numPreviews;
+    ofMesh              backgrounds;
+    size_t              numBackgrounds;
+
+    map<std::pair<int,int>,Thumbnail>   thumbnails;     // object id, preview index in the object draw
+    int                 currentObject;
+    uint64_t            currentVersion;
+    vector<std::pair<GLuint,uint64_t>>  portVersions;
+    int                 objectPreviews;
+    int                 selectedObject;
+    uint64_t            frame;
+    size_t              refreshed;
+    size_t              lastRefreshed;
+};
+
+inline NodePreviewBatch& getNodePreviewBatch(){
+    static NodePreviewBatch batch;
+    return batch;
+}
+
+//--------------------------------------------------------------
+inline ofRectangle getNodeOFBackground(float originX, float originY, float scaledW, float scaledH, float zoom, float retinaScale=1.0f, bool hasInlets=true){
+    ofRectangle bg;
+    if(hasInlets){
+        bg.set(originX-(IMGUI_EX_NODE_PINS_WIDTH_NORMAL*retinaScale/zoom),originY-(IMGUI_EX_NODE_HEADER_HEIGHT*retinaScale/zoom),scaledW + (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*retinaScale/zoom),scaledH + ((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*retinaScale/zoom) );
+    }else{
+        bg.set(originX,originY-(IMGUI_EX_NODE_HEADER_HEIGHT*retinaScale/zoom),scaledW,scaledH + ((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*retinaScale/zoom) );
+    }
+    return bg;
+}
+
+//--------------------------------------------------------------
+// node background with no texture, queued with the previews (dropped off-screen)
+inline void drawNodeOFBackground(float originX, float originY, float scaledW, float scaledH, float zoom, float retinaScale=1.0f, bool hasInlets=true){
+    getNodePreviewBatch().addBackground(getNodeOFBackground(originX,originY,scaledW,scaledH,zoom,retinaScale,hasInlets));
+}
+
 //--------------------------------------------------------------
 inline void drawNodeOFTexture(ofTexture &tex, float &px, float &py, float &w, float &h, float originX, float originY, float scaledW, float scaledH, float zoom, float retinaScale=1.0f, bool hasInlets=true){
 
+    NodePreviewBatch &batch = getNodePreviewBatch();
+
+    // background
+    ofRectangle bg = getNodeOFBackground(originX,originY,scaledW,scaledH,zoom,retinaScale,hasInlets);
+
+    // off-screen node, nothing to draw
+    if(!batch.isVisible(bg)){
+        return;
+    }
+
+    batch.addBackground(bg);
+
     if(tex.isAllocated()){
         if(tex.getWidth()/tex.getHeight() >= scaledW/scaledH){
             if(tex.getWidth() > tex.getHeight()){   // horizontal texture
@@ -371,25 +619,8 @@ inline void drawNodeOFTexture(ofTexture &tex, float &px, float &py, float &w, fl
             py              = 0;
         }
 
-        // background
-        ofSetColor(34,34,34);
-        if(hasInlets){
-            ofDrawRectangle(originX-(IMGUI_EX_NODE_PINS_WIDTH_NORMAL*retinaScale/zoom),originY-(IMGUI_EX_NODE_HEADER_HEIGHT*retinaScale/zoom),scaledW + (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*retinaScale/zoom),scaledH + ((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*retinaScale/zoom) );
-        }else{
-            ofDrawRectangle(originX,originY-(IMGUI_EX_NODE_HEADER_HEIGHT*retinaScale/zoom),scaledW,scaledH + ((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*retinaScale/zoom) );
-        }
-
         // texture
-        ofSetColor(255);
-        tex.draw(px+originX,py+originY,w-(2*retinaScale),h);
-    }else{
-        // background
-        ofSetColor(34,34,34);
-        if(hasInlets){
-            ofDrawRectangle(originX-(IMGUI_EX_NODE_PINS_WIDTH_NORMAL*retinaScale/zoom),originY-(IMGUI_EX_NODE_HEADER_HEIGHT*retinaScale/zoom),scaledW + (IMGUI_EX_NODE_PINS_WIDTH_NORMAL*retinaScale/zoom),scaledH + ((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*retinaScale/zoom) );
-        }else{
-            ofDrawRectangle(originX,originY-(IMGUI_EX_NODE_HEADER_HEIGHT*retinaScale/zoom),scaledW,scaledH + ((IMGUI_EX_NODE_HEADER_HEIGHT+IMGUI_EX_NODE_FOOTER_HEIGHT)*retinaScale/zoom) );
-        }
+        batch.addTexture(tex,ofRectangle(px+originX,py+originY,w-(2*retinaScale),h),zoom);
     }
 
 }